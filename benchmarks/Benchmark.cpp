@@ -0,0 +1,382 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Profiler.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <new>
+
+// The cmake script passes the files that are found in the themes folder, separated by commas
+#ifndef BENCHMARK_THEMES_DIR
+    #define BENCHMARK_THEMES_DIR "themes/"
+#endif
+#ifndef BENCHMARK_THEME_FILES
+    #define BENCHMARK_THEME_FILES "Black.txt,BabyBlue.txt,TransparentGrey.txt"
+#endif
+#ifndef BENCHMARK_THEME_IMAGES
+    #define BENCHMARK_THEME_IMAGES "Black.png,BabyBlue.png"
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Every allocation made by the program, including the ones inside TGUI and SFML, passes through these replacements.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    std::atomic<std::size_t> allocationCount{0};
+
+    void* allocate(std::size_t size)
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+        tgui::Profiler::addAllocation();
+        return std::malloc(size > 0 ? size : 1);
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    void* ptr = allocate(size);
+    if (!ptr)
+        throw std::bad_alloc{};
+    return ptr;
+}
+
+void* operator new[](std::size_t size)
+{
+    void* ptr = allocate(size);
+    if (!ptr)
+        throw std::bad_alloc{};
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    namespace
+    {
+        struct Registration
+        {
+            std::string name;
+            std::function<void(State&)> function;
+        };
+
+        // Function-local static because the benchmarks register themselves during static initialization
+        std::vector<Registration>& getRegistrations()
+        {
+            static std::vector<Registration> registrations;
+            return registrations;
+        }
+
+        std::vector<std::string> splitFileList(const std::string& list)
+        {
+            std::vector<std::string> files;
+            std::string::size_type start = 0;
+            while (start < list.size())
+            {
+                std::string::size_type end = list.find(',', start);
+                if (end == std::string::npos)
+                    end = list.size();
+
+                if (end > start)
+                    files.push_back(getThemesDirectory() + list.substr(start, end - start));
+
+                start = end + 1;
+            }
+
+            return files;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    State::State(std::chrono::nanoseconds minTime, std::size_t maxIterations) :
+        m_minTime      {minTime},
+        m_maxIterations{maxIterations}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool State::keepRunning()
+    {
+        if (!m_started)
+        {
+            m_started = true;
+            resumeTiming();
+            return true;
+        }
+
+        ++m_iterations;
+        if ((m_iterations >= m_maxIterations) || (getMeasuredTime() >= m_minTime))
+        {
+            pauseTiming();
+            return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::pauseTiming()
+    {
+        if (!m_running)
+            return;
+
+        m_measuredTime += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_resumeTime);
+        m_allocations += getAllocationCount() - m_allocationsAtResume;
+        m_running = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::resumeTiming()
+    {
+        if (m_running)
+            return;
+
+        m_running = true;
+        m_allocationsAtResume = getAllocationCount();
+        m_resumeTime = std::chrono::steady_clock::now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::addDrawCalls(std::size_t drawCalls)
+    {
+        m_drawCalls += drawCalls;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void State::setCounter(const std::string& name, double value)
+    {
+        m_counters[name] = value;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t State::getIterations() const
+    {
+        return m_iterations;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::chrono::nanoseconds State::getMeasuredTime() const
+    {
+        if (m_running)
+            return m_measuredTime + std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_resumeTime);
+        else
+            return m_measuredTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t State::getAllocations() const
+    {
+        return m_allocations;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t State::getDrawCalls() const
+    {
+        return m_drawCalls;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::map<std::string, double>& State::getCounters() const
+    {
+        return m_counters;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Scene::Scene(unsigned int width, unsigned int height)
+    {
+        m_target.create(width, height);
+        gui.setTarget(m_target);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Scene::draw(State& state)
+    {
+        m_target.clear();
+        gui.draw();
+        m_target.display();
+        state.addDrawCalls(gui.getDrawStatistics().drawCalls);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool addBenchmark(const std::string& name, const std::function<void(State&)>& function)
+    {
+        getRegistrations().push_back({name, function});
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> getBenchmarkNames()
+    {
+        std::vector<std::string> names;
+        for (const auto& registration : getRegistrations())
+            names.push_back(registration.name);
+
+        return names;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<Result> runBenchmarks(const std::string& filter, std::chrono::nanoseconds minTime, std::size_t maxIterations)
+    {
+        std::vector<Result> results;
+        for (const auto& registration : getRegistrations())
+        {
+            if (registration.name.find(filter) == std::string::npos)
+                continue;
+
+            std::cerr << "Running " << registration.name << std::endl;
+
+            Result result;
+            result.name = registration.name;
+
+            State state{minTime, maxIterations};
+            try
+            {
+                registration.function(state);
+            }
+            catch (const std::exception& e)
+            {
+                result.error = e.what();
+            }
+
+            result.iterations = state.getIterations();
+            if (result.iterations > 0)
+            {
+                const double iterations = static_cast<double>(result.iterations);
+                result.nsPerOp = state.getMeasuredTime().count() / iterations;
+                result.allocationsPerOp = state.getAllocations() / iterations;
+                result.drawCallsPerOp = state.getDrawCalls() / iterations;
+            }
+            else if (result.error.empty())
+                result.error = "The benchmark didn't run any iterations";
+
+            result.counters = state.getCounters();
+            results.push_back(std::move(result));
+        }
+
+        return results;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t getAllocationCount()
+    {
+        return allocationCount.load(std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string getThemesDirectory()
+    {
+        return BENCHMARK_THEMES_DIR;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> getThemeFiles()
+    {
+        return splitFileList(BENCHMARK_THEME_FILES);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> getThemeImages()
+    {
+        return splitFileList(BENCHMARK_THEME_IMAGES);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<std::string>& getRendererSections()
+    {
+        static const std::vector<std::string> sections = {
+            "Button", "ChatBox", "CheckBox", "ChildWindow", "ComboBox", "EditBox", "Knob", "Label", "ListBox", "MenuBar",
+            "MessageBox", "Panel", "ProgressBar", "RadioButton", "Scrollbar", "Slider", "SpinButton", "Tabs", "TextBox"
+        };
+        return sections;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,167 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BENCHMARK_HPP
+#define TGUI_BENCHMARK_HPP
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <TGUI/Gui.hpp>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// The benchmarks draw into an sf::RenderTexture, so they don't need a window and can run with a software OpenGL implementation
+// (e.g. LIBGL_ALWAYS_SOFTWARE=1 under xvfb-run) on machines without a gpu.
+//
+// A benchmark does its setup, measures its loop and then cleans up:
+//
+//     BENCHMARK("Draw/Something")
+//     {
+//         Scene scene{800, 600};
+//         ...
+//         while (state.keepRunning())
+//             scene.draw(state);
+//     }
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+#define BENCHMARK_IMPL(name, function) \
+    static void function(bench::State& state); \
+    static const bool BENCHMARK_CONCAT(function, Registered) = bench::addBenchmark(name, function); \
+    static void function(bench::State& state)
+
+#define BENCHMARK(name) BENCHMARK_IMPL(name, BENCHMARK_CONCAT(benchmark, __LINE__))
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Measures the loop of a single benchmark. Only the time and allocations between starting and stopping the loop are counted,
+    // and pauseTiming/resumeTiming can exclude preparations that have to be repeated inside the loop.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class State
+    {
+    public:
+
+        State(std::chrono::nanoseconds minTime, std::size_t maxIterations);
+
+        // Returns true as long as another iteration has to be run
+        bool keepRunning();
+
+        void pauseTiming();
+        void resumeTiming();
+
+        // Draw calls that were made during the current iteration, usually passed by Scene::draw
+        void addDrawCalls(std::size_t drawCalls);
+
+        // Stores an extra value in the results, e.g. the amount of memory used at the end of the benchmark
+        void setCounter(const std::string& name, double value);
+
+        std::size_t getIterations() const;
+        std::chrono::nanoseconds getMeasuredTime() const;
+        std::size_t getAllocations() const;
+        std::size_t getDrawCalls() const;
+        const std::map<std::string, double>& getCounters() const;
+
+    private:
+        std::chrono::nanoseconds m_minTime;
+        std::size_t m_maxIterations;
+
+        bool m_started = false;
+        bool m_running = false;
+        std::size_t m_iterations = 0;
+        std::chrono::steady_clock::time_point m_resumeTime;
+        std::chrono::nanoseconds m_measuredTime{0};
+        std::size_t m_allocationsAtResume = 0;
+        std::size_t m_allocations = 0;
+        std::size_t m_drawCalls = 0;
+        std::map<std::string, double> m_counters;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Render texture with a gui that draws on it
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class Scene
+    {
+    public:
+
+        Scene(unsigned int width, unsigned int height);
+
+        // Clears the render texture, draws the gui on it and counts the draw calls
+        void draw(State& state);
+
+    private:
+        sf::RenderTexture m_target;
+
+    public:
+        tgui::Gui gui;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct Result
+    {
+        std::string name;
+        std::size_t iterations = 0;
+        double nsPerOp = 0;
+        double allocationsPerOp = 0;
+        double drawCallsPerOp = 0;
+        std::map<std::string, double> counters;
+        std::string error; // Empty unless the benchmark threw an exception
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool addBenchmark(const std::string& name, const std::function<void(State&)>& function);
+
+    std::vector<std::string> getBenchmarkNames();
+
+    // Runs all benchmarks of which the name contains the filter
+    std::vector<Result> runBenchmarks(const std::string& filter, std::chrono::nanoseconds minTime, std::size_t maxIterations);
+
+    // Amount of times operator new was called since the program started
+    std::size_t getAllocationCount();
+
+    // Folder containing the themes, ending with a slash
+    std::string getThemesDirectory();
+
+    // Full paths of the theme files and of the images in the themes folder
+    std::vector<std::string> getThemeFiles();
+    std::vector<std::string> getThemeImages();
+
+    // Sections that a theme file can contain for the widgets
+    const std::vector<std::string>& getRendererSections();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BENCHMARK_HPP
@@ -0,0 +1,182 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <TGUI/PrimitiveBuilder.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ChatBox.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/to_string.hpp>
+
+namespace
+{
+    void drawButtonGrid(bench::State& state, bool drawBatching)
+    {
+        bench::Scene scene{2000, 1000};
+        scene.gui.setDrawBatchingEnabled(drawBatching);
+        for (unsigned int y = 0; y < 100; ++y)
+        {
+            for (unsigned int x = 0; x < 100; ++x)
+            {
+                auto button = tgui::Button::create("B");
+                button->setPosition({x * 20.f, y * 10.f});
+                button->setSize({20, 10});
+                button->setTextSize(8);
+                scene.gui.add(button);
+            }
+        }
+
+        while (state.keepRunning())
+            scene.draw(state);
+    }
+
+    class NumberProvider : public tgui::ItemProvider
+    {
+    public:
+        explicit NumberProvider(std::size_t count) :
+            m_count{count}
+        {
+        }
+
+        std::size_t getItemCount() const override
+        {
+            return m_count;
+        }
+
+        sf::String getItem(std::size_t index) const override
+        {
+            return "Item " + tgui::to_string(index);
+        }
+
+    private:
+        std::size_t m_count;
+    };
+
+    tgui::ListBox::Ptr createListBox(bench::Scene& scene)
+    {
+        auto listBox = tgui::ListBox::create();
+        listBox->setSize({300, 600});
+        scene.gui.add(listBox);
+        return listBox;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Draw/ButtonGrid10k")
+{
+    drawButtonGrid(state, false);
+}
+
+BENCHMARK("Draw/ButtonGrid10k/Batched")
+{
+    drawButtonGrid(state, true);
+}
+
+BENCHMARK("Draw/ListBox1M")
+{
+    bench::Scene scene{400, 600};
+    auto listBox = createListBox(scene);
+    for (std::size_t i = 0; i < 1000000; ++i)
+        listBox->addItem("Item " + tgui::to_string(i));
+
+    while (state.keepRunning())
+        scene.draw(state);
+}
+
+BENCHMARK("Draw/ListBox1M/ItemProvider")
+{
+    bench::Scene scene{400, 600};
+    auto listBox = createListBox(scene);
+    listBox->setItemProvider(std::make_shared<NumberProvider>(1000000));
+
+    while (state.keepRunning())
+        scene.draw(state);
+}
+
+BENCHMARK("Draw/ListBox1M/Scrolling")
+{
+    bench::Scene scene{400, 600};
+    auto listBox = createListBox(scene);
+    listBox->setItemProvider(std::make_shared<NumberProvider>(1000000));
+
+    sf::Event event;
+    event.type = sf::Event::MouseWheelScrolled;
+    event.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+    event.mouseWheelScroll.x = 150;
+    event.mouseWheelScroll.y = 300;
+
+    // Scroll down for a while and then back up, so that the scrollbar never gets stuck at one of the ends
+    std::size_t step = 0;
+    while (state.keepRunning())
+    {
+        event.mouseWheelScroll.delta = ((step++ / 1000) % 2 == 0) ? -1.f : 1.f;
+        scene.gui.handleEvent(event);
+        scene.draw(state);
+    }
+}
+
+BENCHMARK("Draw/ChatBox100k")
+{
+    bench::Scene scene{600, 600};
+    auto chatBox = tgui::ChatBox::create();
+    chatBox->setSize({600, 600});
+    scene.gui.add(chatBox);
+    for (std::size_t i = 0; i < 100000; ++i)
+        chatBox->addLine("Line " + tgui::to_string(i) + ": the quick brown fox jumps over the lazy dog");
+
+    while (state.keepRunning())
+        scene.draw(state);
+}
+
+BENCHMARK("ChatBox/AddLine100k")
+{
+    auto chatBox = tgui::ChatBox::create();
+    chatBox->setSize({600, 600});
+    for (std::size_t i = 0; i < 100000; ++i)
+        chatBox->addLine("Line " + tgui::to_string(i) + ": the quick brown fox jumps over the lazy dog");
+
+    const sf::String line = "Another line: the quick brown fox jumps over the lazy dog";
+    while (state.keepRunning())
+        chatBox->addLine(line);
+}
+
+// Building the geometry of the widget shapes shouldn't allocate once the vertex storage has grown large enough
+BENCHMARK("Primitives/Geometry")
+{
+    std::vector<sf::Vertex> vertices;
+    while (state.keepRunning())
+    {
+        vertices.clear();
+        tgui::PrimitiveBuilder::addRectangle(vertices, {10, 10}, {100, 50}, sf::Color::White);
+        tgui::PrimitiveBuilder::addBorders(vertices, {10, 10}, {100, 50}, {2}, sf::Color::Black);
+        tgui::PrimitiveBuilder::addTriangle(vertices, {0, 0}, {10, 0}, {5, 10}, sf::Color::Red);
+        tgui::PrimitiveBuilder::addCircle(vertices, {50, 50}, 20, sf::Color::Green);
+        tgui::PrimitiveBuilder::addRing(vertices, {50, 50}, 15, 20, sf::Color::Blue);
+    }
+
+    state.setCounter("vertices", static_cast<double>(vertices.size()));
+}
@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/TextBox.hpp>
+#include <random>
+
+namespace
+{
+    // Every panel contains 2x2 smaller panels until the deepest level, where the panels contain 4 buttons
+    void addNestedPanels(const tgui::Container::Ptr& parent, tgui::Vector2f size, unsigned int depth, bool spatialIndex)
+    {
+        parent->setSpatialIndexEnabled(spatialIndex);
+
+        const tgui::Vector2f childSize{size.x / 2, size.y / 2};
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            const tgui::Vector2f position{(i % 2) * childSize.x, (i / 2) * childSize.y};
+            if (depth == 0)
+            {
+                auto button = tgui::Button::create("Button");
+                button->setPosition(position);
+                button->setSize(childSize);
+                parent->add(button);
+            }
+            else
+            {
+                auto panel = tgui::Panel::create(childSize);
+                panel->setPosition(position);
+                parent->add(panel);
+                addNestedPanels(panel, childSize, depth - 1, spatialIndex);
+            }
+        }
+    }
+
+    void mouseMoveStorm(bench::State& state, bool spatialIndex)
+    {
+        bench::Scene scene{1000, 600};
+        scene.gui.getContainer()->setSpatialIndexEnabled(spatialIndex);
+        for (unsigned int y = 0; y < 6; ++y)
+        {
+            for (unsigned int x = 0; x < 10; ++x)
+            {
+                auto panel = tgui::Panel::create({100, 100});
+                panel->setPosition({x * 100.f, y * 100.f});
+                scene.gui.add(panel);
+                addNestedPanels(panel, {100, 100}, 3, spatialIndex);
+            }
+        }
+
+        std::mt19937 generator{42};
+        std::uniform_int_distribution<int> distributionX{0, 999};
+        std::uniform_int_distribution<int> distributionY{0, 599};
+        std::vector<sf::Event> events(4096);
+        for (auto& event : events)
+        {
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove.x = distributionX(generator);
+            event.mouseMove.y = distributionY(generator);
+        }
+
+        std::size_t i = 0;
+        while (state.keepRunning())
+            scene.gui.handleEvent(events[i++ % events.size()]);
+    }
+
+    tgui::TextBox::Ptr createTextBoxWithDocument(bench::Scene& scene)
+    {
+        // Lines of 80 characters, 5 MB in total
+        std::string document;
+        document.reserve(5 * 1024 * 1024);
+        const std::string line = std::string(79, 'x') + '\n';
+        while (document.size() + line.size() <= 5 * 1024 * 1024)
+            document += line;
+
+        auto textBox = tgui::TextBox::create();
+        textBox->setSize({800, 600});
+        textBox->setText(document);
+        scene.gui.add(textBox);
+
+        // Click inside the text box to focus it, which places the caret on the first line
+        sf::Event event;
+        event.type = sf::Event::MouseButtonPressed;
+        event.mouseButton.button = sf::Mouse::Left;
+        event.mouseButton.x = 20;
+        event.mouseButton.y = 10;
+        scene.gui.handleEvent(event);
+        event.type = sf::Event::MouseButtonReleased;
+        scene.gui.handleEvent(event);
+        return textBox;
+    }
+
+    void emitSignal(bench::State& state, unsigned int handlerCount)
+    {
+        tgui::Signal signal{"Benchmark"};
+        unsigned int calls = 0;
+        for (unsigned int i = 0; i < handlerCount; ++i)
+            signal.connect([&calls]{ ++calls; });
+
+        while (state.keepRunning())
+            signal.emit(nullptr);
+
+        state.setCounter("calls", calls);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Events/MouseMoveStorm")
+{
+    mouseMoveStorm(state, false);
+}
+
+BENCHMARK("Events/MouseMoveStorm/SpatialIndex")
+{
+    mouseMoveStorm(state, true);
+}
+
+BENCHMARK("Events/TextBoxTyping5MB")
+{
+    bench::Scene scene{800, 600};
+    createTextBoxWithDocument(scene);
+
+    sf::Event event;
+    event.type = sf::Event::TextEntered;
+    event.text.unicode = 'a';
+    while (state.keepRunning())
+        scene.gui.handleEvent(event);
+}
+
+BENCHMARK("Events/TextBoxTyping5MB/Draw")
+{
+    bench::Scene scene{800, 600};
+    createTextBoxWithDocument(scene);
+
+    sf::Event event;
+    event.type = sf::Event::TextEntered;
+    event.text.unicode = 'a';
+    while (state.keepRunning())
+    {
+        scene.gui.handleEvent(event);
+        scene.draw(state);
+    }
+}
+
+BENCHMARK("Signal/Emit/0Handlers")
+{
+    emitSignal(state, 0);
+}
+
+BENCHMARK("Signal/Emit/1Handler")
+{
+    emitSignal(state, 1);
+}
+
+BENCHMARK("Signal/Emit/10Handlers")
+{
+    emitSignal(state, 10);
+}
@@ -0,0 +1,234 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/ListBox.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/to_string.hpp>
+
+namespace
+{
+    // Form of 100 rows with 20 buttons of which the size is relative to the panel and the position is bound to the neighbouring buttons
+    void resizeLayouts(bench::State& state, bool layoutBatching)
+    {
+        bench::Scene scene{800, 600};
+        scene.gui.setLayoutBatchingEnabled(layoutBatching);
+
+        auto panel = tgui::Panel::create({800, 600});
+        scene.gui.add(panel);
+
+        tgui::Widget::Ptr firstInPreviousRow;
+        for (unsigned int y = 0; y < 100; ++y)
+        {
+            tgui::Widget::Ptr previous;
+            for (unsigned int x = 0; x < 20; ++x)
+            {
+                auto button = tgui::Button::create();
+                button->setSize({"5%", "1%"});
+                button->setPosition({previous ? tgui::bindRight(previous) : tgui::Layout{0},
+                                     firstInPreviousRow ? tgui::bindBottom(firstInPreviousRow) : tgui::Layout{0}});
+                panel->add(button);
+
+                if (!previous)
+                    firstInPreviousRow = button;
+                previous = button;
+            }
+        }
+
+        bool grow = true;
+        while (state.keepRunning())
+        {
+            panel->setSize(grow ? tgui::Vector2f{810, 610} : tgui::Vector2f{800, 600});
+            scene.gui.flushLayouts();
+            grow = !grow;
+        }
+
+        scene.gui.setLayoutBatchingEnabled(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<sf::String> createItemNames(const std::string& prefix, std::size_t count)
+    {
+        std::vector<sf::String> names;
+        names.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+            names.push_back(prefix + tgui::to_string(i));
+
+        return names;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Appends items until the list box contains itemCount items, then starts again with an empty list box
+    void addListBoxItems(bench::State& state, std::size_t itemCount)
+    {
+        auto listBox = tgui::ListBox::create();
+        listBox->setSize({300, 600});
+
+        const std::vector<sf::String> items = createItemNames("Item ", itemCount);
+
+        std::size_t i = 0;
+        while (state.keepRunning())
+        {
+            listBox->addItem(items[i]);
+            if (++i == items.size())
+            {
+                state.pauseTiming();
+                listBox->removeAllItems();
+                i = 0;
+                state.resumeTiming();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Removes the first item from a list box that is refilled to itemCount items whenever it becomes empty
+    void removeListBoxItems(bench::State& state, std::size_t itemCount)
+    {
+        auto listBox = tgui::ListBox::create();
+        listBox->setSize({300, 600});
+
+        const std::vector<sf::String> items = createItemNames("Item ", itemCount);
+
+        while (state.keepRunning())
+        {
+            if (listBox->getItemCount() == 0)
+            {
+                state.pauseTiming();
+                for (const auto& item : items)
+                    listBox->addItem(item);
+                state.resumeTiming();
+            }
+
+            listBox->removeItemByIndex(0);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Selects items by id in a list box containing itemCount items
+    void lookupListBoxItems(bench::State& state, std::size_t itemCount)
+    {
+        auto listBox = tgui::ListBox::create();
+        listBox->setSize({300, 600});
+
+        const std::vector<sf::String> ids = createItemNames("Id", itemCount);
+        for (std::size_t i = 0; i < ids.size(); ++i)
+            listBox->addItem("Item " + tgui::to_string(i), ids[i]);
+
+        std::size_t i = 0;
+        while (state.keepRunning())
+            listBox->setSelectedItemById(ids[(i++ * 7919) % ids.size()]);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Layout/Resize2k")
+{
+    resizeLayouts(state, false);
+}
+
+BENCHMARK("Layout/Resize2k/Batched")
+{
+    resizeLayouts(state, true);
+}
+
+// Looks up widgets inside a nested panel, so that the search has to descend into the child containers
+BENCHMARK("Container/NameLookup10k")
+{
+    bench::Scene scene{800, 600};
+    auto outerPanel = tgui::Panel::create();
+    scene.gui.add(outerPanel, "Outer");
+    auto innerPanel = tgui::Panel::create();
+    outerPanel->add(innerPanel, "Inner");
+
+    std::vector<sf::String> names;
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        names.push_back("Widget" + tgui::to_string(i));
+        innerPanel->add(tgui::Button::create(), names.back());
+    }
+
+    std::size_t found = 0;
+    std::size_t i = 0;
+    while (state.keepRunning())
+    {
+        if (scene.gui.get(names[(i * 7919) % names.size()]))
+            ++found;
+        ++i;
+    }
+
+    state.setCounter("found", static_cast<double>(found));
+}
+
+BENCHMARK("ListBox/AddItem10k")
+{
+    addListBoxItems(state, 10000);
+}
+
+BENCHMARK("ListBox/AddItem100k")
+{
+    addListBoxItems(state, 100000);
+}
+
+BENCHMARK("ListBox/AddItem1M")
+{
+    addListBoxItems(state, 1000000);
+}
+
+BENCHMARK("ListBox/RemoveItem10k")
+{
+    removeListBoxItems(state, 10000);
+}
+
+BENCHMARK("ListBox/RemoveItem100k")
+{
+    removeListBoxItems(state, 100000);
+}
+
+BENCHMARK("ListBox/RemoveItem1M")
+{
+    removeListBoxItems(state, 1000000);
+}
+
+BENCHMARK("ListBox/LookupById10k")
+{
+    lookupListBoxItems(state, 10000);
+}
+
+BENCHMARK("ListBox/LookupById100k")
+{
+    lookupListBoxItems(state, 100000);
+}
+
+BENCHMARK("ListBox/LookupById1M")
+{
+    lookupListBoxItems(state, 1000000);
+}
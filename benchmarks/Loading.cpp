@@ -0,0 +1,255 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Loading/WidgetFactory.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/to_string.hpp>
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    // The widget types for which the theme file contains a section
+    std::vector<std::string> getThemedWidgetTypes(const std::string& themeFile)
+    {
+        const tgui::Theme theme{themeFile}; // Makes sure that the file is in the cache of the theme loader
+
+        std::vector<std::string> types;
+        for (const auto& type : bench::getRendererSections())
+        {
+            if (tgui::Theme::getThemeLoader()->canLoad(themeFile, type))
+                types.push_back(type);
+        }
+
+        return types;
+    }
+
+    void loadTheme(bench::State& state, const std::string& themeFile)
+    {
+        const auto types = getThemedWidgetTypes(themeFile);
+        while (state.keepRunning())
+        {
+            tgui::DefaultThemeLoader::flushCache(themeFile);
+
+            tgui::Theme theme{themeFile};
+            for (const auto& type : types)
+                theme.getRenderer(type);
+        }
+    }
+
+    // Switches 10 widgets of every type back and forth between the default renderer and the one from the theme
+    void applyTheme(bench::State& state, const std::string& themeFile)
+    {
+        tgui::Theme theme{themeFile};
+
+        std::vector<tgui::Widget::Ptr> widgets;
+        std::vector<std::shared_ptr<tgui::RendererData>> defaultRenderers;
+        std::vector<std::shared_ptr<tgui::RendererData>> themeRenderers;
+        for (const auto& type : getThemedWidgetTypes(themeFile))
+        {
+            for (unsigned int i = 0; i < 10; ++i)
+            {
+                widgets.push_back(tgui::WidgetFactory::getConstructFunction(type)());
+                defaultRenderers.push_back(widgets.back()->getSharedRenderer()->getData());
+                themeRenderers.push_back(theme.getRenderer(type));
+            }
+        }
+
+        bool useTheme = true;
+        while (state.keepRunning())
+        {
+            for (std::size_t i = 0; i < widgets.size(); ++i)
+                widgets[i]->setRenderer(useTheme ? themeRenderers[i] : defaultRenderers[i]);
+
+            useTheme = !useTheme;
+        }
+    }
+
+    bool registerThemeBenchmarks()
+    {
+        for (const auto& themeFile : bench::getThemeFiles())
+        {
+            const std::string name = themeFile.substr(bench::getThemesDirectory().size());
+            bench::addBenchmark("Theme/Load/" + name, [themeFile](bench::State& state){ loadTheme(state, themeFile); });
+            bench::addBenchmark("Theme/Apply/" + name, [themeFile](bench::State& state){ applyTheme(state, themeFile); });
+        }
+
+        return true;
+    }
+
+    const bool themeBenchmarksRegistered = registerThemeBenchmarks();
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Creates 100 panels with 200 widgets each and saves them in both the text and the binary format
+    void createWidgetFiles(const std::string& textFile, const std::string& binaryFile)
+    {
+        tgui::Gui gui;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto panel = tgui::Panel::create({400, 400});
+            panel->setPosition({(i % 10) * 40.f, (i / 10) * 40.f});
+            gui.add(panel, "Panel" + tgui::to_string(i));
+
+            for (unsigned int j = 0; j < 200; ++j)
+            {
+                tgui::Widget::Ptr widget;
+                switch (j % 4)
+                {
+                    case 0:
+                        widget = tgui::Button::create("Button " + tgui::to_string(j));
+                        break;
+                    case 1:
+                        widget = tgui::Label::create("Label " + tgui::to_string(j));
+                        break;
+                    case 2:
+                        widget = tgui::EditBox::create();
+                        break;
+                    default:
+                        widget = tgui::CheckBox::create("CheckBox " + tgui::to_string(j));
+                        break;
+                }
+
+                widget->setPosition({(j % 10) * 40.f, (j / 10) * 20.f});
+                widget->setSize({"10%", 18});
+                panel->add(widget, "Widget" + tgui::to_string(j));
+            }
+        }
+
+        gui.saveWidgetsToFile(textFile);
+        gui.saveWidgetsToBinary(binaryFile);
+    }
+
+    void loadWidgetFile(bench::State& state, bool binary)
+    {
+        const std::string textFile = "benchmark-form.txt";
+        const std::string binaryFile = "benchmark-form.bin";
+        createWidgetFiles(textFile, binaryFile);
+
+        tgui::Gui gui;
+        while (state.keepRunning())
+        {
+            if (binary)
+                gui.loadWidgetsFromBinary(binaryFile);
+            else
+                gui.loadWidgetsFromFile(textFile);
+
+            state.pauseTiming();
+            gui.removeAllWidgets();
+            state.resumeTiming();
+        }
+
+        std::remove(textFile.c_str());
+        std::remove(binaryFile.c_str());
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Loading/WidgetFile20k/Text")
+{
+    loadWidgetFile(state, false);
+}
+
+BENCHMARK("Loading/WidgetFile20k/Binary")
+{
+    loadWidgetFile(state, true);
+}
+
+// Parses all themes while their images are decoded on worker threads, until the last image is decoded
+BENCHMARK("Theme/PreloadAll")
+{
+    const auto themeFiles = bench::getThemeFiles();
+    const bool wasPreloadingImages = tgui::DefaultThemeLoader::isImagePreloadingEnabled();
+    tgui::DefaultThemeLoader::setImagePreloadingEnabled(true);
+
+    std::size_t images = 0;
+    sf::Time imageDecodeTime;
+    while (state.keepRunning())
+    {
+        tgui::DefaultThemeLoader::flushCache();
+        for (const auto& file : themeFiles)
+            tgui::Theme::getThemeLoader()->preload(file);
+
+        // Getting the timings waits until the images of the theme are decoded
+        images = 0;
+        for (const auto& file : themeFiles)
+        {
+            const auto timings = tgui::DefaultThemeLoader::getLoadTimings(file);
+            images += timings.images;
+            imageDecodeTime += timings.imageDecodeTime;
+        }
+    }
+
+    tgui::DefaultThemeLoader::flushCache();
+    tgui::DefaultThemeLoader::setImagePreloadingEnabled(wasPreloadingImages);
+    state.setCounter("images", static_cast<double>(images));
+    state.setCounter("imageDecodeMs", imageDecodeTime.asSeconds() * 1000.0 / std::max<std::size_t>(state.getIterations(), 1));
+}
+
+// Loads another theme file into the theme that all widgets are connected to
+BENCHMARK("Theme/Switch")
+{
+    // Only the types that are found in every theme file are used, theme files that only contain a single widget are skipped
+    std::vector<std::string> themeFiles;
+    std::vector<std::string> types = bench::getRendererSections();
+    for (const auto& file : bench::getThemeFiles())
+    {
+        const auto themedTypes = getThemedWidgetTypes(file);
+        if (std::find(themedTypes.begin(), themedTypes.end(), "Button") == themedTypes.end())
+            continue;
+
+        themeFiles.push_back(file);
+        types.erase(std::remove_if(types.begin(), types.end(), [&](const std::string& type){
+            return std::find(themedTypes.begin(), themedTypes.end(), type) == themedTypes.end();
+        }), types.end());
+    }
+    if (themeFiles.size() < 2)
+        throw tgui::Exception{"At least two theme files with a Button section are needed to switch themes"};
+
+    tgui::Theme theme{themeFiles[0]};
+    tgui::Theme::setDefault(&theme);
+
+    std::vector<tgui::Widget::Ptr> widgets;
+    for (const auto& type : types)
+    {
+        for (unsigned int i = 0; i < 20; ++i)
+            widgets.push_back(tgui::WidgetFactory::getConstructFunction(type)());
+    }
+
+    std::size_t i = 0;
+    while (state.keepRunning())
+        theme.load(themeFiles[++i % themeFiles.size()]);
+
+    tgui::Theme::setDefault(nullptr);
+}
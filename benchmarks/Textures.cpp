@@ -0,0 +1,122 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Loading/Theme.hpp>
+#include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+
+namespace
+{
+    // Loads the textures of all renderers in all themes and reports how much video memory they use
+    void loadThemeTextures(bench::State& state, bool atlas)
+    {
+        const bool wasAtlasEnabled = tgui::TextureManager::isAtlasEnabled();
+        tgui::TextureManager::setAtlasEnabled(atlas);
+
+        tgui::TextureManager::Statistics statistics;
+        while (state.keepRunning())
+        {
+            std::vector<std::shared_ptr<tgui::RendererData>> renderers;
+            for (const auto& themeFile : bench::getThemeFiles())
+            {
+                tgui::DefaultThemeLoader::flushCache(themeFile);
+
+                tgui::Theme theme{themeFile};
+                for (const auto& section : bench::getRendererSections())
+                {
+                    if (tgui::Theme::getThemeLoader()->canLoad(themeFile, section))
+                        renderers.push_back(theme.getRenderer(section));
+                }
+            }
+
+            // The textures are released again when the renderers are destroyed at the end of the iteration
+            state.pauseTiming();
+            statistics = tgui::TextureManager::getStatistics();
+            renderers.clear();
+            state.resumeTiming();
+        }
+
+        state.setCounter("textureBytes", static_cast<double>(statistics.textureBytes));
+        state.setCounter("textureBytesWithoutAtlas", static_cast<double>(statistics.textureBytesWithoutAtlas));
+        state.setCounter("atlasPages", static_cast<double>(statistics.atlasPages));
+        state.setCounter("textures", static_cast<double>(statistics.textures));
+
+        tgui::DefaultThemeLoader::flushCache();
+        tgui::TextureManager::setAtlasEnabled(wasAtlasEnabled);
+    }
+
+    // Shows every image of the themes in a picture and waits until all of them can be drawn
+    void loadImages(bench::State& state, bool async)
+    {
+        const bool wasAsyncLoadingEnabled = tgui::TextureManager::isAsyncLoadingEnabled();
+        tgui::TextureManager::setAsyncLoadingEnabled(async);
+
+        const std::vector<std::string> images = bench::getThemeImages();
+        while (state.keepRunning())
+        {
+            std::vector<tgui::Picture::Ptr> pictures;
+            for (const auto& image : images)
+            {
+                auto picture = tgui::Picture::create(tgui::Texture{image});
+                picture->setSize({100, 100});
+                pictures.push_back(picture);
+            }
+
+            while (tgui::TextureManager::getPendingAsyncLoads() > 0)
+                tgui::TextureManager::processAsyncLoads(sf::milliseconds(5));
+
+            state.pauseTiming();
+            pictures.clear();
+            state.resumeTiming();
+        }
+
+        tgui::TextureManager::setAsyncLoadingEnabled(wasAsyncLoadingEnabled);
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BENCHMARK("Textures/ThemeTextures")
+{
+    loadThemeTextures(state, false);
+}
+
+BENCHMARK("Textures/ThemeTextures/Atlas")
+{
+    loadThemeTextures(state, true);
+}
+
+BENCHMARK("Textures/LoadImages")
+{
+    loadImages(state, false);
+}
+
+BENCHMARK("Textures/LoadImages/Async")
+{
+    loadImages(state, true);
+}
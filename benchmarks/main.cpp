@@ -0,0 +1,177 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace
+{
+    void printUsage(const char* program)
+    {
+        std::cout << "Usage: " << program << " [options]\n"
+                  << "  --filter <text>       Only run the benchmarks of which the name contains the text\n"
+                  << "  --min-time <sec>      Minimum time to measure each benchmark (default 0.5)\n"
+                  << "  --max-iterations <n>  Maximum amount of iterations of each benchmark\n"
+                  << "  --json <file>         Also write the results to a json file\n"
+                  << "  --list                Print the names of the benchmarks without running them\n";
+    }
+
+    void writeJsonString(std::ostream& stream, const std::string& str)
+    {
+        stream << '"';
+        for (const char c : str)
+        {
+            if ((c == '"') || (c == '\\'))
+                stream << '\\' << c;
+            else if (static_cast<unsigned char>(c) < 32)
+                stream << ' ';
+            else
+                stream << c;
+        }
+        stream << '"';
+    }
+
+    void writeJson(std::ostream& stream, const std::vector<bench::Result>& results)
+    {
+        stream << std::setprecision(15) << "{\n  \"benchmarks\": [";
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& result = results[i];
+            stream << (i > 0 ? "," : "") << "\n    {\"name\": ";
+            writeJsonString(stream, result.name);
+            stream << ", \"iterations\": " << result.iterations
+                   << ", \"nsPerOp\": " << result.nsPerOp
+                   << ", \"allocationsPerOp\": " << result.allocationsPerOp
+                   << ", \"drawCallsPerOp\": " << result.drawCallsPerOp
+                   << ", \"counters\": {";
+
+            bool first = true;
+            for (const auto& counter : result.counters)
+            {
+                stream << (first ? "" : ", ");
+                writeJsonString(stream, counter.first);
+                stream << ": " << counter.second;
+                first = false;
+            }
+            stream << "}";
+
+            if (!result.error.empty())
+            {
+                stream << ", \"error\": ";
+                writeJsonString(stream, result.error);
+            }
+
+            stream << "}";
+        }
+        stream << "\n  ]\n}\n";
+    }
+
+    void printResults(const std::vector<bench::Result>& results)
+    {
+        std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(12) << "Iterations"
+                  << std::setw(16) << "ns/op" << std::setw(14) << "allocs/op" << std::setw(14) << "draws/op" << "\n";
+
+        std::cout << std::fixed << std::setprecision(1);
+        for (const auto& result : results)
+        {
+            std::cout << std::left << std::setw(48) << result.name << std::right;
+            if (!result.error.empty())
+            {
+                std::cout << "  FAILED: " << result.error << "\n";
+                continue;
+            }
+
+            std::cout << std::setw(12) << result.iterations << std::setw(16) << result.nsPerOp
+                      << std::setw(14) << result.allocationsPerOp << std::setw(14) << result.drawCallsPerOp << "\n";
+
+            for (const auto& counter : result.counters)
+                std::cout << "    " << counter.first << " = " << counter.second << "\n";
+        }
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    std::string filter;
+    std::string jsonFilename;
+    double minTime = 0.5;
+    std::size_t maxIterations = 1000000000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if ((arg == "--filter") && hasValue)
+            filter = argv[++i];
+        else if ((arg == "--json") && hasValue)
+            jsonFilename = argv[++i];
+        else if ((arg == "--min-time") && hasValue)
+            minTime = std::atof(argv[++i]);
+        else if ((arg == "--max-iterations") && hasValue)
+            maxIterations = static_cast<std::size_t>(std::atoll(argv[++i]));
+        else if (arg == "--list")
+        {
+            for (const auto& name : bench::getBenchmarkNames())
+                std::cout << name << "\n";
+            return EXIT_SUCCESS;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return (arg == "--help") ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    const auto results = bench::runBenchmarks(filter, std::chrono::nanoseconds{static_cast<long long>(minTime * 1e9)},
+                                              std::max<std::size_t>(maxIterations, 1));
+    printResults(results);
+
+    if (!jsonFilename.empty())
+    {
+        std::ofstream out{jsonFilename};
+        if (!out.is_open())
+        {
+            std::cerr << "Failed to open " << jsonFilename << " for writing\n";
+            return EXIT_FAILURE;
+        }
+
+        writeJson(out, results);
+    }
+
+    for (const auto& result : results)
+    {
+        if (!result.error.empty())
+            return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
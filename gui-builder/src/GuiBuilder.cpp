@@ -61,7 +61,7 @@ static const float EDIT_BOX_HEIGHT = 24;
 
 namespace
 {
-    bool compareRenderers(std::map<std::string, tgui::ObjectConverter> themePropertyValuePairs, std::map<std::string, tgui::ObjectConverter> widgetPropertyValuePairs)
+    bool compareRenderers(std::unordered_map<tgui::PropertyId, tgui::ObjectConverter> themePropertyValuePairs, std::unordered_map<tgui::PropertyId, tgui::ObjectConverter> widgetPropertyValuePairs)
     {
         for (auto themeIt = themePropertyValuePairs.begin(); themeIt != themePropertyValuePairs.end(); ++themeIt)
         {
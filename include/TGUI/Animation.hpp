@@ -28,15 +28,11 @@
 
 #include <TGUI/Vector2f.hpp>
 #include <SFML/System/Time.hpp>
-#include <functional>
-#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    class Widget;
-
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Type of animation to show/hide widget
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -55,9 +51,23 @@ namespace tgui
         SlideFromBottom = SlideToTop  ///< Slide from bottom to show or to the top to hide
     };
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Curve that decides how fast an animation progresses at each moment
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class AnimationEasing
+    {
+        Linear,    ///< Constant speed
+        EaseIn,    ///< Start slow and speed up
+        EaseOut,   ///< Start fast and slow down at the end
+        EaseInOut  ///< Start slow, speed up and slow down again at the end
+    };
+
     namespace priv
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Animation that interpolates the position, size or opacity of a widget.
+        // The animations are stored by value inside the widget, which applies the interpolated value to itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         class TGUI_API Animation
         {
@@ -70,78 +80,41 @@ namespace tgui
                 Fade = 4
             };
 
-            // Move constructor has to be explicitly declared since this class has a destructor
-            Animation() = default;
-            Animation(const Animation&) = default;
-            Animation(Animation&&) = default;
-            Animation& operator=(const Animation&) = default;
-            Animation& operator=(Animation&&) = default;
-            virtual ~Animation() = default;
+            // The opacity of a fade animation is stored in the x component of the start and end values
+            Animation(Type type, Vector2f start, Vector2f end, sf::Time duration, AnimationEasing easing = AnimationEasing::Linear);
 
             Type getType() const;
 
-            virtual bool update(sf::Time elapsedTime) = 0;
-            virtual void finish();
+            // Advances the animation and returns whether the end was reached
+            bool update(sf::Time elapsedTime);
 
-        protected:
-            Animation(Type type, std::shared_ptr<Widget> widget, sf::Time duration, std::function<void()> finishedCallback);
+            // Value that should be applied to the widget at the current time
+            Vector2f getCurrentValue() const;
 
-        protected:
-            Type m_type = Type::None;
-            std::shared_ptr<Widget> m_widget;
+            Vector2f getStartValue() const;
+            Vector2f getEndValue() const;
 
-            sf::Time m_totalDuration;
-            sf::Time m_elapsedTime;
+            // Time that remains until the animation ends
+            sf::Time getRemainingTime() const;
 
-            std::function<void()> m_finishedCallback;
-        };
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            // Applies the easing curve to a progress value between 0 and 1
+            static float ease(AnimationEasing easing, float progress);
 
-        class TGUI_API MoveAnimation : public Animation
-        {
         public:
-            MoveAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
-
-            bool update(sf::Time elapsedTime) override;
 
-            void finish() override;
+            // What the widget has to do once the animation ends
+            ShowAnimationType showType = ShowAnimationType::Fade;
+            bool hideWidget = false;         // Hide the widget and restore the start value
+            bool emitFinished = false;       // Emit the onAnimationFinished signal
 
         private:
-            Vector2f m_startPos;
-            Vector2f m_endPos;
-        };
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        class TGUI_API ResizeAnimation : public Animation
-        {
-        public:
-            ResizeAnimation(std::shared_ptr<Widget> widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
-
-            bool update(sf::Time elapsedTime) override;
-
-            void finish() override;
-
-        private:
-            Vector2f m_startSize;
-            Vector2f m_endSize;
-        };
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        class TGUI_API FadeAnimation : public Animation
-        {
-        public:
-            FadeAnimation(std::shared_ptr<Widget> widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback = nullptr);
-
-            bool update(sf::Time elapsedTime) override;
-
-            void finish() override;
+            Type m_type = Type::None;
+            Vector2f m_start;
+            Vector2f m_end;
 
-        private:
-            float m_startOpacity;
-            float m_endOpacity;
+            sf::Time m_totalDuration;
+            sf::Time m_elapsedTime;
+            AnimationEasing m_easing = AnimationEasing::Linear;
         };
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
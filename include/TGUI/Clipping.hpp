@@ -23,20 +23,28 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+
 #ifndef TGUI_CLIPPING_HPP
 #define TGUI_CLIPPING_HPP
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
+    /// @brief Restricts drawing to a rectangle for as long as the object exists
+    ///
+    /// The clipping areas are kept on a stack in gui coordinates, each one intersected with the one below it. The geometry drawn
+    /// through DrawBatch is cut off on the cpu. The OpenGL scissor rectangle is also set to the clipping area, so that objects
+    /// which are drawn directly on the target (e.g. by custom widgets) are clipped as well without having to change the view.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API Clipping
     {
     public:
@@ -61,6 +69,35 @@ namespace tgui
         ~Clipping();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns whether a clipping object currently exists
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the area in gui coordinates in which can be drawn. Without clipping object, this is the area shown by the gui view.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const FloatRect& getClipRect();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns whether a rectangle in gui coordinates lies at least partially inside the area in which can be drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isRectVisible(const FloatRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Turns the scissor test off while drawing geometry that was already clipped on the cpu (possibly with a clipping area
+        // that has been popped since), and back on afterwards. Does nothing when no clipping object exists.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setScissorTestEnabled(sf::RenderTarget& target, bool enabled);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Sets the view used by the gui, which the calculations have to take into account when changing the view for clipping
@@ -68,13 +105,25 @@ namespace tgui
         static void setGuiView(const sf::View& view);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the scissor rectangle to the top of the stack, or turns the scissor test off when the stack is empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void applyScissor(sf::RenderTarget& target);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         sf::RenderTarget& m_target;
-        sf::View m_oldView;
 
         static sf::View m_originalView;
+
+        // Area shown by the gui view and the stack of (already intersected) clipping areas, all in gui coordinates
+        static FloatRect m_guiViewRect;
+        static std::vector<FloatRect> m_clipRects;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,8 +28,11 @@
 
 
 #include <list>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <TGUI/SpatialIndex.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -140,6 +143,13 @@ namespace tgui
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// When no widget has the exact name, the name can also be a path separated by dots (e.g. "Panel1.List2"), where each
+        /// part is searched for inside the container that was found for the previous part.
+        ///
+        /// Every container keeps a hash table with the names of its direct children and the top-level container keeps one with
+        /// the names of all widgets inside it. Both tables are updated when widgets are added, removed or renamed, so the lookup
+        /// doesn't depend on the amount of widgets.
+        ///
         /// @return Pointer to the earlier added widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -277,6 +287,37 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a file that was saved with saveWidgetsToBinary or DataIO::convertToBinary
+        /// @param filename  Filename of the binary widget file
+        /// @throw Exception when file could not be opened or does not contain a valid binary widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromBinary(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a binary widget file that is stored in memory
+        ///
+        /// @param data  Pointer to the contents of the binary widget file (e.g. a memory-mapped file)
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @throw Exception when the data does not contain a valid binary widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromBinary(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a binary file
+        ///
+        /// @param filename  Filename of the binary widget file
+        ///
+        /// The binary file contains the same information as a text file but can be loaded faster.
+        ///
+        /// @throw Exception when file could not be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinary(const std::string& filename) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Places a widget before all other widgets
         ///
@@ -295,6 +336,27 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @param enabled  Should the widgets be stored in a spatial index?
+        ///
+        /// Without index, every mouse move checks the child widgets one by one until the widget below the mouse is found.
+        /// With the index, only the widgets of which the bounds (see Widget::getHitTestBounds) contain the mouse are checked.
+        /// The index is updated incrementally when widgets are added, removed, moved, resized or brought to the front.
+        /// It is only worth enabling for containers with many child widgets. Disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a spatial index is used to find the child widget below the mouse
+        ///
+        /// @return Are the widgets stored in a spatial index?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSpatialIndexEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -379,11 +441,26 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        // This function is called every frame with the time passed since the last frame.
+        // This function is called every frame with the time passed since the last frame. Only the child widgets that
+        // requested updates are visited.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns whether the container or one of its child widgets still needs to be updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateNeeded() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the earliest time at which the container or one of its visible child widgets has to be updated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -391,6 +468,28 @@ namespace tgui
         bool handleEvent(sf::Event& event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Called by child widgets when an area (in absolute coordinates) has to be redrawn. The request is passed to the parent.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidateRegion(const FloatRect& region);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Called by child widgets when the area in which they can be found by the mouse may have changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childHitTestBoundsChanged(Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Called by child widgets that need their update function to be called. The container requests updates from its own
+        // parent as well, so that the gui only has to visit the widgets that are actually animating.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleChildUpdates(Widget* child);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -398,10 +497,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -416,6 +516,18 @@ namespace tgui
         void load(const std::unique_ptr<DataIO::Node>& node, const LoadingRenderersMap& renderers) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the child widgets with the ones described in the root node of a parsed widget file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the root node of a widget file that describes the child widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<DataIO::Node> saveWidgetsToNodeTree() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Checks above which widget the mouse is standing.
         // If there is no widget below the mouse then this function will return a null pointer.
@@ -441,6 +553,61 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the spatial index the next time it is needed. Has to be called after reordering m_widgets directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Processes the changes to the child widgets that happened since the spatial index was last used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a widget that was just added to m_widgets to the name lookup tables
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToNameIndex(const Widget::Ptr& widget, const sf::String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes a widget that was just removed from m_widgets from the name lookup tables
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromNameIndex(const Widget::Ptr& widget, const sf::String& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Looks up which direct child is the first one with the given name. Has to be called after reordering m_widgets directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateChildNameIndex(const sf::String& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Throws away the name lookup tables of this container and of the top-level container, they will be rebuilt when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateNameIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the top-level container that contains this container, which is the container itself when it has no parent
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const Container* getNameIndexRoot() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes the widget and all widgets inside it to the table of the top-level container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToDescendantNameIndex(const Widget::Ptr& widget, const sf::String& name) const;
+        void removeFromDescendantNameIndex(const Widget::Ptr& widget, const sf::String& name) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Searches the children and then the child containers like get did before the lookup tables existed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget::Ptr findWidgetRecursive(const sf::String& widgetName) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -458,6 +625,28 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Optional index to find the widget below the mouse without checking every widget
+        std::unique_ptr<SpatialIndex> m_spatialIndex;
+        std::vector<Widget*> m_spatialIndexChangedWidgets;
+        std::size_t m_spatialIndexNextOrder = 0;
+        bool m_spatialIndexNeedsRebuild = false;
+
+        // Child widgets that requested to be updated every frame, in the order in which they requested it
+        std::vector<Widget*> m_scheduledWidgets;
+
+        // Maps the names of the direct children to the first child with that name
+        struct NameHash
+        {
+            std::size_t operator()(const sf::String& name) const;
+        };
+        mutable std::unordered_map<sf::String, Widget::Ptr, NameHash> m_childNameIndex;
+        mutable bool m_childNameIndexValid = false;
+
+        // Only filled in when the container has no parent: maps the names of all widgets inside it (including those in child
+        // containers) to these widgets. Widgets without a name aren't stored in this table.
+        mutable std::unordered_multimap<sf::String, Widget::Ptr, NameHash> m_descendantNameIndex;
+        mutable bool m_descendantNameIndexValid = false;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -513,6 +702,13 @@ namespace tgui
         bool mouseOnWidget(Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Stores the area that has to be redrawn so that the gui can find it when drawing the next frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRegion(const FloatRect& region) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -535,6 +731,9 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Areas (in gui coordinates) that changed since the last time the gui was drawn
+        std::vector<FloatRect> m_invalidatedRegions;
+
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
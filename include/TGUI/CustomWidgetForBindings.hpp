@@ -172,12 +172,33 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// The update function of the bindings is called every frame, so this always returns true.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateNeeded() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// The update function of the bindings may change the widget at any time, so this always returns sf::Time::Zero.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area (relative to the parent widget) outside of which mouseOnWidget never returns true
+        /// @return Unlimited area, as the custom mouseOnWidget implementation could react anywhere
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getHitTestBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,6 +284,7 @@ namespace tgui
         /// @param property  Lowercase name of the property that was changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rendererChanged(const std::string& property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
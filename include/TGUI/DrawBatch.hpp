@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_DRAW_BATCH_HPP
+#define TGUI_DRAW_BATCH_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <cstddef>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the geometry of the widgets and sends it to the render target in as few draw calls as possible
+    ///
+    /// While a batch is active, the vertices passed to addVertices are transformed on the CPU and stored in buckets that share
+    /// the same texture, shader and blend mode. A new draw can be merged with an earlier bucket as long as none of the geometry
+    /// that was recorded in between overlaps with it, so the drawing order is preserved. The buckets are only sent to the
+    /// render target when flush is called, when something is drawn that can't be batched or when the batch ends.
+    ///
+    /// The gui starts a batch when drawing batching is enabled with Gui::setDrawBatchingEnabled.
+    /// When no batch is active, every call is forwarded directly to the render target.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DrawBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters about what was sent to the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t drawCalls = 0;   ///< Amount of draw calls that were made on the render target
+            std::size_t vertices = 0;    ///< Amount of vertices that were sent to the render target
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts recording the geometry that is drawn on the given target
+        ///
+        /// @param target  Render target on which the batched geometry will be drawn when flushing
+        ///
+        /// If a batch was already active then it is flushed first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void begin(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws all recorded geometry and stops batching
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether geometry is currently being recorded
+        ///
+        /// @return Is a batch active?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws all geometry that was recorded so far
+        ///
+        /// This has to be called before changing the state of the render target (e.g. its view) while a batch is active.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws vertices, or adds them to the batch when one is active
+        ///
+        /// @param target       Render target to draw on
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        ///
+        /// Only Triangles and TrianglesStrip primitives can be batched, other types are drawn directly.
+        /// When a Clipping object exists, the triangles are cut off at the clipping area before they are stored or drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addVertices(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Vertex* vertices,
+                                std::size_t vertexCount, sf::PrimitiveType type);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a drawable object that can't be batched
+        ///
+        /// @param target    Render target to draw on
+        /// @param drawable  Object to draw
+        /// @param states    Render states to use for drawing
+        ///
+        /// The batch is flushed first so that the drawable ends up on top of everything that was drawn before it.
+        /// When a Clipping object exists, the drawable is cut off by the scissor rectangle that it set on the target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the counters of everything that was drawn since the last call to resetStatistics
+        ///
+        /// @return Amount of draw calls and vertices
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Statistics getStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the draw call and vertex counters back to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DRAW_BATCH_HPP
@@ -199,6 +199,22 @@ namespace tgui
         const sf::Glyph& getGlyph(std::uint32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset between the start of a character and the start of the next one
+        ///
+        /// @param codePoint     Unicode code point of the character
+        /// @param characterSize Size of the characters
+        /// @param bold          Retrieve the advance of the bold version or the regular one?
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /// This is the same as getGlyph(codePoint, characterSize, bold).advance, except that the value is cached so that measuring
+        /// text doesn't have to look up the glyph in the sf::Font again. The cache is shared by all objects that use the same font.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(std::uint32_t codePoint, unsigned int characterSize, bool bold) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the kerning offset of two glyphs
         ///
@@ -212,6 +228,8 @@ namespace tgui
         ///
         /// @return Kerning value for \a first and \a second, in pixels
         ///
+        /// The value is cached, so asking the kerning for the same pair again doesn't involve the sf::Font.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         float getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const;
 
@@ -229,11 +247,24 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct MetricsCache;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the cached metrics of the font, which are shared with all other Font objects that use the same sf::Font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MetricsCache& getMetricsCache() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         std::shared_ptr<sf::Font> m_font;
         std::string m_id;
+
+        mutable std::shared_ptr<MetricsCache> m_metricsCache;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
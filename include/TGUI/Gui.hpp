@@ -28,7 +28,9 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <queue>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -170,6 +172,183 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the widgets are drawn with as few draw calls as possible
+        ///
+        /// @param enabled  Should the geometry of the widgets be batched together?
+        ///
+        /// When enabled, the geometry of widgets that share a texture is collected and sent to the render target at once instead
+        /// of making a separate draw call for every background, border and image. Batching is disabled by default because custom
+        /// widgets that draw directly on the render target (instead of using DrawBatch) may then end up below batched geometry.
+        ///
+        /// @see DrawBatch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widgets are drawn with as few draw calls as possible
+        ///
+        /// @return Is draw batching enabled?
+        ///
+        /// @see setDrawBatchingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls and vertices that were needed during the last call to the draw function
+        ///
+        /// @return Statistics of the last frame
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const DrawBatch::Statistics& getDrawStatistics() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how long the draw function may spend on uploading images that were loaded in the background
+        ///
+        /// @param budget  Time per frame after which no more images are uploaded
+        ///
+        /// This only has an effect when async loading is enabled in the TextureManager. At least one image is uploaded per frame
+        /// when one is ready. The images are uploaded in updateTime, which is also called by draw.
+        /// The default budget is 4 milliseconds.
+        ///
+        /// @see TextureManager::setAsyncLoadingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTextureUploadBudget(sf::Time budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long the draw function may spend on uploading images that were loaded in the background
+        ///
+        /// @return Time per frame after which no more images are uploaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTextureUploadBudget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the gui keeps its last frame and only redraws the parts of it that changed
+        ///
+        /// @param enabled  Should the last frame be cached?
+        ///
+        /// When enabled, the widgets are drawn to an internal texture with the same size as the render target. Widgets tell the
+        /// gui which area they occupy when something about them changes (e.g. their position, text or hover state). On the next
+        /// call to draw, only those areas are redrawn in the texture and the texture is then drawn on the render target. When
+        /// nothing changed, the widgets aren't even looked at and drawing the gui only costs a single draw call.
+        ///
+        /// If you change a custom widget in a way that the gui can't know about then you should call its invalidate function.
+        ///
+        /// Frame caching is disabled by default.
+        ///
+        /// @see wasRedrawNeeded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFrameCachingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui keeps its last frame and only redraws the parts of it that changed
+        ///
+        /// @return Is frame caching enabled?
+        ///
+        /// @see setFrameCachingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isFrameCachingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether anything in the gui had to be redrawn during the last call to the draw function
+        ///
+        /// @return Did something change in the gui since the frame before the last one?
+        ///
+        /// This function also works when frame caching is disabled, even though all widgets are always drawn in that case.
+        ///
+        /// @see setFrameCachingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool wasRedrawNeeded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether something in the gui changed since the last call to the draw function
+        ///
+        /// @return Does the gui have to be drawn again?
+        ///
+        /// Together with getTimeUntilNextUpdate, this allows an application to only draw when something changes:
+        /// @code
+        /// while (window.isOpen())
+        /// {
+        ///     // Wait for events with a timeout of gui.getTimeUntilNextUpdate() and pass them to gui.handleEvent
+        ///     if (gui.updateTime())
+        ///     {
+        ///         window.clear();
+        ///         gui.draw();
+        ///         window.display();
+        ///     }
+        /// }
+        /// @endcode
+        ///
+        /// @see updateTime
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRedrawNeeded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it takes until the gui changes on its own
+        ///
+        /// @return Time until the next call to updateTime will change something in the gui
+        ///
+        /// Widgets can change without receiving any events, e.g. when an animation plays, when the caret of an edit box
+        /// blinks or when a tool tip appears. This function returns the time until the first of these changes, so that the
+        /// application can sleep until then instead of drawing the gui every frame. It returns sf::Time::Zero while an
+        /// animation is playing or when an image that was decoded in the background is ready to be uploaded, and the highest
+        /// value that sf::Time can hold when nothing is scheduled. While images are still being decoded, at most 10 milliseconds
+        /// are returned so that they get uploaded soon after they are ready. Apart from that, nothing is scheduled while the
+        /// window isn't focused, because time doesn't advance then.
+        ///
+        /// @see isRedrawNeeded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether layout changes are collected and only applied once before handling an event or drawing
+        ///
+        /// @param enabled  Should the layouts that depend on a changed widget only be recalculated when flushLayouts is called?
+        ///
+        /// Without batching, every change to a widget is immediately passed on to all layouts that refer to it. A single resize
+        /// can then move or resize the same widget several times when it depends on multiple widgets that change. When batching
+        /// is enabled, the dependent layouts are queued and all of them are recalculated together in flushLayouts, which is
+        /// called at the start of handleEvent and draw. Until then, widgets that depend on a changed widget keep their old
+        /// position and size.
+        ///
+        /// This setting is shared by all gui objects. Layout batching is disabled by default.
+        ///
+        /// @see Layout::setUpdatesDeferred
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLayoutBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether layout changes are collected and only applied once before handling an event or drawing
+        ///
+        /// @return Is layout batching enabled?
+        ///
+        /// @see setLayoutBatchingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLayoutBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates the layouts that were queued while layout batching is enabled
+        ///
+        /// Call this function when you need the positions and sizes of the widgets to be up-to-date before the next event or
+        /// draw call, e.g. to read the size of a widget right after resizing the widget that it depends on.
+        ///
+        /// @see setLayoutBatchingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushLayouts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -396,6 +575,47 @@ namespace tgui
         void saveWidgetsToStream(std::stringstream& stream) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a file that was saved with saveWidgetsToBinary
+        ///
+        /// @param filename  Filename of the binary widget file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromBinary(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the child widgets from a binary widget file that is stored in memory
+        ///
+        /// @param data  Pointer to the contents of the binary widget file (e.g. a memory-mapped file)
+        /// @param size  Amount of bytes in the data
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadWidgetsFromBinary(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the child widgets to a binary file
+        ///
+        /// @param filename  Filename of the binary widget file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveWidgetsToBinary(const std::string& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the widgets that depend on time with the time that passed since the last update
+        ///
+        /// @return Does the gui have to be drawn again?
+        ///
+        /// This function is called automatically by the draw function. You only need to call it yourself when you want to find
+        /// out whether the gui has to be drawn.
+        ///
+        /// @see isRedrawNeeded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         // Updates the internal clock to make animation possible. This function is called automatically by the draw function.
@@ -413,6 +633,18 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws all widgets on the given target, batching the geometry when enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Redraws the invalidated regions in the cached frame and then draws the cached frame on the render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCachedFrame();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -440,6 +672,17 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        bool m_drawBatchingEnabled = false;
+        DrawBatch::Statistics m_drawStatistics;
+
+        sf::Time m_textureUploadBudget = sf::milliseconds(4);
+        std::size_t m_finishedAsyncLoads = 0;
+
+        bool m_frameCachingEnabled = false;
+        bool m_fullRedrawNeeded = true;
+        bool m_redrawNeeded = true;
+        std::unique_ptr<sf::RenderTexture> m_frameCache;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
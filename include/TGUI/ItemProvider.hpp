@@ -0,0 +1,252 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_ITEM_PROVIDER_HPP
+#define TGUI_ITEM_PROVIDER_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Gives list widgets access to items that are stored outside of the widget
+    ///
+    /// Instead of copying every item into a ListBox or ComboBox with addItem, a class deriving from ItemProvider can be passed
+    /// to their setItemProvider function. The widget will then only ask for the items that it needs, e.g. the rows that are
+    /// visible on the screen. After changing the data, the provider has to call one of the notification functions
+    /// (itemsChanged, itemsInserted, itemsRemoved or itemsReset) so that the widgets that use it can update themselves.
+    ///
+    /// Example:
+    /// @code
+    /// class PriceProvider : public tgui::ItemProvider
+    /// {
+    /// public:
+    ///     std::size_t getItemCount() const override { return prices.size(); }
+    ///     sf::String getItem(std::size_t index) const override { return tgui::to_string(prices[index]); }
+    ///
+    ///     std::vector<float> prices;
+    /// };
+    ///
+    /// auto provider = std::make_shared<PriceProvider>();
+    /// listBox->setItemProvider(provider);
+    ///
+    /// provider->prices[5] = 10.5f;
+    /// provider->itemsChanged(5, 1);
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ItemProvider
+    {
+    public:
+
+        typedef std::shared_ptr<ItemProvider> Ptr; ///< Shared item provider pointer
+        typedef std::shared_ptr<const ItemProvider> ConstPtr; ///< Shared constant item provider pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Kind of change that is passed to the listeners
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class Change
+        {
+            Changed,  ///< The items in the range still exist but their text or id changed
+            Inserted, ///< New items were inserted, the range contains the indices of the new items
+            Removed,  ///< Items were removed, the range contains the indices that the items had before they were removed
+            Reset     ///< All items may have changed, the range covers all items that exist now
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function that is called when the items change, with the kind of change, the first index and the amount of items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        using Listener = std::function<void(Change change, std::size_t first, std::size_t count)>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemProvider() = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The listeners belong to a single provider, so a copy starts without them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemProvider(const ItemProvider&);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The listeners belong to a single provider, so they aren't copied
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemProvider& operator=(const ItemProvider&);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Virtual destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~ItemProvider();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of items
+        ///
+        /// @return Number of items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t getItemCount() const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text of an item
+        ///
+        /// @param index  Index of the item, always smaller than getItemCount()
+        ///
+        /// @return Text that is displayed for the item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::String getItem(std::size_t index) const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of an item
+        ///
+        /// @param index  Index of the item, always smaller than getItemCount()
+        ///
+        /// @return Id of the item, the default implementation returns an empty string
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::String getItemId(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the widgets that the text or id of some items changed
+        ///
+        /// @param first  Index of the first item that changed
+        /// @param count  Amount of items that changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsChanged(std::size_t first, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the widgets that items were inserted
+        ///
+        /// @param first  Index of the first new item
+        /// @param count  Amount of items that were inserted
+        ///
+        /// This function has to be called after the items were inserted, getItemCount() should already include them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsInserted(std::size_t first, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the widgets that items were removed
+        ///
+        /// @param first  Index that the first removed item had
+        /// @param count  Amount of items that were removed
+        ///
+        /// This function has to be called after the items were removed, getItemCount() should no longer include them.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsRemoved(std::size_t first, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the widgets that the items were replaced by a completely different list
+        ///
+        /// The widgets will lose their selection when this function is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemsReset();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a function that will be called when the items change
+        ///
+        /// @param listener  Function to call
+        ///
+        /// @return Id that can be passed to disconnect
+        ///
+        /// This function is used by the widgets, you only need it when writing your own widget that uses an item provider.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connect(const Listener& listener);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a function that was added with connect
+        ///
+        /// @param id  Id that was returned by connect
+        ///
+        /// @return True when the function was removed, false when there was no function with the given id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool disconnect(unsigned int id);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls all listeners
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notify(Change change, std::size_t first, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the disconnected listeners and adds the ones that were connected while notifying
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyPendingChanges();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct ListenerEntry
+        {
+            unsigned int id; // Id of the connection, or 0 when the listener was disconnected while notifying
+            Listener listener;
+        };
+
+        // Marks the provider as notifying for as long as it lives, in the same way as Signal::EmitGuard does for signals.
+        // The destructor of the provider marks the guard when a listener destroys the provider during the notification.
+        struct NotifyGuard
+        {
+            NotifyGuard(ItemProvider& notifyingProvider);
+            ~NotifyGuard();
+
+            NotifyGuard(const NotifyGuard&) = delete;
+            NotifyGuard& operator=(const NotifyGuard&) = delete;
+
+            ItemProvider& provider;
+            NotifyGuard* outerGuard;
+            bool providerDestroyed = false;
+            std::vector<ListenerEntry> orphanedListeners;
+        };
+
+        std::vector<ListenerEntry> m_listeners;
+        std::vector<ListenerEntry> m_listenersConnectedWhileNotifying;
+        NotifyGuard* m_notifyGuard = nullptr; // Innermost notification that is in progress
+        bool m_pendingChanges = false; // Were listeners connected or disconnected while notifying?
+        unsigned int m_lastListenerId = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ITEM_PROVIDER_HPP
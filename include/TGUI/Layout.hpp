@@ -192,10 +192,72 @@ namespace tgui
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Tells the layout that the position or size of the widget that it is bound to has changed
+        ///
+        /// The value is recalculated immediately, unless updates are deferred in which case the layout is queued until
+        /// flushDeferredUpdates is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void boundWidgetChanged();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether changes to widgets are immediately passed on to the layouts that depend on them
+        ///
+        /// @param deferred  Should layouts that depend on a changed widget be queued instead of being recalculated immediately?
+        ///
+        /// When a widget that other layouts depend on changes while updates are deferred, the layouts are only marked as dirty.
+        /// The widgets that use them keep their old position and size until flushDeferredUpdates is called. Disabling this
+        /// option will flush the layouts that are still queued. Updates are not deferred by default.
+        ///
+        /// @see Gui::setLayoutBatchingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setUpdatesDeferred(bool deferred);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether changes to widgets are queued instead of being passed on to the layouts immediately
+        ///
+        /// @return Are layout updates deferred?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool areUpdatesDeferred();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Recalculates all queued layouts and updates the widgets that use them
+        ///
+        /// The positions and sizes of the widgets form a graph, where a widget depends on every widget that its layouts refer to.
+        /// All widgets that are reachable from the queued layouts are updated in topological order, so that each of them
+        /// only has to be moved or resized once, after all widgets that it depends on got their final value.
+        ///
+        /// When the layouts depend on each other in a loop, a warning is printed and the widgets in the loop are updated only once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flushDeferredUpdates();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the value based on the operands or the bound widget, without informing the parent or connected widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calculates the values of the operands and then of the layout itself, without informing anyone about the changes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateValueRecursive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the layout and its operands from the queue of layouts that have to be recalculated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromQueueRecursive();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // If a widget is bound, inform it that the layout no longer binds it
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -232,6 +294,7 @@ namespace tgui
         Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
         std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
         std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        Widget* m_connectedWidget = nullptr; // Widget that uses this layout as its position or size, only set on the topmost layout
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -29,6 +29,8 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Config.hpp>
+#include <TGUI/ObjectConverter.hpp>
+#include <TGUI/Layout.hpp>
 #include <SFML/System/String.hpp>
 #include <sstream>
 #include <memory>
@@ -72,6 +74,11 @@ namespace tgui
             sf::String value;
             bool listNode = false;
             std::vector<sf::String> valueList;
+
+            // Values read from the binary format can already be parsed. Code that loads a property can use these members
+            // instead of parsing the string when they are set, the string is always available as well.
+            ObjectConverter parsedValue;             // Number, Color or Outline, or of type None when the value wasn't parsed
+            std::unique_ptr<Layout2d> parsedLayout;  // Value of a position or size property, or nullptr when it wasn't parsed
         };
 
 
@@ -86,6 +93,19 @@ namespace tgui
         static std::unique_ptr<Node> parse(std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that is stored in memory
+        ///
+        /// @param data  Pointer to the contents of the widget file (e.g. a memory-mapped file)
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data contains an error, the message includes the line on which the error was found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parse(const char* data, std::size_t size);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Emits the widget file
         ///
@@ -94,6 +114,45 @@ namespace tgui
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void emit(const std::unique_ptr<Node>& rootNode, std::stringstream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Parses a widget file that was stored in the binary format
+        ///
+        /// @param data  Pointer to the contents of the binary file (e.g. a memory-mapped file)
+        /// @param size  Amount of bytes in the data
+        ///
+        /// @return Root node of the tree of nodes
+        ///
+        /// @throw Exception when the data isn't a valid binary widget file or when its nodes are nested more than 256 levels deep
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::unique_ptr<Node> parseBinary(const char* data, std::size_t size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stores the tree of nodes in the binary format
+        ///
+        /// @param rootNode Root node of the tree of nodes that is to be converted
+        /// @param output   String to which the binary data will be added
+        ///
+        /// The binary format contains the same information as the text format, but all strings are stored only once in a
+        /// string table and list values are already split, so that loading doesn't have to tokenize any text.
+        /// Numbers, colors, outlines (borders and padding) and the layouts of positions and sizes are also stored in their
+        /// parsed form, which parseBinary places in the parsedValue and parsedLayout members of the value nodes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void emitBinary(const std::unique_ptr<Node>& rootNode, std::string& output);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Converts a widget file from the text format to the binary format
+        ///
+        /// @param text  Contents of the widget file in the text format
+        ///
+        /// @return Contents of the widget file in the binary format
+        ///
+        /// @throw Exception when the text could not be parsed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string convertToBinary(const std::string& text);
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
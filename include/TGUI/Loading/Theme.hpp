@@ -68,6 +68,26 @@ namespace tgui
         void load(const std::string& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Postpones updating the widgets when renderers of this theme change, until commitBatch is called
+        ///
+        /// While the batch is active, changes to the renderers (e.g. by calling load or setting properties on renderers that
+        /// are shared with the widgets) are only collected. When the batch is committed, every widget is told once about each
+        /// property that changed in its renderer, no matter how many times the property was changed.
+        ///
+        /// Batches can be nested, the widgets are only updated when the outermost batch is committed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Updates the widgets that use the renderers that were changed since beginBatch was called
+        ///
+        /// @throw Exception when a widget encounters an invalid property value
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void commitBatch();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -166,6 +186,7 @@ namespace tgui
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+        unsigned int m_batchDepth = 0; ///< Number of times beginBatch was called without a matching commitBatch
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
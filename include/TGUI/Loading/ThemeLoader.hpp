@@ -28,16 +28,21 @@
 
 
 #include <TGUI/Config.hpp>
+#include <TGUI/Loading/DataIO.hpp>
 #include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
 #include <memory>
 #include <string>
 #include <vector>
+#include <future>
 #include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    struct RendererData;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Base class for theme loader implementations
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -72,6 +77,20 @@ namespace tgui
         virtual const std::map<sf::String, sf::String>& load(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates renderer data containing the property-value pairs from the theme
+        ///
+        /// @param primary    Primary parameter of the loader
+        /// @param secondary  Secondary parameter of the loader
+        ///
+        /// The default implementation stores the values returned by load as strings. Nested sections are then only parsed
+        /// when the renderer of the subwidget is requested.
+        ///
+        /// @return Newly created renderer data
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::shared_ptr<RendererData> loadRenderer(const std::string& primary, const std::string& secondary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Check if the requested property-value pairs are available
         ///
@@ -96,11 +115,23 @@ namespace tgui
     /// This loader will be able to extract the data from these files.
     ///
     /// On first access, the entire file will be cached, the next times the cached map is simply returned.
+    /// The parsed sections are kept as well, so that nested sections can be turned into renderers without parsing them again.
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class TGUI_API DefaultThemeLoader : public BaseThemeLoader
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Time that was spent loading a theme file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct LoadTimings
+        {
+            sf::Time parseTime;         ///< Time spent reading and parsing the file and filling the cache
+            sf::Time imageDecodeTime;   ///< Time until all images referenced by the theme were decoded in the background
+            std::size_t images = 0;     ///< Amount of images that were decoded in the background for this theme
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the theme file in cache
         ///
@@ -136,11 +167,60 @@ namespace tgui
         bool canLoad(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates renderer data containing the property-value pairs from the theme file
+        ///
+        /// @param filename   Filename of the theme file
+        /// @param section    Name of the section inside the theme file
+        ///
+        /// Nested sections are directly created from the cached sections instead of being stored as strings.
+        ///
+        /// @return Newly created renderer data
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        /// @exception Exception when file did not contain requested class name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<RendererData> loadRenderer(const std::string& filename, const std::string& section) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the images that are used by a theme are decoded in the background when it is preloaded
+        ///
+        /// @param preload  Should preloading a theme file start decoding its images on worker threads?
+        ///
+        /// When enabled, all textures in the theme file are passed to TextureManager::preloadImages, so that decoding the images
+        /// of several themes happens concurrently and no longer when the first widget is created. This is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setImagePreloadingEnabled(bool preload);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the images that are used by a theme are decoded in the background when it is preloaded
+        ///
+        /// @return Are images preloaded?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isImagePreloadingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it took to load a theme file
+        ///
+        /// @param filename  Filename of the theme file
+        ///
+        /// If the images of the theme are still being decoded then this function waits until they are finished.
+        ///
+        /// @return Load timings of the theme, or all zeros when the file isn't in the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static LoadTimings getLoadTimings(const std::string& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
         /// @param filename  File to remove from cache.
         ///                  If no filename is given, the entire cache is cleared.
+        ///
+        /// Images that were preloaded for the removed themes but that weren't used by any texture yet are released.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static void flushCache(const std::string& filename = "");
 
@@ -160,7 +240,24 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
+
+        // Parsed theme file, kept so that renderers can be created from it without parsing the emitted sections again
+        struct CachedTheme
+        {
+            std::unique_ptr<DataIO::Node> root;
+            std::map<std::string, const DataIO::Node*> sections;
+            std::map<const DataIO::ValueNode*, const DataIO::Node*> references;
+            sf::Time parseTime;
+            std::vector<std::string> images;
+            std::shared_future<sf::Time> imageDecodeTime;
+        };
+
+        // Creates renderer data from a cached section, turning nested sections and references into renderers of their own
+        static std::shared_ptr<RendererData> createRendererData(const CachedTheme& cachedTheme, const DataIO::Node& node);
+
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
+        static std::map<std::string, CachedTheme> m_themeCache;
+        static bool m_imagePreloadingEnabled;
 
         friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
     };
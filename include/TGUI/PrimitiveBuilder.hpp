@@ -0,0 +1,138 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PRIMITIVE_BUILDER_HPP
+#define TGUI_PRIMITIVE_BUILDER_HPP
+
+#include <TGUI/Color.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/Outline.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Creates the vertices of simple shapes
+    ///
+    /// All functions append sf::Triangles to a vertex array that is owned by the caller, so that different shapes can be
+    /// combined in a single array and drawn with one call to DrawBatch::addVertices. Widgets keep the array as a member and
+    /// only rebuild it when something changes, clearing a vector keeps its memory so rebuilding doesn't allocate either.
+    ///
+    /// Angles are given in degrees, an angle of 0 points to the right and the angle increases in clockwise direction.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PrimitiveBuilder
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a filled rectangle
+        ///
+        /// @param vertices  Array to which the triangles are added
+        /// @param position  Position of the top left corner of the rectangle
+        /// @param size      Size of the rectangle
+        /// @param color     Color of the rectangle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addRectangle(std::vector<sf::Vertex>& vertices, Vector2f position, Vector2f size, const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds the borders around a rectangle
+        ///
+        /// @param vertices  Array to which the triangles are added
+        /// @param position  Position of the top left corner of the outside of the borders
+        /// @param size      Size of the rectangle, including the borders
+        /// @param borders   Thickness of the borders on each side
+        /// @param color     Color of the borders
+        ///
+        /// When the size is too small to fit both borders, the entire rectangle is filled with the border color.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addBorders(std::vector<sf::Vertex>& vertices, Vector2f position, Vector2f size, const Borders& borders, const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a triangle
+        ///
+        /// @param vertices  Array to which the triangle is added
+        /// @param point1    First corner of the triangle
+        /// @param point2    Second corner of the triangle
+        /// @param point3    Third corner of the triangle
+        /// @param color     Color of the triangle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addTriangle(std::vector<sf::Vertex>& vertices, Vector2f point1, Vector2f point2, Vector2f point3, const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a filled circle
+        ///
+        /// @param vertices    Array to which the triangles are added
+        /// @param center      Center of the circle
+        /// @param radius      Radius of the circle
+        /// @param color       Color of the circle
+        /// @param pointCount  Amount of points on the circumference, sf::CircleShape uses 30 by default
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addCircle(std::vector<sf::Vertex>& vertices, Vector2f center, float radius, const sf::Color& color, unsigned int pointCount = 30);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a ring, i.e. the outline of a circle
+        ///
+        /// @param vertices     Array to which the triangles are added
+        /// @param center       Center of the ring
+        /// @param innerRadius  Distance between the center and the inside of the ring
+        /// @param outerRadius  Distance between the center and the outside of the ring
+        /// @param color        Color of the ring
+        /// @param pointCount   Amount of points on each circumference
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addRing(std::vector<sf::Vertex>& vertices, Vector2f center, float innerRadius, float outerRadius, const sf::Color& color, unsigned int pointCount = 30);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a part of a ring
+        ///
+        /// @param vertices     Array to which the triangles are added
+        /// @param center       Center of the circle on which the arc lies
+        /// @param innerRadius  Distance between the center and the inside of the arc, 0 to create a pie slice
+        /// @param outerRadius  Distance between the center and the outside of the arc
+        /// @param startAngle   Angle at which the arc starts
+        /// @param endAngle     Angle at which the arc ends, the arc goes clockwise from the start angle to this angle
+        /// @param color        Color of the arc
+        /// @param pointCount   Amount of points that a full circle would have, the arc gets a proportional amount of them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addArc(std::vector<sf::Vertex>& vertices, Vector2f center, float innerRadius, float outerRadius,
+                           float startAngle, float endAngle, const sf::Color& color, unsigned int pointCount = 30);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PRIMITIVE_BUILDER_HPP
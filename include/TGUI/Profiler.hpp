@@ -0,0 +1,280 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_PROFILER_HPP
+#define TGUI_PROFILER_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifdef TGUI_ENABLE_PROFILER
+    /// Measures the time until the end of the current block, the arguments after the category are passed to Profiler::Scope::start
+    #define TGUI_PROFILE_SCOPE(category, ...) \
+        tgui::Profiler::Scope tguiProfilerScope{tgui::Profiler::Category::category}; \
+        if (tguiProfilerScope.isRecording()) \
+            tguiProfilerScope.start(__VA_ARGS__)
+
+    #define TGUI_PROFILE_CLIPPING() tgui::Profiler::addClippingScope()
+    #define TGUI_PROFILE_END_FRAME(drawStatistics) tgui::Profiler::endFrame(drawStatistics)
+#else
+    #define TGUI_PROFILE_SCOPE(category, ...) ((void)0)
+    #define TGUI_PROFILE_CLIPPING() ((void)0)
+    #define TGUI_PROFILE_END_FRAME(drawStatistics) ((void)0)
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Measures how much time the widgets spend in drawing, updating, handling events and recalculating their layout
+    ///
+    /// The measurements are only made when TGUI was build with the TGUI_ENABLE_PROFILER option, otherwise the instrumentation
+    /// isn't compiled in and the profiler never records anything. Even when it is compiled in, nothing is recorded until
+    /// setEnabled(true) is called.
+    ///
+    /// The gui ends a frame at the end of every call to Gui::draw. All measurements made since the previous frame are then
+    /// combined per widget and made available with getLastFrame, which can e.g. be displayed by an overlay inside the gui.
+    /// The individual measurements are also kept so that they can be saved in the trace event format that can be opened in
+    /// chrome://tracing.
+    ///
+    /// The profiler is meant to be used from the thread that handles the gui, only addAllocation can be called from any thread.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API Profiler
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief What was being done during a measurement
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        enum class Category
+        {
+            Draw,            ///< Widget::draw
+            Update,          ///< Widget::update
+            Event,           ///< Container::handleEvent, which includes the time spend in the widgets that receive the event
+            RendererChanged, ///< Widget::rendererChanged
+            Layout,          ///< Layout::recalculateValue
+            Text             ///< Text::recalculateSize
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Combined measurements of everything with the same category and label during a single frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct ScopeStatistics
+        {
+            Category category;       ///< What was being measured
+            std::string label;       ///< Widget type, followed by the widget name when it is known
+            std::size_t calls = 0;   ///< How many times it was measured during the frame
+            sf::Time time;           ///< Total time that was measured, which includes the time of nested measurements
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Everything that was measured during a single frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct FrameStatistics
+        {
+            std::size_t frame = 0;              ///< Number of the frame, counted since the profiler was enabled
+            sf::Time duration;                  ///< Time between the end of the previous frame and the end of this one
+            std::size_t drawCalls = 0;          ///< Draw calls made by Gui::draw
+            std::size_t vertices = 0;           ///< Vertices send to the render target by Gui::draw
+            std::size_t clippingScopes = 0;     ///< Amount of Clipping objects that were created
+            std::size_t allocations = 0;        ///< Amount of times addAllocation was called
+            std::vector<ScopeStatistics> scopes; ///< Combined measurements, sorted from the most to the least time spend
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Measures the time between the call to start and the destruction of the object
+        ///
+        /// This object is normally created with the TGUI_PROFILE_SCOPE macro, which only evaluates the label when recording.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API Scope
+        {
+        public:
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Constructor
+            ///
+            /// @param category  What is being measured
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            explicit Scope(Category category);
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Stores the measurement if start was called
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            ~Scope();
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Returns whether the profiler was enabled when the object was created
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            bool isRecording() const
+            {
+                return m_recording;
+            }
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts the measurement
+            ///
+            /// @param label  Name under which the measurement is stored, e.g. the widget type
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void start(const std::string& label);
+
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            /// @brief Starts the measurement
+            ///
+            /// @param type  Type of the widget that is being measured
+            /// @param name  Name of the widget or of the property that changed, ignored when empty
+            /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+            void start(const std::string& type, const sf::String& name);
+
+        private:
+            Category     m_category;
+            bool         m_recording;
+            bool         m_started = false;
+            std::int64_t m_startTime = 0;
+            std::string  m_label;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the instrumentation was compiled in (i.e. TGUI was build with TGUI_ENABLE_PROFILER)
+        ///
+        /// @return Can the profiler record anything?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAvailable();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts or stops recording
+        ///
+        /// @param enabled  Should the profiler start recording?
+        ///
+        /// Enabling the profiler clears all earlier recorded frames and trace events.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the profiler is recording
+        ///
+        /// @return Is the profiler enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Combines everything recorded since the previous frame into the statistics returned by getLastFrame
+        ///
+        /// @param drawStatistics  Draw calls and vertices that were send to the render target during the frame
+        ///
+        /// This function is called by Gui::draw, you only need to call it yourself when drawing widgets without a gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endFrame(const DrawBatch::Statistics& drawStatistics);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the statistics of the last frame that was ended
+        ///
+        /// @return Measurements of the last frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const FrameStatistics& getLastFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counts a Clipping object in the current frame
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addClippingScope();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counts a memory allocation in the current frame
+        ///
+        /// TGUI can't see the allocations itself. To count them, call this function from your replacement of operator new.
+        /// This function may be called from any thread and doesn't allocate memory itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addAllocation();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the maximum amount of measurements that are kept for the trace
+        ///
+        /// @param maxEvents  Amount of trace events after which new measurements are no longer stored
+        ///
+        /// The measurements are still added to the frame statistics once the limit has been reached. The default is 1000000.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMaxTraceEvents(std::size_t maxEvents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes all measurements that were recorded since the profiler was enabled in the chrome trace event format
+        ///
+        /// @param stream  Stream to write the json to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void writeTrace(std::ostream& stream);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves all measurements that were recorded since the profiler was enabled in the chrome trace event format
+        ///
+        /// @param filename  Json file to create, which can be opened in chrome://tracing
+        ///
+        /// @return True when the file was written, false when it could not be opened
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool saveTrace(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name that is used for a category in the trace
+        ///
+        /// @param category  Category to get the name of
+        ///
+        /// @return Name of the category, e.g. "draw"
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const char* getCategoryName(Category category);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROFILER_HPP
@@ -0,0 +1,287 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_PROPERTY_ID_HPP
+#define TGUI_PROPERTY_ID_HPP
+
+#include <TGUI/Config.hpp>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Names of the renderer properties that are used by the widgets in TGUI, X is called with the name of each property
+#define TGUI_BUILTIN_PROPERTY_IDS(X) \
+    X(ArrowBackgroundColor) \
+    X(ArrowBackgroundColorHover) \
+    X(ArrowColor) \
+    X(ArrowColorHover) \
+    X(BackgroundColor) \
+    X(BackgroundColorChecked) \
+    X(BackgroundColorCheckedDisabled) \
+    X(BackgroundColorCheckedHover) \
+    X(BackgroundColorDisabled) \
+    X(BackgroundColorDown) \
+    X(BackgroundColorFocused) \
+    X(BackgroundColorHover) \
+    X(BorderBelowTitleBar) \
+    X(BorderBetweenArrows) \
+    X(BorderColor) \
+    X(BorderColorChecked) \
+    X(BorderColorCheckedDisabled) \
+    X(BorderColorCheckedFocused) \
+    X(BorderColorCheckedHover) \
+    X(BorderColorDisabled) \
+    X(BorderColorDown) \
+    X(BorderColorFocused) \
+    X(BorderColorHover) \
+    X(Borders) \
+    X(Button) \
+    X(CaretColor) \
+    X(CaretColorFocused) \
+    X(CaretColorHover) \
+    X(CaretWidth) \
+    X(CheckColor) \
+    X(CheckColorDisabled) \
+    X(CheckColorHover) \
+    X(CloseButton) \
+    X(DefaultTextColor) \
+    X(DefaultTextStyle) \
+    X(DistanceToSide) \
+    X(FillColor) \
+    X(Font) \
+    X(ImageRotation) \
+    X(ListBox) \
+    X(MaximizeButton) \
+    X(MinimizeButton) \
+    X(MinimumResizableBorderWidth) \
+    X(Opacity) \
+    X(Padding) \
+    X(PaddingBetweenButtons) \
+    X(Scrollbar) \
+    X(ScrollbarWidth) \
+    X(SelectedBackgroundColor) \
+    X(SelectedBackgroundColorHover) \
+    X(SelectedTextBackgroundColor) \
+    X(SelectedTextColor) \
+    X(SelectedTextColorHover) \
+    X(SelectedTextStyle) \
+    X(SelectedTrackColor) \
+    X(SelectedTrackColorHover) \
+    X(ShowTextOnTitleButtons) \
+    X(SpaceBetweenWidgets) \
+    X(TextColor) \
+    X(TextColorChecked) \
+    X(TextColorCheckedDisabled) \
+    X(TextColorCheckedHover) \
+    X(TextColorDisabled) \
+    X(TextColorDown) \
+    X(TextColorFilled) \
+    X(TextColorFocused) \
+    X(TextColorHover) \
+    X(TextDistanceRatio) \
+    X(TextStyle) \
+    X(TextStyleChecked) \
+    X(TextStyleDisabled) \
+    X(TextStyleDown) \
+    X(TextStyleFocused) \
+    X(TextStyleHover) \
+    X(Texture) \
+    X(TextureArrow) \
+    X(TextureArrowDown) \
+    X(TextureArrowDownHover) \
+    X(TextureArrowHover) \
+    X(TextureArrowUp) \
+    X(TextureArrowUpHover) \
+    X(TextureBackground) \
+    X(TextureChecked) \
+    X(TextureCheckedDisabled) \
+    X(TextureCheckedFocused) \
+    X(TextureCheckedHover) \
+    X(TextureDisabled) \
+    X(TextureDisabledTab) \
+    X(TextureDown) \
+    X(TextureFill) \
+    X(TextureFocused) \
+    X(TextureForeground) \
+    X(TextureHover) \
+    X(TextureItemBackground) \
+    X(TextureSelectedItemBackground) \
+    X(TextureSelectedTab) \
+    X(TextureSelectedTabHover) \
+    X(TextureTab) \
+    X(TextureTabHover) \
+    X(TextureThumb) \
+    X(TextureThumbHover) \
+    X(TextureTitleBar) \
+    X(TextureTrack) \
+    X(TextureTrackHover) \
+    X(TextureUnchecked) \
+    X(TextureUncheckedDisabled) \
+    X(TextureUncheckedFocused) \
+    X(TextureUncheckedHover) \
+    X(ThumbColor) \
+    X(ThumbColorHover) \
+    X(TitleBarColor) \
+    X(TitleBarHeight) \
+    X(TitleColor) \
+    X(TrackColor) \
+    X(TrackColorHover) \
+    X(TransparentTexture)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Interned name of a renderer property
+    ///
+    /// Each distinct property name is stored only once and is identified by a small index, so that properties can be
+    /// stored in hash tables and compared without comparing strings. The properties that are used by the widgets in TGUI
+    /// are known in advance and are available as constants, e.g. PropertyId::BackgroundColor.
+    ///
+    /// A PropertyId can be constructed from any string, the name is stored as given. The renderers only use lowercase names.
+    /// Names are never released again, so the ids are only meant for property names and not for arbitrary strings.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API PropertyId
+    {
+    public:
+
+        /// Ids of the properties that are used by the widgets in TGUI. They are interned before any other name.
+        enum Builtin : std::uint32_t
+        {
+            #define TGUI_PROPERTY_ID_ENUM_VALUE(NAME) NAME,
+            TGUI_BUILTIN_PROPERTY_IDS(TGUI_PROPERTY_ID_ENUM_VALUE)
+            #undef TGUI_PROPERTY_ID_ENUM_VALUE
+            BuiltinCount
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id of one of the properties that are used by the widgets in TGUI
+        ///
+        /// @param id  Property to refer to
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr PropertyId(Builtin id) :
+            m_index{id}
+        {
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id of a property name, adding the name to the table when it wasn't seen before
+        ///
+        /// @param name  Name of the property, it is not converted to lowercase
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyId(const std::string& name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the id of a property name, adding the name to the table when it wasn't seen before
+        ///
+        /// @param name  Name of the property, it is not converted to lowercase
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        PropertyId(const char* name);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the property
+        ///
+        /// @return Name that was used to create the id, which stays valid for the lifetime of the program
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getName() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the name of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        operator const std::string&() const
+        {
+            return getName();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the property in the table of names
+        ///
+        /// @return Unique index of the property, built-in properties have an index below BuiltinCount
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        constexpr std::uint32_t getIndex() const
+        {
+            return m_index;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::uint32_t m_index;
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    inline bool operator==(PropertyId left, PropertyId right)
+    {
+        return left.getIndex() == right.getIndex();
+    }
+
+    inline bool operator!=(PropertyId left, PropertyId right)
+    {
+        return left.getIndex() != right.getIndex();
+    }
+
+    /// Orders the ids by the moment they were interned, use getName() when an alphabetical order is needed
+    inline bool operator<(PropertyId left, PropertyId right)
+    {
+        return left.getIndex() < right.getIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace std
+{
+    template <>
+    struct hash<tgui::PropertyId>
+    {
+        std::size_t operator()(tgui::PropertyId id) const
+        {
+            return std::hash<std::uint32_t>{}(id.getIndex());
+        }
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_PROPERTY_ID_HPP
@@ -29,7 +29,12 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/PropertyId.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <vector>
+#include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -45,7 +50,8 @@ namespace tgui
         static std::shared_ptr<RendererData> create(const std::map<std::string, ObjectConverter>& init = {})
         {
             auto data = std::make_shared<RendererData>();
-            data->propertyValuePairs = init;
+            for (const auto& pair : init)
+                data->propertyValuePairs[pair.first] = pair.second;
             return data;
         }
 
@@ -56,7 +62,13 @@ namespace tgui
             rendererData->shared = false;
 
             for (const auto& pair : rendererNode->propertyValuePairs)
-                rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
+            {
+                // Values that were loaded from a binary file may already have been parsed
+                if (pair.second->parsedValue.getType() != ObjectConverter::Type::None)
+                    rendererData->propertyValuePairs[pair.first] = pair.second->parsedValue;
+                else
+                    rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value); // Did not compile with VS2015 Update 2 when using braces
+            }
 
             for (const auto& nestedProperty : rendererNode->children)
             {
@@ -68,9 +80,60 @@ namespace tgui
             return rendererData;
         };
 
-        std::map<std::string, ObjectConverter> propertyValuePairs;
-        std::map<const void*, std::function<void(const std::string& property)>> observers;
+        /// @brief Postpones telling the observers about changed properties until commitBatch is called
+        ///
+        /// Batches can be nested, the observers are only notified when the outermost batch is committed.
+        void beginBatch()
+        {
+            ++batchDepth;
+        }
+
+        /// @brief Tells the observers about the properties that changed since beginBatch was called
+        ///
+        /// Each observer is told about each changed property only once, no matter how often the property was changed.
+        /// The properties are passed in alphabetical order.
+        void commitBatch()
+        {
+            if ((batchDepth == 0) || (--batchDepth > 0))
+                return;
+
+            std::vector<PropertyId> properties(changedProperties.begin(), changedProperties.end());
+            changedProperties.clear();
+            sortByName(properties);
+
+            for (const auto& observer : observers)
+            {
+                for (const auto& property : properties)
+                    observer.second(property);
+            }
+        }
+
+        /// @internal
+        /// @brief Tells the observers that a property changed, or remembers the property until the batch is committed
+        void notifyPropertyChanged(PropertyId property)
+        {
+            if (batchDepth > 0)
+                changedProperties.insert(property);
+            else
+            {
+                for (const auto& observer : observers)
+                    observer.second(property);
+            }
+        }
+
+        /// @internal
+        /// @brief Sorts property ids alphabetically, so that widgets are told about changes in a predictable order
+        static void sortByName(std::vector<PropertyId>& properties)
+        {
+            std::sort(properties.begin(), properties.end(),
+                      [](PropertyId left, PropertyId right){ return left.getName() < right.getName(); });
+        }
+
+        std::unordered_map<PropertyId, ObjectConverter> propertyValuePairs;
+        std::map<const void*, std::function<void(PropertyId property)>> observers;
         bool shared = true;
+        unsigned int batchDepth = 0; ///< Number of times beginBatch was called without a matching commitBatch
+        std::set<PropertyId> changedProperties; ///< Properties that were changed while a batch was active
     };
 
 
@@ -174,10 +237,39 @@ namespace tgui
         ///
         /// @throw Exception for unknown properties or when value was of a wrong type
         ///
+        /// When a batch was started on the renderer data (see RendererData::beginBatch), the widgets are only told about the
+        /// change when the batch is committed. An exception for an invalid property is then also only thrown at that moment.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void setProperty(const std::string& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param property  The property that you would like to change
+        /// @param value     The new value that you like to assign to the property
+        ///
+        /// @throw Exception for unknown properties or when value was of a wrong type
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(const char* property, ObjectConverter&& value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param property  Id of the property that you would like to change, its name should be lowercase
+        /// @param value     The new value that you like to assign to the property
+        ///
+        /// @throw Exception for unknown properties or when value was of a wrong type
+        ///
+        /// Unlike the function that takes a string, the name of the property isn't converted to lowercase.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(PropertyId property, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -190,13 +282,35 @@ namespace tgui
         ObjectConverter getProperty(const std::string& property) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the value of a certain property
+        ///
+        /// @param property  The property that you would like to retrieve
+        ///
+        /// @return The value of the property or an ObjectConverter object with type ObjectConverter::Type::None
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter getProperty(const char* property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves the value of a certain property
+        ///
+        /// @param property  Id of the property that you would like to retrieve, its name should be lowercase
+        ///
+        /// @return The value of the property or an ObjectConverter object with type ObjectConverter::Type::None
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter getProperty(PropertyId property) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets a map with all properties and their values
         ///
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        const std::unordered_map<PropertyId, ObjectConverter>& getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -206,7 +320,7 @@ namespace tgui
         /// @param function Callback function to call when the renderer changes
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void subscribe(const void* id, const std::function<void(const std::string& property)>& function);
+        void subscribe(const void* id, const std::function<void(PropertyId property)>& function);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,9 +34,9 @@
 #include <SFML/System/String.hpp>
 #include <functional>
 #include <typeindex>
+#include <cassert>
 #include <memory>
 #include <vector>
-#include <deque>
 #include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,7 @@ namespace tgui
 
     namespace internal_signal
     {
-        extern TGUI_API std::deque<const void*> parameters;
+        extern TGUI_API const void* parameters[3];
     }
 
 
@@ -64,20 +64,23 @@ namespace tgui
         using DelegateEx = std::function<void(std::shared_ptr<Widget>, const std::string&)>;
 
 
-        virtual ~Signal() = default;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~Signal();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
         /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param extraParameters  Amount of extra parameters that the signal passes to its handlers (at most 2)
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         Signal(std::string&& name, std::size_t extraParameters = 0) :
             m_name{std::move(name)}
         {
-            if (1 + extraParameters > internal_signal::parameters.size())
-                internal_signal::parameters.resize(1 + extraParameters);
+            (void)extraParameters;
+            assert(1 + extraParameters <= sizeof(internal_signal::parameters) / sizeof(internal_signal::parameters[0]));
         }
 
 
@@ -88,9 +91,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default move constructor
+        /// @brief Move constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(Signal&& other) = default;
+        Signal(Signal&& other);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -100,9 +103,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Default move assignment operator
+        /// @brief Move assignment operator
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& operator=(Signal&& other) = default;
+        Signal& operator=(Signal&& other);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -131,12 +134,16 @@ namespace tgui
         /// @param id  Unique id of the connection returned by the connect function
         ///
         /// @return True when a connection with this id existed and was removed
+        ///
+        /// This function may be called from inside a signal handler, even to disconnect the handler that is being executed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool disconnect(unsigned int id);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnect all signal handler from this signal
+        ///
+        /// This function may be called from inside a signal handler.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void disconnectAll();
 
@@ -147,6 +154,9 @@ namespace tgui
         /// @param widget  The sender of the signal
         ///
         /// @return True when at least one signal handler was called
+        ///
+        /// The handlers are allowed to connect and disconnect handlers of this signal and they may even destroy the widget
+        /// (and thus this signal). Handlers that are connected while emitting are only called from the next emit onwards.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget)
         {
@@ -155,10 +165,19 @@ namespace tgui
 
             internal_signal::parameters[0] = static_cast<const void*>(&widget);
 
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
+            // The handler list can't grow or shrink while emitting, so it is safe to call the handlers directly from it.
+            // The guard finds out when the signal is destroyed by one of the handlers, we must stop touching it in that case.
+            EmitGuard guard{*this};
+            const std::size_t handlerCount = m_handlers.size();
+            for (std::size_t i = 0; i < handlerCount; ++i)
+            {
+                if (m_handlers[i].id == 0)
+                    continue;
+
+                m_handlers[i].handler();
+                if (guard.signalDestroyed)
+                    break;
+            }
 
             return true;
         }
@@ -193,11 +212,74 @@ namespace tgui
         static std::shared_ptr<Widget> getWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Stores a new handler, or puts it aside when the signal is being emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int addHandler(std::function<void()>&& handler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Removes the disconnected handlers and adds the ones that were connected while the signal was being emitted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyPendingChanges();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        struct Handler
+        {
+            unsigned int id; ///< Id of the connection, or 0 when the handler was disconnected while emitting
+            std::function<void()> handler;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Marks the signal as being emitted for as long as it lives
+        ///
+        /// The guards of nested emits of the same signal form a chain on the stack, the destructor of the signal marks the
+        /// innermost one and the mark is passed on to the outer ones when they are unwound. The destructor also hands its
+        /// handlers to the outermost guard, so that the handlers that are still executing are only destroyed afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct EmitGuard
+        {
+            EmitGuard(Signal& emittingSignal) :
+                signal     (emittingSignal),
+                outerGuard (emittingSignal.m_emitGuard)
+            {
+                signal.m_emitGuard = this;
+            }
+
+            ~EmitGuard()
+            {
+                if (signalDestroyed)
+                {
+                    if (outerGuard)
+                        outerGuard->signalDestroyed = true;
+                    return;
+                }
+
+                signal.m_emitGuard = outerGuard;
+                if (!outerGuard && signal.m_pendingChanges)
+                    signal.applyPendingChanges();
+            }
+
+            EmitGuard(const EmitGuard&) = delete;
+            EmitGuard& operator=(const EmitGuard&) = delete;
+
+            Signal& signal;
+            EmitGuard* outerGuard;
+            bool signalDestroyed = false;
+            std::vector<Handler> orphanedHandlers;
+        };
+
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::vector<Handler> m_handlers;
+        std::vector<Handler> m_handlersConnectedWhileEmitting;
+        EmitGuard* m_emitGuard = nullptr; ///< Innermost emit that is in progress, or nullptr when the signal isn't being emitted
+        bool m_pendingChanges = false;    ///< Were handlers connected or disconnected while emitting?
     };
 
 #ifdef TGUI_REMOVE_DEPRECATED_CODE
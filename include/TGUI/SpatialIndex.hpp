@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_SPATIAL_INDEX_HPP
+#define TGUI_SPATIAL_INDEX_HPP
+
+#include <TGUI/Config.hpp>
+#include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Uniform grid that finds the widgets of which the bounds contain a given point
+    ///
+    /// This class is used by Container when its spatial index is enabled (see Container::setSpatialIndexEnabled).
+    /// The widgets are only identified by their address: their bounds and their z-order are provided by the container.
+    /// Every widget is stored in the cells that its bounds overlap, widgets that would cover too many cells are kept in a
+    /// separate list that is checked on every query.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API SpatialIndex
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param cellSize  Width and height of the cells in the grid
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit SpatialIndex(float cellSize = 64);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a widget to the index, or replaces its order and bounds if it was already added
+        ///
+        /// @param widget  Widget to add
+        /// @param order   Z-order of the widget, widgets with a higher value lie on top of widgets with a lower value
+        /// @param bounds  Area outside of which the widget can't be found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(Widget* widget, std::size_t order, const FloatRect& bounds);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the bounds of a widget that was already added, without changing its order
+        ///
+        /// @param widget  Widget that was previously added
+        /// @param bounds  New area outside of which the widget can't be found
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void update(Widget* widget, const FloatRect& bounds);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the z-order of a widget that was already added
+        ///
+        /// @param widget  Widget that was previously added
+        /// @param order   New z-order of the widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOrder(const Widget* widget, std::size_t order);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes a widget from the index
+        ///
+        /// @param widget  Widget to remove
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remove(const Widget* widget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all widgets from the index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the widget was added to the index
+        ///
+        /// @param widget  Widget to search for
+        ///
+        /// @return Is the widget part of the index?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool contains(const Widget* widget) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of widgets in the index
+        ///
+        /// @return Number of widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds the widgets of which the bounds contain a point
+        ///
+        /// @param point  Point to search for
+        ///
+        /// @return Widgets that contain the point, sorted from the top-most widget to the bottom-most one
+        ///
+        /// The returned list remains valid until the next call to this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Widget*>& query(Vector2f point) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Entry
+        {
+            std::size_t order = 0;
+            FloatRect bounds;
+
+            // Range of cells that contain the widget, only used when the widget isn't in the list of large widgets
+            bool large = false;
+            int left = 0;
+            int top = 0;
+            int right = 0;
+            int bottom = 0;
+        };
+
+        // Calculates the cells that the entry covers and stores the widget in them
+        void addToCells(Widget* widget, Entry& entry);
+
+        // Removes the widget from the cells in which it was stored
+        void removeFromCells(const Widget* widget, const Entry& entry);
+
+        // Calculates the cell that contains a coordinate. Returns false if the coordinate lies too far away from the origin.
+        bool getCell(float value, int& cell) const;
+
+        static std::uint64_t getCellKey(int x, int y);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        float m_cellSize;
+
+        std::unordered_map<const Widget*, Entry> m_entries;
+        std::unordered_map<std::uint64_t, std::vector<Widget*>> m_cells;
+        std::vector<Widget*> m_largeWidgets;
+
+        mutable std::vector<Widget*> m_queryResult;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_SPATIAL_INDEX_HPP
@@ -214,7 +214,13 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the location of the vertices
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateVertices();
+        void updateVertices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the position of the image inside the texture atlas page, or (0,0) when the image has its own texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2f getTexCoordsOffset() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,14 +228,16 @@ namespace tgui
 
         Vector2f    m_size;
         Texture     m_texture;
-        std::vector<sf::Vertex> m_vertices;
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable sf::Vector2f m_texCoordsOffset;
+        mutable bool m_verticesWaitingForTexture = false; // Vertices were calculated while the image was still loading
 
         FloatRect   m_visibleRect;
 
         Color       m_vertexColor = Color::White;
         float       m_opacity = 1;
 
-        ScalingType m_scalingType = ScalingType::Normal;
+        mutable ScalingType m_scalingType = ScalingType::Normal;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
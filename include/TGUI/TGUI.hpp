@@ -32,7 +32,11 @@
 #include <TGUI/Widget.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/PrimitiveBuilder.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/ItemProvider.hpp>
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/Serializer.hpp>
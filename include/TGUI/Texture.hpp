@@ -215,6 +215,8 @@ namespace tgui
         /// However if you want the texture to look exactly the same as its source file, you should leave it disabled.
         /// The smooth filter is disabled by default.
         ///
+        /// When the texture was put in the texture atlas, enabling the filter will give it a texture of its own.
+        ///
         /// @param smooth True to enable smoothing, false to disable it
         ///
         /// @see isSmooth
@@ -0,0 +1,146 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXTURE_ATLAS_HPP
+#define TGUI_TEXTURE_ATLAS_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Packs small images into a few large textures so that sprites using them can share a texture
+    ///
+    /// The images are placed on shelves: rows with the height of the first image that was put in them. An image is placed on
+    /// the lowest shelf that is high enough and still has room, or on a new shelf when none fits. A new page is created when
+    /// no page has room left. Space is only reclaimed when all images on a page are removed, at which point the page is freed.
+    ///
+    /// The TextureManager uses an atlas when it is enabled with TextureManager::setAtlasEnabled.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextureAtlas
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Location of an image inside the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Region
+        {
+            std::shared_ptr<sf::Texture> page; ///< Texture containing the image, nullptr when the region is empty
+            sf::Vector2u position;             ///< Position of the top-left pixel of the image inside the page
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param pageSize        Width and height of the textures in which the images are packed
+        /// @param maxImageSize    Images that are wider or higher than this are never added to the atlas
+        ///
+        /// The page size is lowered when the graphics card doesn't support textures of that size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextureAtlas(unsigned int pageSize = 1024, unsigned int maxImageSize = 256);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copies part of an image into the atlas
+        ///
+        /// @param image  Image containing the pixels to copy
+        /// @param rect   Part of the image to copy. Pass an empty rectangle to copy the whole image.
+        ///
+        /// @return Location of the copied pixels, or an empty region when the part is too large or doesn't lie inside the image
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Region add(const sf::Image& image, const sf::IntRect& rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the atlas that a region is no longer used
+        ///
+        /// @param region  Region that was returned by the add function
+        ///
+        /// The page is freed when none of its regions are still in use. Objects that still hold a pointer to the page keep it alive.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void remove(const Region& region);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of textures that the atlas currently consists of
+        ///
+        /// @return Number of pages
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getPageCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of video memory used by the pages
+        ///
+        /// @return Size of all pages in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getByteSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Shelf
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int usedWidth;
+        };
+
+        struct Page
+        {
+            std::shared_ptr<sf::Texture> texture;
+            std::vector<Shelf> shelves;
+            unsigned int usedHeight = 0;
+            std::size_t regions = 0;
+        };
+
+        // Finds room for a rectangle of the given size on the page, returns false when it doesn't fit
+        bool findRoom(Page& page, sf::Vector2u size, sf::Vector2u& position) const;
+
+        std::vector<Page> m_pages;
+        unsigned int m_pageSize;
+        unsigned int m_maxImageSize;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXTURE_ATLAS_HPP
@@ -35,6 +35,7 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Shader.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -42,15 +43,21 @@
 
 namespace tgui
 {
+    struct TextureDataHolder;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     // Used by the Texture class
     struct TGUI_API TextureData
     {
-        std::unique_ptr<sf::Image> image;
+        std::shared_ptr<sf::Image> image; // Shared between all parts of the same file that are loaded by the TextureManager
         sf::Texture texture;
         sf::IntRect rect;
         sf::Shader* shader = nullptr;
+        TextureDataHolder* holder = nullptr; // Entry in the TextureManager, nullptr when the data wasn't loaded by it
+        std::shared_ptr<sf::Texture> atlasPage; // Texture atlas page containing the pixels, the texture member is empty when set
+        sf::Vector2u atlasPosition; // Position of the image inside the atlas page
+        bool loading = false; // The image is still being decoded in the background, the data is empty until it is uploaded
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,6 +68,7 @@ namespace tgui
         std::shared_ptr<TextureData> data;
         std::string  filename;
         unsigned int users = 0;
+        std::size_t  bytes = 0; // Memory used by the texture, excluding the atlas page and the shared image
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
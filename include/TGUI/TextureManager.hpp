@@ -29,9 +29,15 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <TGUI/TextureAtlas.hpp>
+#include <TGUI/Signal.hpp>
+#include <TGUI/Color.hpp>
+#include <SFML/System/Time.hpp>
+#include <unordered_map>
 #include <memory>
-#include <list>
-#include <map>
+#include <string>
+#include <vector>
+#include <future>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -44,6 +50,22 @@ namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Counters about the textures that were requested and the images that are kept in memory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct Statistics
+        {
+            std::size_t hits = 0;           ///< Amount of times that getTexture could reuse an already loaded texture
+            std::size_t misses = 0;         ///< Amount of times that getTexture had to load an image
+            std::size_t textures = 0;       ///< Amount of textures that are currently loaded
+            std::size_t bytesResident = 0;  ///< Memory used by the loaded images and textures
+            std::size_t textureBytes = 0;   ///< Video memory used by the textures, including the texture atlas pages
+            std::size_t textureBytesWithoutAtlas = 0; ///< Video memory that the textures would use if none were in the atlas
+            std::size_t atlasPages = 0;     ///< Amount of textures of which the texture atlas consists
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -53,12 +75,42 @@ namespace tgui
         ///
         /// The second time you call this function with the same filename, the previously loaded image will be reused.
         ///
+        /// When the texture atlas is enabled and the image is small enough, the pixels are copied into the atlas instead of
+        /// being stored in their own texture.
+        ///
         /// @return Texture data when loaded successfully, nullptr otherwise
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         static std::shared_ptr<TextureData> getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect = sf::IntRect(0, 0, 0, 0));
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts decoding images on worker threads so that they are ready by the time a texture needs them
+        ///
+        /// @param filenames  Filenames of the images to decode
+        ///
+        /// The images are decoded concurrently by the image loader of the Texture class, on the same worker threads that are used
+        /// for async loading. There is one thread less than the amount of hardware threads, no matter how often this function
+        /// is called. Images that a texture is waiting for are decoded first. A custom image loader has to be thread-safe.
+        /// The function returns immediately. When getTexture requests an image that is still being decoded, it waits for it.
+        /// Images that are already loaded or already being decoded are skipped.
+        ///
+        /// @return Future containing the time it took until the last of the images was decoded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_future<sf::Time> preloadImages(const std::vector<std::string>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases images that were preloaded but that no texture has used yet
+        ///
+        /// @param filenames  Filenames that were passed to preloadImages
+        ///
+        /// Images that are still being decoded are released as soon as their worker thread finishes with them.
+        /// Images that are already used by a texture are not affected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removePreloadedImages(const std::vector<std::string>& filenames);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Shares the image with another texture
         ///
@@ -79,10 +131,210 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the hits and misses since the last call to resetStatistics and the memory that is currently used
+        ///
+        /// @return Texture manager statistics
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Statistics getStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the hit and miss counters back to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether small images are packed together in a texture atlas
+        ///
+        /// @param enabled  Should images that are loaded from now on be put in the atlas?
+        ///
+        /// Sprites that use textures from the same atlas page can be drawn with a single draw call when draw batching is enabled.
+        /// Changing this setting has no effect on textures that were already loaded. The atlas is disabled by default.
+        ///
+        /// Textures in the atlas are never smoothed. Calling setSmooth(true) on such a texture moves it to its own texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together in a texture atlas
+        ///
+        /// @return Is the texture atlas used for new textures?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gives texture data that is stored in the atlas its own texture
+        ///
+        /// @param textureData  The texture data that should no longer use the atlas
+        ///
+        /// This is used by Texture::setSmooth, as a texture in the atlas can't be smoothed without affecting its neighbours.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeFromAtlas(std::shared_ptr<TextureData> textureData);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images are decoded in the background instead of when the texture is loaded
+        ///
+        /// @param enabled  Should getTexture return immediately and leave the decoding to worker threads?
+        ///
+        /// When enabled, getTexture returns texture data that is still empty (its loading member is true) for images that aren't
+        /// loaded yet. The image is decoded on a worker thread and uploaded to the graphics card by processAsyncLoads, which the
+        /// gui calls from updateTime (and thus on every draw). Sprites draw a rectangle with the placeholder color until then.
+        /// The image loader of the Texture class has to be thread-safe when this is enabled.
+        ///
+        /// Widgets that take their size from the image (e.g. a Picture without a size) have a size of 0 until the image has
+        /// been loaded, so they should either be given a size or be resized when onAsyncLoadFinished is emitted.
+        /// The loading member of the texture data can be checked to find out whether a texture is ready.
+        ///
+        /// Async loading is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncLoadingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images are decoded in the background instead of when the texture is loaded
+        ///
+        /// @return Is async loading enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncLoadingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how many decoded images may wait to be uploaded
+        ///
+        /// @param capacity  Maximum amount of images that are being decoded or are waiting for processAsyncLoads
+        ///
+        /// The worker threads stop decoding when this amount is reached, which limits the memory used by images that were
+        /// decoded faster than they could be uploaded. The default capacity is 8.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncQueueCapacity(std::size_t capacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many decoded images may wait to be uploaded
+        ///
+        /// @return Maximum amount of images that are being decoded or are waiting for processAsyncLoads
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getAsyncQueueCapacity();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Uploads images that were decoded in the background
+        ///
+        /// @param budget  Time after which no more images are uploaded during this call
+        ///
+        /// At least one image is uploaded when one is available, even when it takes longer than the budget.
+        /// This function has to be called on the thread that draws the gui, which the gui already does in its updateTime function.
+        ///
+        /// @return Amount of images that were finished
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t processAsyncLoads(sf::Time budget);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that were requested in the background but aren't uploaded yet
+        ///
+        /// @return Amount of images that are still being loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getPendingAsyncLoads();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images were decoded in the background and are waiting for processAsyncLoads to upload them
+        ///
+        /// @return Can processAsyncLoads finish at least one image right now?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncLoadReady();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that were finished by processAsyncLoads since the program started
+        ///
+        /// @return Counter that increases every time an image was loaded in the background
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getFinishedAsyncLoadCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color that sprites are drawn with while their image is still being loaded
+        ///
+        /// @param color  Color of the placeholder
+        ///
+        /// The placeholder is transparent by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setPlaceholderColor(const Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color that sprites are drawn with while their image is still being loaded
+        ///
+        /// @return Color of the placeholder
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const Color& getPlaceholderColor();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        static Signal onAsyncLoadFinished; ///< An image that was loaded in the background is ready (or failed to load)
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the image of the texture data into the atlas or into its own texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool uploadImage(TextureData& data);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Shares the image with all other parts of the same file and counts its memory
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addImageUser(const std::string& filename, const std::shared_ptr<sf::Image>& image);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // The same image is only shared between textures that use the same part of it
+        struct TextureKey
+        {
+            std::string filename;
+            sf::IntRect partRect;
+
+            bool operator==(const TextureKey& other) const
+            {
+                return (filename == other.filename) && (partRect == other.partRect);
+            }
+        };
+
+        struct TextureKeyHash
+        {
+            std::size_t operator()(const TextureKey& key) const;
+        };
+
+        // Decoded image that is shared between all textures that use a part of the same file
+        struct ImageEntry
+        {
+            std::shared_ptr<sf::Image> image;
+            unsigned int users = 0;
+        };
+
+        static std::unordered_map<TextureKey, TextureDataHolder, TextureKeyHash> m_imageMap;
+        static std::unordered_map<std::string, ImageEntry> m_images;
+        static std::unordered_map<std::string, std::shared_future<std::shared_ptr<sf::Image>>> m_preloadedImages;
+        static Statistics m_statistics;
+        static TextureAtlas m_atlas;
+        static bool m_atlasEnabled;
+        static bool m_asyncLoadingEnabled;
+        static std::unordered_map<std::string, std::vector<std::shared_ptr<TextureData>>> m_asyncLoads;
+        static std::size_t m_finishedAsyncLoads;
+        static Color m_placeholderColor;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,9 +30,11 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Signal.hpp>
+#include <TGUI/Animation.hpp>
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Layout.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -59,12 +61,6 @@ namespace tgui
 {
     class Container;
 
-    enum class ShowAnimationType;
-    namespace priv
-    {
-        class Animation;
-    }
-
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief The parent class for every widget
@@ -273,13 +269,14 @@ namespace tgui
         ///
         /// @param type     Type of the animation
         /// @param duration Duration of the animation
+        /// @param easing   Curve that decides how fast the animation progresses over time
         ///
         /// @see hideWithEffect
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifdef TGUI_NEXT
-        void showWithEffect(ShowAnimationType type, sf::Time duration);
+        void showWithEffect(ShowAnimationType type, sf::Time duration, AnimationEasing easing = AnimationEasing::Linear);
 #else
-        virtual void showWithEffect(ShowAnimationType type, sf::Time duration);
+        virtual void showWithEffect(ShowAnimationType type, sf::Time duration, AnimationEasing easing = AnimationEasing::Linear);
 #endif
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -292,13 +289,14 @@ namespace tgui
         ///
         /// @param type     Type of the animation
         /// @param duration Duration of the animation
+        /// @param easing   Curve that decides how fast the animation progresses over time
         ///
         /// @see showWithEffect
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 #ifdef TGUI_NEXT
-        void hideWithEffect(ShowAnimationType type, sf::Time duration);
+        void hideWithEffect(ShowAnimationType type, sf::Time duration, AnimationEasing easing = AnimationEasing::Linear);
 #else
-        virtual void hideWithEffect(ShowAnimationType type, sf::Time duration);
+        virtual void hideWithEffect(ShowAnimationType type, sf::Time duration, AnimationEasing easing = AnimationEasing::Linear);
 #endif
 
 
@@ -413,6 +411,17 @@ namespace tgui
         virtual void moveToBack();
 #endif
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the gui that the area occupied by the widget has to be redrawn
+        ///
+        /// Widgets already call this function themselves when e.g. their position, size, text or renderer properties change.
+        /// You only need to call it yourself when the look of a custom widget changes without the gui knowing about it.
+        ///
+        /// @see Gui::setFrameCachingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Stores some data into the widget
         /// @param userData  Data to store
@@ -520,17 +529,51 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// This function is called every frame with the time passed since the last frame.
+        /// This function is called every frame with the time passed since the last frame, as long as isUpdateNeeded returns true.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns whether the widget still has something to do in its update function (e.g. a running animation).
+        ///
+        /// The gui only calls update on widgets that requested it with scheduleUpdates. After each update the widget stops
+        /// receiving updates once this function returns false. Widgets that override update have to override this function too.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool isUpdateNeeded() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns how long it takes until the update function will change something. This is only used when isUpdateNeeded
+        /// returns true. It returns sf::Time::Zero while the widget changes every frame (e.g. during an animation) and the
+        /// highest value that sf::Time can hold when the widget has nothing scheduled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time getTimeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         /// @return Is the mouse on top of the widget?
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(Vector2f pos) const = 0;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area (relative to the parent widget) outside of which mouseOnWidget never returns true
+        ///
+        /// Containers with a spatial index use this area to find out which widgets could be below the mouse. By default this is
+        /// the area of the widget including its borders. Widgets that react to the mouse outside that area have to override this
+        /// function and call invalidate() when the area changes.
+        ///
+        /// @return Area in which the mouse can be on top of the widget
+        ///
+        /// @see Container::setSpatialIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual FloatRect getHitTestBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -701,14 +744,35 @@ namespace tgui
         Signal& getSignal(std::string signalName) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Function called when one of the properties of the renderer is changed
+        ///
+        /// @param property  Id of the property that was changed
+        ///
+        /// The default implementation calls the version that takes the name of the property. The widgets in TGUI override this
+        /// function, so classes that derive from them should override it as well to handle their own properties.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererChanged(PropertyId property);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
         /// @param property  Lowercase name of the property that was changed
+        ///
+        /// This is only called for properties that weren't handled by the version of this function that takes a PropertyId.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void rendererChanged(const std::string& property);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Makes sure that the update function gets called every frame until isUpdateNeeded returns false
+        ///
+        /// Widgets have to call this when they start something that depends on time, like an animation or blinking caret.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void scheduleUpdates();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -758,7 +822,31 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Callback function which is called on a renderer change and which calls the virtual rendererChanged function
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChangedCallback(const std::string& property);
+        void rendererChangedCallback(PropertyId property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent that the widget occupied an area with the given position and full size that has to be redrawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateArea(Vector2f position, Vector2f fullSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts an animation after instantly finishing the running animation of the same type
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addAnimation(const priv::Animation& animation);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the position, size or opacity of the widget to the given value of an animation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void applyAnimationValue(priv::Animation::Type type, Vector2f value);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Jumps to the end of the animation and does what has to happen when the animation finishes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishAnimation(const priv::Animation& animation);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -821,8 +909,8 @@ namespace tgui
         // Renderer of the widget
         aurora::CopiedPtr<WidgetRenderer> m_renderer = aurora::makeCopied<WidgetRenderer>();
 
-        // Show animations
-        std::vector<std::shared_ptr<priv::Animation>> m_showAnimations;
+        // Show animations, stored by value so that updating them doesn't have to chase pointers
+        std::vector<priv::Animation> m_showAnimations;
 
         // Renderer properties that can be passed from containers to their children
         Font m_inheritedFont;
@@ -839,12 +927,13 @@ namespace tgui
         tgui::Any m_userData;
     #endif
 
-        std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
+        std::function<void(PropertyId property)> m_rendererChangedCallback = [this](PropertyId property){ rendererChangedCallback(property); };
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Layout; // Layout accesses m_position, m_size and the bound layouts when flushing deferred updates
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
 #include <deque>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -53,6 +54,8 @@ namespace tgui
         {
             Text text;
             sf::String string;
+            float height = 0;     // Height of the word wrapped text, or an estimate when the line wasn't wrapped yet
+            bool wrapped = false; // Has the text been word wrapped for the current width, font and text size?
         };
 
 
@@ -337,17 +340,55 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates all text attributes, recalculate the full text height and update the displayed text
+        // Marks all lines as needing to be word wrapped again and recalculates the full text height.
+        // Only the lines that are visible are wrapped immediately, the others are wrapped when they are scrolled into view.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateAllLines();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Recalculates the space used by all the lines and wraps the lines that are visible
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateFullTextHeight();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word wraps the lines inside the visible area that weren't wrapped yet.
+        // Returns true when the height of one of these lines changed, in which case the full text height has to be updated.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool wrapVisibleLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the height that a line is assumed to have before it is word wrapped
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float estimateLineHeight(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the prefix sums of the line heights from the heights stored in the lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildLineHeightIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a value to the height stored in a slot of the line height index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToLineHeightIndex(std::size_t slot, float heightDiff);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the distance between the top of the first line and the top of the given line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineTop(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the line that is located at the given distance below the top of the first line
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLineAt(float top) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Updates the position of the lines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -376,10 +417,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -426,6 +468,11 @@ namespace tgui
 
         std::deque<Line> m_lines;
 
+        // Binary indexed tree containing the heights of the lines, used to find the visible lines without iterating over all of them.
+        // Line i is stored in slot m_firstLineSlot + i, the slots before and after the lines have a height of 0.
+        std::vector<float> m_lineHeightIndex;
+        std::size_t m_firstLineSlot = 0;
+
         Sprite m_spriteBackground;
 
         // Cached renderer properties
@@ -360,6 +360,15 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseOnWidget(Vector2f pos) const override;
 
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area (relative to the parent widget) outside of which mouseOnWidget never returns true
+        ///
+        /// @return Area in which the mouse can be on top of the widget, including the extra area around resizable borders
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getHitTestBounds() const override;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -405,6 +414,12 @@ namespace tgui
         void updateTitleBarHeight();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the gui that the title bar has to be redrawn, e.g. because the mouse moved on top of one of its buttons
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateTitleBar();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves a signal based on its name
         ///
@@ -420,10 +435,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Container::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
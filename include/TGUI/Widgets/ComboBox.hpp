@@ -79,6 +79,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ComboBox& operator= (ComboBox&& other);
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ComboBox();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a new combo box widget
@@ -412,6 +417,30 @@ namespace tgui
         const std::vector<sf::String>& getItemIds() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the items of an item provider instead of the items that were added to the combo box
+        ///
+        /// @param provider  Object that gives access to the items, or nullptr to go back to storing the items in the combo box
+        ///
+        /// Only the items that are visible in the opened list are retrieved from the provider.
+        /// Any items that were added to the combo box before are removed when calling this function.
+        ///
+        /// While a provider is set, the functions that add, remove or change items do nothing and return false.
+        /// The items have to be changed in the provider instead, which then informs the combo box about the change.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemProvider(ItemProvider::Ptr provider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the item provider that was set with setItemProvider
+        ///
+        /// @return Item provider, or nullptr when the items are stored in the combo box itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemProvider::Ptr getItemProvider() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the maximum items that the combo box can contain
         ///
@@ -537,10 +566,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -585,6 +615,18 @@ namespace tgui
         void initListBox();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts listening to changes in the item provider of the list box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectItemProvider();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops listening to changes in the item provider of the list box
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnectItemProvider();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,6 +651,7 @@ namespace tgui
 
         // Internally a list box is used to store all items
         ListBox::Ptr m_listBox = ListBox::create();
+        unsigned int m_itemProviderListenerId = 0;
 
         Text m_text;
 
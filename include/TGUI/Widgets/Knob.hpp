@@ -292,10 +292,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,6 +323,12 @@ namespace tgui
         void recalculateRotation();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the vertices of the borders, background and thumb
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -359,6 +366,12 @@ namespace tgui
         Color   m_backgroundColorCached;
         Color   m_thumbColorCached;
         float   m_imageRotationCached = 0;
+
+        // The vertices of the borders, background and thumb are only rebuilt when the size, value or renderer changes
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable std::size_t m_backgroundVerticesStart = 0;
+        mutable std::size_t m_thumbVerticesStart = 0;
+        mutable bool m_verticesNeedUpdate = true;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
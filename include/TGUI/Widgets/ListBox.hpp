@@ -31,6 +31,8 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/ItemProvider.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -52,6 +54,31 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         ListBox();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBox(const ListBox& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBox(ListBox&& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBox& operator= (const ListBox& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ListBox& operator= (ListBox&& other);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~ListBox();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Creates a new list box widget
@@ -353,6 +380,52 @@ namespace tgui
         const std::vector<sf::String>& getItemIds() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the item name of the item at the given index
+        ///
+        /// @param index  The index of the item to return
+        ///
+        /// @return The requested item, or an empty string when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getItemByIndex(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of the item at the given index
+        ///
+        /// @param index  The index of the item to find
+        ///
+        /// @return The id of the requested item, or an empty string when the index was too high
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getIdByIndex(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the items of an item provider instead of the items that were added to the list box
+        ///
+        /// @param provider  Object that gives access to the items, or nullptr to go back to storing the items in the list box
+        ///
+        /// The list box only asks the provider for the items that it needs, so only the visible rows are retrieved when drawing.
+        /// Any items that were added to the list box before are removed when calling this function.
+        ///
+        /// While a provider is set, the functions that add, remove or change items do nothing and return false.
+        /// The items have to be changed in the provider instead, which then informs the list box about the change.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemProvider(ItemProvider::Ptr provider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the item provider that was set with setItemProvider
+        ///
+        /// @return Item provider, or nullptr when the items are stored in the list box itself
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemProvider::Ptr getItemProvider() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list box
         ///
@@ -520,10 +593,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -545,9 +619,51 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Returns the index of the first item with the given id, or -1 when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemIndexById(const sf::String& id) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first item with the given text, or -1 when there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemIndex(const sf::String& item) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts listening to changes in the item provider
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void connectItemProvider();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Stops listening to changes in the item provider
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void disconnectItemProvider();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called when the items of the item provider changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void itemProviderChanged(ItemProvider::Change change, std::size_t first, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the text objects exist for the items in the given range and that their contents are up-to-date
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the string, color, style and position of a text object to show the item with the given index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void initVisibleItem(Text& text, std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the text object of a single item if the item is currently visible
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedAndHoveringItemColorsAndStyle();
+        void updateVisibleItem(int index);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -574,6 +690,18 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether a double click is still possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateNeeded() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until a possible double click expires
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -595,9 +723,27 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        // This contains the different items in the list box
-        std::vector<Text>       m_items;
-        std::vector<sf::String> m_itemIds;
+        // This contains the different items in the list box, the strings are stored as UTF-8
+        std::vector<std::string> m_items;
+        std::vector<sf::String>  m_itemIds;
+
+        // Maps the ids to the index of the first item that has them. Only built when searching for an id.
+        struct IdHash
+        {
+            std::size_t operator()(const sf::String& id) const;
+        };
+        mutable std::unordered_map<sf::String, std::size_t, IdHash> m_idIndex;
+        mutable bool m_idIndexValid = false;
+
+        // Text objects of the items that are currently visible, the first one shows the item at m_firstVisibleItem
+        mutable std::vector<Text> m_visibleItems;
+        mutable std::size_t m_firstVisibleItem = 0;
+        mutable bool m_visibleItemsNeedUpdate = true;
+
+        // When an item provider is set, the items are retrieved from it and m_items and m_itemIds remain empty
+        ItemProvider::Ptr m_itemProvider;
+        unsigned int m_itemProviderListenerId = 0;
+        mutable std::vector<sf::String> m_itemProviderIds; // Only filled when calling getItemIds
 
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
@@ -213,6 +213,14 @@ namespace tgui
         void keyPressed(const sf::Event::KeyEvent& event) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the gui that the area occupied by the radio button has to be redrawn
+        ///
+        /// This also causes the circles to be rebuilt the next time the radio button is drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -241,10 +249,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using ClickableWidget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,6 +316,12 @@ namespace tgui
         void updateTextColor();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rebuilds the vertices of the circles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -369,6 +384,11 @@ namespace tgui
         Color     m_backgroundColorCheckedHoverCached;
         Color     m_backgroundColorCheckedDisabledCached;
         float     m_textDistanceRatioCached = 0.2f;
+
+        // Vertices of the borders, background and check. They are rebuilt when the look of the radio button changes.
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable std::size_t m_boxVerticesStart = 0;
+        mutable bool m_verticesNeedUpdate = true;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,10 +452,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -510,6 +511,11 @@ namespace tgui
         Sprite m_spriteSelectedTabHover;
         Sprite m_spriteDisabledTab;
 
+        // Copy of one of the above sprites that is resized to the tab being drawn. The index of the sprite that it was copied
+        // from is remembered so that the texture only has to be copied again when consecutive tabs use a different sprite.
+        mutable Sprite m_spriteDrawnTab;
+        mutable int m_spriteDrawnTabSource = -1;
+
         // Cached renderer properties
         Borders   m_bordersCached;
         Color     m_borderColorCached;
@@ -51,6 +51,28 @@ namespace tgui
         typedef std::shared_ptr<const TextBox> ConstPtr; ///< Shared constant widget pointer
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Part of the text that is separated from the rest by newline characters
+        struct Paragraph
+        {
+            std::size_t length = 0;    // Amount of characters, without the newline behind it
+            std::size_t lineCount = 0; // Amount of lines that the paragraph occupies after word wrapping
+        };
+
+        // Location of a paragraph, as found in the paragraph index
+        struct ParagraphPosition
+        {
+            std::size_t index = 0;     // Index of the paragraph in m_paragraphs
+            std::size_t textStart = 0; // Position of the first character of the paragraph in the text
+            std::size_t firstLine = 0; // Index of the first line of the paragraph in m_lines
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -358,16 +380,75 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text inside the text box (by using word wrap).
+        // Only the paragraphs that were passed to textChanged are wrapped again, unless the available width changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void rearrangeText(bool keepSelection);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Remembers which part of m_text was replaced, so that rearrangeText knows which paragraphs to wrap again.
+        // The characters between start and oldEnd were replaced by the characters that are now between start and newEnd.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textChanged(std::size_t start, std::size_t oldEnd, std::size_t newEnd);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Word wraps the paragraphs between the given positions in the text and adds them to the lines and paragraphs.
+        // The start position must be at the beginning of a paragraph and the end position at the end of a paragraph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapParagraphs(std::size_t start, std::size_t end, float maxLineWidth,
+                            std::vector<sf::String>& lines, std::vector<Paragraph>& paragraphs) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the prefix sums of the paragraph lengths and line counts from the paragraphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildParagraphIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the paragraph index after the length or line count of a paragraph changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateParagraphIndex(std::size_t paragraphIndex, const Paragraph& oldParagraph);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the paragraph that contains the character at the given position in the text (which can also be its newline)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ParagraphPosition findParagraphContainingCharacter(std::size_t textPos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the paragraph to which the given line belongs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ParagraphPosition findParagraphContainingLine(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Descends the paragraph index to find the amount of paragraphs for which the sum of the given member doesn't exceed
+        // the value. The result is limited to the last paragraph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ParagraphPosition findParagraph(std::size_t Paragraph::*member, std::size_t value) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts a position in the text to a position in the lines (x is the character in the line and y the line index)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2<std::size_t> findLinePosition(std::size_t textPos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Scrolls to the caret and updates the positions and the texts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function will split the visible part of the text into five pieces so that the text can be easily drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -393,6 +474,18 @@ namespace tgui
         void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the caret has to blink or a double click is still possible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isUpdateNeeded() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the caret blinks or a possible double click expires
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time getTimeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the positions of the contents of the text box.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -400,7 +493,7 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates which lines are currently visible.
+        // Recalculates which lines are currently visible and updates the texts when other lines became visible.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateVisibleLines();
 
@@ -420,10 +513,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(PropertyId property) override;
+        using Widget::rendererChanged;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -461,6 +555,18 @@ namespace tgui
         unsigned int m_lineHeight = 24;
 
         std::vector<sf::String> m_lines;
+        std::vector<Paragraph> m_paragraphs;
+
+        // Binary indexed tree over m_paragraphs. Every slot holds the amount of characters (including the newline behind them)
+        // and the amount of lines of the paragraphs that it covers, so that paragraphs can be found without walking over them.
+        std::vector<Paragraph> m_paragraphIndex;
+
+        // Which part of the text has to be word wrapped again, and with which width the lines were wrapped
+        std::size_t m_changedTextStart = sf::String::InvalidPos;
+        std::size_t m_changedTextOldEnd = 0;
+        std::size_t m_changedTextNewEnd = 0;
+        float m_wrappedLineWidth = 0;
+        bool m_rewrapAllLines = true;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -469,6 +575,11 @@ namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // The text objects only contain the lines that were visible when they were last updated
+        std::size_t m_visibleTextsTopLine = 0;
+        std::size_t m_visibleTextsLineCount = 0;
+        bool m_visibleTextsOutdated = true;
+
         // Information about the selection
         sf::Vector2<std::size_t> m_selStart;
         sf::Vector2<std::size_t> m_selEnd;
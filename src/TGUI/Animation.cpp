@@ -24,7 +24,7 @@
 
 
 #include <TGUI/Animation.hpp>
-#include <TGUI/Widget.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,126 +34,100 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        Animation::Type Animation::getType() const
+        Animation::Animation(Type type, Vector2f start, Vector2f end, sf::Time duration, AnimationEasing easing) :
+            m_type         {type},
+            m_start        {start},
+            m_end          {end},
+            m_totalDuration{duration},
+            m_easing       {easing}
         {
-            return m_type;
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        void Animation::finish()
-        {
-            if (m_finishedCallback != nullptr)
-                m_finishedCallback();
+            if (m_type == Type::Fade)
+            {
+                m_start.x = std::max(0.f, std::min(1.f, m_start.x));
+                m_end.x = std::max(0.f, std::min(1.f, m_end.x));
+            }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        Animation::Animation(Type type, Widget::Ptr widget, sf::Time duration, std::function<void()> finishedCallback) :
-            m_type            {type},
-            m_widget          {widget},
-            m_totalDuration   {duration},
-            m_finishedCallback{finishedCallback}
+        Animation::Type Animation::getType() const
         {
+            return m_type;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        MoveAnimation::MoveAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation {Type::Move, widget, duration, finishedCallback},
-            m_startPos{start},
-            m_endPos  {end}
+        bool Animation::update(sf::Time elapsedTime)
         {
+            m_elapsedTime += elapsedTime;
+            return m_elapsedTime >= m_totalDuration;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool MoveAnimation::update(sf::Time elapsedTime)
+        Vector2f Animation::getCurrentValue() const
         {
-            m_elapsedTime += elapsedTime;
             if (m_elapsedTime >= m_totalDuration)
-            {
-                finish();
-                return true;
-            }
+                return m_end;
 
-            m_widget->setPosition(m_startPos + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endPos - m_startPos)));
-            return false;
+            const float progress = ease(m_easing, m_elapsedTime.asSeconds() / m_totalDuration.asSeconds());
+            return m_start + (progress * (m_end - m_start));
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void MoveAnimation::finish()
+        Vector2f Animation::getStartValue() const
         {
-            m_widget->setPosition(m_endPos);
-            Animation::finish();
+            return m_start;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        ResizeAnimation::ResizeAnimation(Widget::Ptr widget, Vector2f start, Vector2f end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation  {Type::Resize, widget, duration, finishedCallback},
-            m_startSize{start},
-            m_endSize  {end}
+        Vector2f Animation::getEndValue() const
         {
+            return m_end;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        bool ResizeAnimation::update(sf::Time elapsedTime)
+        sf::Time Animation::getRemainingTime() const
         {
-            m_elapsedTime += elapsedTime;
             if (m_elapsedTime >= m_totalDuration)
-            {
-                finish();
-                return true;
-            }
-
-            m_widget->setSize(m_startSize + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endSize - m_startSize)));
-            return false;
+                return sf::Time::Zero;
+            else
+                return m_totalDuration - m_elapsedTime;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void ResizeAnimation::finish()
+        float Animation::ease(AnimationEasing easing, float progress)
         {
-            m_widget->setSize(m_endSize);
-            Animation::finish();
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        FadeAnimation::FadeAnimation(Widget::Ptr widget, float start, float end, sf::Time duration, std::function<void()> finishedCallback) :
-            Animation     {Type::Fade, widget, duration, finishedCallback},
-            m_startOpacity{std::max(0.f, std::min(1.f, start))},
-            m_endOpacity  {std::max(0.f, std::min(1.f, end))}
-        {
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-        bool FadeAnimation::update(sf::Time elapsedTime)
-        {
-            m_elapsedTime += elapsedTime;
-            if (m_elapsedTime >= m_totalDuration)
+            switch (easing)
             {
-                finish();
-                return true;
+                case AnimationEasing::EaseIn:
+                    return progress * progress * progress;
+                case AnimationEasing::EaseOut:
+                {
+                    const float inverse = 1 - progress;
+                    return 1 - (inverse * inverse * inverse);
+                }
+                case AnimationEasing::EaseInOut:
+                {
+                    if (progress < 0.5f)
+                        return 4 * progress * progress * progress;
+
+                    const float inverse = 2 - (2 * progress);
+                    return 1 - (inverse * inverse * inverse / 2);
+                }
+                case AnimationEasing::Linear:
+                    break;
             }
 
-            m_widget->setInheritedOpacity(m_startOpacity + ((m_elapsedTime.asSeconds() / m_totalDuration.asSeconds()) * (m_endOpacity - m_startOpacity)));
-            return false;
+            return progress;
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void FadeAnimation::finish()
-        {
-            m_widget->setInheritedOpacity(m_endOpacity);
-            Animation::finish();
-        }
-
-        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
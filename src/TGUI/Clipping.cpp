@@ -23,81 +23,91 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 
+
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <SFML/OpenGL.hpp>
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     sf::View Clipping::m_originalView;
+    FloatRect Clipping::m_guiViewRect;
+    std::vector<FloatRect> Clipping::m_clipRects;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) :
-        m_target {target},
-        m_oldView{target.getView()}
+        m_target{target}
     {
-        Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
-        topLeft = Vector2f(states.transform.transformPoint(topLeft));
+        TGUI_PROFILE_CLIPPING();
+
+        const FloatRect rect = states.transform.transformRect({topLeft, size});
+        const FloatRect& parentRect = getClipRect();
+
+        // Only keep the part that lies inside the parent clipping area
+        const float left = std::max(rect.left, parentRect.left);
+        const float top = std::max(rect.top, parentRect.top);
+        const float right = std::min(rect.left + rect.width, parentRect.left + parentRect.width);
+        const float bottom = std::min(rect.top + rect.height, parentRect.top + parentRect.height);
+        if ((right > left) && (bottom > top))
+            m_clipRects.push_back({left, top, right - left, bottom - top});
+        else // The clipping area lies outside the parent clipping area, nothing can be drawn
+            m_clipRects.push_back({left, top, 0, 0});
+
+        applyScissor(target);
+    }
 
-        Vector2f viewTopLeft = topLeft;
-        size = bottomRight - topLeft;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        topLeft.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        topLeft.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
-        bottomRight.x -= m_originalView.getCenter().x - (m_originalView.getSize().x / 2.f);
-        bottomRight.y -= m_originalView.getCenter().y - (m_originalView.getSize().y / 2.f);
+    Clipping::~Clipping()
+    {
+        m_clipRects.pop_back();
+        applyScissor(m_target);
+    }
 
-        topLeft.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        topLeft.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
-        size.x *= m_originalView.getViewport().width / m_originalView.getSize().x;
-        size.y *= m_originalView.getViewport().height / m_originalView.getSize().y;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        topLeft.x += m_originalView.getViewport().left;
-        topLeft.y += m_originalView.getViewport().top;
+    bool Clipping::isActive()
+    {
+        return !m_clipRects.empty();
+    }
 
-        if (topLeft.x < m_oldView.getViewport().left)
-        {
-            size.x -= m_oldView.getViewport().left - topLeft.x;
-            viewTopLeft.x += (m_oldView.getViewport().left - topLeft.x) * (m_originalView.getSize().x / m_originalView.getViewport().width);
-            topLeft.x = m_oldView.getViewport().left;
-        }
-        if (topLeft.y < m_oldView.getViewport().top)
-        {
-            size.y -= m_oldView.getViewport().top - topLeft.y;
-            viewTopLeft.y += (m_oldView.getViewport().top - topLeft.y) * (m_originalView.getSize().y / m_originalView.getViewport().height);
-            topLeft.y = m_oldView.getViewport().top;
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (size.x > m_oldView.getViewport().left + m_oldView.getViewport().width - topLeft.x)
-            size.x = m_oldView.getViewport().left + m_oldView.getViewport().width - topLeft.x;
-        if (size.y > m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y)
-            size.y = m_oldView.getViewport().top + m_oldView.getViewport().height - topLeft.y;
+    const FloatRect& Clipping::getClipRect()
+    {
+        if (m_clipRects.empty())
+            return m_guiViewRect;
+        else
+            return m_clipRects.back();
+    }
 
-        if ((size.x >= 0) && (size.y >= 0))
-        {
-            sf::View view{{std::round(viewTopLeft.x),
-                           std::round(viewTopLeft.y),
-                           std::round(size.x * m_originalView.getSize().x / m_originalView.getViewport().width),
-                           std::round(size.y * m_originalView.getSize().y / m_originalView.getViewport().height)}};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            view.setViewport({topLeft.x, topLeft.y, size.x, size.y});
-            target.setView(view);
-        }
-        else // The clipping area lies outside the viewport
-        {
-            sf::View emptyView{{0, 0, 0, 0}};
-            emptyView.setViewport({0, 0, 0, 0});
-            target.setView(emptyView);
-        }
+    bool Clipping::isRectVisible(const FloatRect& rect)
+    {
+        const FloatRect& clipRect = getClipRect();
+        return (rect.left < clipRect.left + clipRect.width) && (rect.left + rect.width > clipRect.left)
+            && (rect.top < clipRect.top + clipRect.height) && (rect.top + rect.height > clipRect.top);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Clipping::~Clipping()
+    void Clipping::setScissorTestEnabled(sf::RenderTarget& target, bool enabled)
     {
-        m_target.setView(m_oldView);
+        if (m_clipRects.empty() || (m_originalView.getRotation() != 0))
+            return;
+
+        target.setActive(true);
+        if (enabled)
+            glEnable(GL_SCISSOR_TEST);
+        else
+            glDisable(GL_SCISSOR_TEST);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,6 +115,49 @@ namespace tgui
     void Clipping::setGuiView(const sf::View& view)
     {
         m_originalView = view;
+
+        if (view.getRotation() == 0)
+            m_guiViewRect = {view.getCenter() - (view.getSize() / 2.f), view.getSize()};
+        else // Nothing is clipped or culled when the view is rotated
+        {
+            const float maxValue = std::numeric_limits<float>::max() / 4;
+            m_guiViewRect = {-maxValue, -maxValue, 2 * maxValue, 2 * maxValue};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Clipping::applyScissor(sf::RenderTarget& target)
+    {
+        // Nothing is clipped when the view is rotated, as the scissor rectangle can't be rotated
+        if (m_originalView.getRotation() != 0)
+            return;
+
+        target.setActive(true);
+        if (m_clipRects.empty())
+        {
+            glDisable(GL_SCISSOR_TEST);
+            return;
+        }
+
+        // Convert the clipping area to pixels. The area is rounded outwards, the geometry drawn through DrawBatch was already
+        // clipped precisely on the cpu and shouldn't lose a partially covered pixel at the edges.
+        const FloatRect& clipRect = m_clipRects.back();
+        const sf::IntRect viewport = target.getViewport(m_originalView);
+        const Vector2f viewTopLeft = m_originalView.getCenter() - (m_originalView.getSize() / 2.f);
+        const Vector2f scale = {viewport.width / m_originalView.getSize().x, viewport.height / m_originalView.getSize().y};
+
+        const int left = static_cast<int>(std::floor(viewport.left + (clipRect.left - viewTopLeft.x) * scale.x));
+        const int top = static_cast<int>(std::floor(viewport.top + (clipRect.top - viewTopLeft.y) * scale.y));
+        const int right = static_cast<int>(std::ceil(viewport.left + (clipRect.left + clipRect.width - viewTopLeft.x) * scale.x));
+        const int bottom = static_cast<int>(std::ceil(viewport.top + (clipRect.top + clipRect.height - viewTopLeft.y) * scale.y));
+
+        // OpenGL puts the origin in the bottom left corner of the target
+        glEnable(GL_SCISSOR_TEST);
+        if ((clipRect.width > 0) && (clipRect.height > 0))
+            glScissor(left, static_cast<GLint>(target.getSize().y) - bottom, right - left, bottom - top);
+        else
+            glScissor(0, 0, 0, 0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,10 +24,13 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/Clipping.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 
@@ -41,6 +44,15 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Events that are passed to a container end up in one of its children, which will then redraw only the area it occupies
+        void invalidateAfterEvent(Widget& widget)
+        {
+            if (!widget.isContainer())
+                widget.invalidate();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void getAllRenderers(std::map<RendererData*, std::vector<const Widget*>>& renderers, const Container* container)
         {
             for (const auto& child : container->getWidgets())
@@ -60,28 +72,37 @@ namespace tgui
 
         std::unique_ptr<DataIO::Node> saveRenderer(RendererData* renderer, const std::string& name)
         {
+            // The properties are stored in a hash table, sort them so that nested renderers are always saved in the same order
+            std::vector<PropertyId> properties;
+            properties.reserve(renderer->propertyValuePairs.size());
+            for (const auto& pair : renderer->propertyValuePairs)
+                properties.push_back(pair.first);
+            RendererData::sortByName(properties);
+
             auto node = std::make_unique<DataIO::Node>();
             node->name = name;
-            for (const auto& pair : renderer->propertyValuePairs)
+            for (const auto& property : properties)
             {
+                const ObjectConverter& value = renderer->propertyValuePairs.at(property);
+
                 // Skip "font = null"
-                if (pair.first == "font" && ObjectConverter{pair.second}.getString() == "null")
+                if (property == PropertyId::Font && ObjectConverter{value}.getString() == "null")
                     continue;
 
-                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                if (value.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
+                    std::stringstream ss{ObjectConverter{value}.getString()};
                     auto rendererRootNode = DataIO::parse(ss);
 
                     // If there are braces around the renderer string, then the child node is the one we need
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
                         rendererRootNode = std::move(rendererRootNode->children[0]);
 
-                    rendererRootNode->name = pair.first;
+                    rendererRootNode->name = property.getName();
                     node->children.push_back(std::move(rendererRootNode));
                 }
                 else
-                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(ObjectConverter{pair.second}.getString());
+                    node->propertyValuePairs[property.getName()] = std::make_unique<DataIO::ValueNode>(ObjectConverter{value}.getString());
             }
 
             return node;
@@ -102,6 +123,9 @@ namespace tgui
     Container::Container(const Container& other) :
         Widget{other}
     {
+        if (other.m_spatialIndex)
+            setSpatialIndexEnabled(true);
+
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             add(other.m_widgets[i]->clone(), other.m_widgetNames[i]);
@@ -110,17 +134,24 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(Container&& other) :
-        Widget                {std::move(other)},
-        m_widgets             {std::move(other.m_widgets)},
-        m_widgetNames         {std::move(other.m_widgetNames)},
-        m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
-        m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        Widget                      {std::move(other)},
+        m_widgets                   {std::move(other.m_widgets)},
+        m_widgetNames               {std::move(other.m_widgetNames)},
+        m_widgetBelowMouse          {std::move(other.m_widgetBelowMouse)},
+        m_focusedWidget             {std::move(other.m_focusedWidget)},
+        m_handingMouseReleased      {std::move(other.m_handingMouseReleased)},
+        m_spatialIndex              {std::move(other.m_spatialIndex)},
+        m_spatialIndexChangedWidgets{std::move(other.m_spatialIndexChangedWidgets)},
+        m_spatialIndexNextOrder     {std::move(other.m_spatialIndexNextOrder)},
+        m_spatialIndexNeedsRebuild  {std::move(other.m_spatialIndexNeedsRebuild)},
+        m_scheduledWidgets          {std::move(other.m_scheduledWidgets)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_scheduledWidgets = {};
+        other.invalidateNameIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,6 +179,7 @@ namespace tgui
 
             // Remove all the old widgets
             Container::removeAllWidgets();
+            setSpatialIndexEnabled(right.m_spatialIndex != nullptr);
 
             // Copy all the widgets
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
@@ -168,16 +200,24 @@ namespace tgui
         if (this != &right)
         {
             Widget::operator=(std::move(right));
-            m_widgets              = std::move(right.m_widgets);
-            m_widgetNames          = std::move(right.m_widgetNames);
-            m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
-            m_focusedWidget        = std::move(right.m_focusedWidget);
-            m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_widgets                    = std::move(right.m_widgets);
+            m_widgetNames                = std::move(right.m_widgetNames);
+            m_widgetBelowMouse           = std::move(right.m_widgetBelowMouse);
+            m_focusedWidget              = std::move(right.m_focusedWidget);
+            m_handingMouseReleased       = std::move(right.m_handingMouseReleased);
+            m_spatialIndex               = std::move(right.m_spatialIndex);
+            m_spatialIndexChangedWidgets = std::move(right.m_spatialIndexChangedWidgets);
+            m_spatialIndexNextOrder      = std::move(right.m_spatialIndexNextOrder);
+            m_spatialIndexNeedsRebuild   = std::move(right.m_spatialIndexNeedsRebuild);
+            m_scheduledWidgets           = std::move(right.m_scheduledWidgets);
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
             right.m_widgets = {};
+            right.m_scheduledWidgets = {};
+            right.invalidateNameIndex();
+            invalidateNameIndex();
         }
 
         return *this;
@@ -199,7 +239,7 @@ namespace tgui
             {
                 m_prevInnerSize = getInnerSize();
                 for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                    layout->boundWidgetChanged();
             }
         }
     }
@@ -213,32 +253,92 @@ namespace tgui
         widgetPtr->setParent(this);
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
+        addToNameIndex(widgetPtr, widgetName);
+
+        if (m_spatialIndex)
+            m_spatialIndex->insert(widgetPtr.get(), m_spatialIndexNextOrder++, widgetPtr->getHitTestBounds());
 
         if (m_fontCached != getGlobalFont())
             widgetPtr->setInheritedFont(m_fontCached);
 
         if (m_opacityCached < 1)
             widgetPtr->setInheritedOpacity(m_opacityCached);
+
+        if (widgetPtr->isUpdateNeeded())
+            scheduleChildUpdates(widgetPtr.get());
+
+        widgetPtr->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        if (!m_childNameIndexValid)
         {
-            if (m_widgetNames[i] == widgetName)
-                return m_widgets[i];
+            // Direct children are added in order and emplace never overwrites a name, so the first child with a name is stored
+            m_childNameIndex.clear();
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                m_childNameIndex.emplace(m_widgetNames[i], m_widgets[i]);
+
+            m_childNameIndexValid = true;
         }
 
-        for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
+        const auto childIt = m_childNameIndex.find(widgetName);
+        if (childIt != m_childNameIndex.end())
+            return childIt->second;
+
+        Widget::Ptr widget;
+        if (!widgetName.isEmpty())
         {
-            if (m_widgets[i]->isContainer())
+            const Container* root = getNameIndexRoot();
+            if (!root->m_descendantNameIndexValid)
             {
-                Widget::Ptr widget = std::static_pointer_cast<Container>(m_widgets[i])->get(widgetName);
-                if (widget != nullptr)
-                    return widget;
+                root->m_descendantNameIndex.clear();
+                for (std::size_t i = 0; i < root->m_widgets.size(); ++i)
+                    root->addToDescendantNameIndex(root->m_widgets[i], root->m_widgetNames[i]);
+
+                root->m_descendantNameIndexValid = true;
             }
+
+            // The table of the top-level container also contains widgets that aren't part of this container
+            bool multipleMatches = false;
+            const auto range = root->m_descendantNameIndex.equal_range(widgetName);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                const Container* parent = it->second->getParent();
+                while (parent && (parent != this))
+                    parent = parent->getParent();
+
+                if (!parent)
+                    continue;
+
+                if (widget)
+                {
+                    multipleMatches = true;
+                    break;
+                }
+
+                widget = it->second;
+            }
+
+            // When several widgets have the same name, the one that is found first when searching recursively is returned
+            if (multipleMatches)
+                widget = findWidgetRecursive(widgetName);
+        }
+        else // Widgets without a name aren't stored in the table of the top-level container
+            widget = findWidgetRecursive(widgetName);
+
+        if (widget)
+            return widget;
+
+        // The name could be a path to the widget, e.g. "Panel1.List2"
+        const std::size_t separatorPos = widgetName.find(".");
+        if (separatorPos != sf::String::InvalidPos)
+        {
+            const Widget::Ptr widget = get(widgetName.substring(0, separatorPos));
+            if (widget && widget->isContainer())
+                return std::static_pointer_cast<Container>(widget)->get(widgetName.substring(separatorPos + 1));
         }
 
         return nullptr;
@@ -267,9 +367,19 @@ namespace tgui
                 }
 
                 // Remove the widget
+                widget->invalidate();
                 widget->setParent(nullptr);
+                if (m_spatialIndex)
+                    m_spatialIndex->remove(widget.get());
+
+                const auto scheduledIt = std::find(m_scheduledWidgets.begin(), m_scheduledWidgets.end(), widget.get());
+                if (scheduledIt != m_scheduledWidgets.end())
+                    m_scheduledWidgets.erase(scheduledIt);
+
                 m_widgets.erase(m_widgets.begin() + i);
+                const sf::String name = m_widgetNames[i];
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                removeFromNameIndex(widget, name);
                 return true;
             }
         }
@@ -282,13 +392,28 @@ namespace tgui
     void Container::removeAllWidgets()
     {
         for (const auto& widget : m_widgets)
+        {
+            widget->invalidate();
             widget->setParent(nullptr);
+        }
+
+        const Container* root = getNameIndexRoot();
+        if (root->m_descendantNameIndexValid)
+        {
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                root->removeFromDescendantNameIndex(m_widgets[i], m_widgetNames[i]);
+        }
 
         m_widgets.clear();
         m_widgetNames.clear();
+        m_scheduledWidgets.clear();
+        m_childNameIndex.clear();
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+
+        if (m_spatialIndex)
+            resetSpatialIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,7 +424,28 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                const sf::String oldName = m_widgetNames[i];
                 m_widgetNames[i] = name;
+                updateChildNameIndex(oldName);
+                updateChildNameIndex(name);
+
+                const Container* root = getNameIndexRoot();
+                if (root->m_descendantNameIndexValid)
+                {
+                    const auto range = root->m_descendantNameIndex.equal_range(oldName);
+                    for (auto it = range.first; it != range.second; ++it)
+                    {
+                        if (it->second == widget)
+                        {
+                            root->m_descendantNameIndex.erase(it);
+                            break;
+                        }
+                    }
+
+                    if (!name.empty())
+                        root->m_descendantNameIndex.emplace(name, widget);
+                }
+
                 return true;
             }
         }
@@ -343,13 +489,21 @@ namespace tgui
 
     void Container::loadWidgetsFromFile(const std::string& filename)
     {
-        std::ifstream in{filename};
+        std::ifstream in{filename, std::ios::binary};
         if (!in.is_open())
             throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
 
-        std::stringstream stream;
-        stream << in.rdbuf();
-        loadWidgetsFromStream(stream);
+        // Read the file in one go and parse it directly from memory
+        in.seekg(0, std::ios::end);
+        const auto fileSize = in.tellg();
+        if (fileSize < 0)
+            throw Exception{"Failed to read '" + filename + "' to load the widgets from it."};
+
+        std::string contents(static_cast<std::size_t>(fileSize), '\0');
+        in.seekg(0, std::ios::beg);
+        in.read(&contents[0], static_cast<std::streamsize>(contents.size()));
+
+        loadWidgetsFromNodeTree(DataIO::parse(contents.data(), contents.size()));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -370,8 +524,13 @@ namespace tgui
 
     void Container::loadWidgetsFromStream(std::stringstream& stream)
     {
-        auto rootNode = DataIO::parse(stream);
+        loadWidgetsFromNodeTree(DataIO::parse(stream));
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromNodeTree(const std::unique_ptr<DataIO::Node>& rootNode)
+    {
         removeAllWidgets(); // The existing widgets will be replaced by the ones that will be loaded
 
         if (rootNode->propertyValuePairs.size() != 0)
@@ -417,6 +576,54 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::saveWidgetsToStream(std::stringstream& stream) const
+    {
+        DataIO::emit(saveWidgetsToNodeTree(), stream);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromBinary(const std::string& filename)
+    {
+        std::ifstream in{filename, std::ios::binary};
+        if (!in.is_open())
+            throw Exception{"Failed to open '" + filename + "' to load the widgets from it."};
+
+        in.seekg(0, std::ios::end);
+        const auto fileSize = in.tellg();
+        if (fileSize < 0)
+            throw Exception{"Failed to read '" + filename + "' to load the widgets from it."};
+
+        std::string contents(static_cast<std::size_t>(fileSize), '\0');
+        in.seekg(0, std::ios::beg);
+        in.read(&contents[0], static_cast<std::streamsize>(contents.size()));
+
+        loadWidgetsFromBinary(contents.data(), contents.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::loadWidgetsFromBinary(const char* data, std::size_t size)
+    {
+        loadWidgetsFromNodeTree(DataIO::parseBinary(data, size));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::saveWidgetsToBinary(const std::string& filename) const
+    {
+        std::string contents;
+        DataIO::emitBinary(saveWidgetsToNodeTree(), contents);
+
+        std::ofstream out{filename, std::ios::binary};
+        if (!out.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the widgets to it."};
+
+        out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> Container::saveWidgetsToNodeTree() const
     {
         auto node = std::make_unique<DataIO::Node>();
 
@@ -445,7 +652,7 @@ namespace tgui
         for (const auto& child : getWidgets())
             node->children.emplace_back(child->save(renderersMap));
 
-        DataIO::emit(node, stream);
+        return node;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -465,6 +672,10 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
             m_widgetNames.erase(m_widgetNames.begin() + i);
+            updateChildNameIndex(m_widgetNames.back());
+
+            if (m_spatialIndex)
+                m_spatialIndex->setOrder(widget.get(), m_spatialIndexNextOrder++);
             break;
         }
     }
@@ -488,12 +699,42 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
             m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+            updateChildNameIndex(name);
+
+            if (m_spatialIndex)
+                resetSpatialIndex();
             break;
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setSpatialIndexEnabled(bool enabled)
+    {
+        if (enabled == (m_spatialIndex != nullptr))
+            return;
+
+        if (enabled)
+        {
+            m_spatialIndex = std::make_unique<SpatialIndex>();
+            resetSpatialIndex();
+        }
+        else
+        {
+            m_spatialIndex = nullptr;
+            m_spatialIndexChangedWidgets.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isSpatialIndexEnabled() const
+    {
+        return m_spatialIndex != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::focusNextWidget()
     {
         // If the focused widget is a container then try to focus the next widget inside it
@@ -737,16 +978,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::rendererChanged(const std::string& property)
+    void Container::rendererChanged(PropertyId property)
     {
         Widget::rendererChanged(property);
 
-        if (property == "opacity")
+        if (property == PropertyId::Opacity)
         {
             for (std::size_t i = 0; i < m_widgets.size(); ++i)
                 m_widgets[i]->setInheritedOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             for (const auto& widget : m_widgets)
             {
@@ -801,12 +1042,31 @@ namespace tgui
     {
         Widget::update(elapsedTime);
 
-        // Loop through all widgets
-        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        // Only the widgets that asked for it are updated. The list is copied since updating a widget may change it, and the
+        // widgets are kept alive in case they are removed from the container by a widget that is updated before them.
+        std::vector<Widget::Ptr> scheduledWidgets;
+        scheduledWidgets.reserve(m_scheduledWidgets.size());
+        for (Widget* widget : m_scheduledWidgets)
+            scheduledWidgets.push_back(widget->shared_from_this());
+
+        for (const auto& widget : scheduledWidgets)
         {
+            if (widget->getParent() != this)
+                continue;
+
             // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                m_widgets[i]->update(elapsedTime);
+            if (widget->isVisible())
+            {
+                TGUI_PROFILE_SCOPE(Update, widget->getWidgetType());
+                widget->update(elapsedTime);
+            }
+
+            if (!widget->isUpdateNeeded())
+            {
+                const auto it = std::find(m_scheduledWidgets.begin(), m_scheduledWidgets.end(), widget.get());
+                if (it != m_scheduledWidgets.end())
+                    m_scheduledWidgets.erase(it);
+            }
         }
 
         m_animationTimeElapsed = {};
@@ -814,8 +1074,43 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::isUpdateNeeded() const
+    {
+        return Widget::isUpdateNeeded() || !m_scheduledWidgets.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Container::getTimeUntilNextUpdate() const
+    {
+        sf::Time time = Widget::getTimeUntilNextUpdate();
+        for (const Widget* widget : m_scheduledWidgets)
+        {
+            // Hidden widgets aren't updated, so they don't need to be waited for
+            if (widget->isVisible() && widget->isUpdateNeeded())
+                time = std::min(time, widget->getTimeUntilNextUpdate());
+        }
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::scheduleChildUpdates(Widget* child)
+    {
+        if (std::find(m_scheduledWidgets.begin(), m_scheduledWidgets.end(), child) != m_scheduledWidgets.end())
+            return;
+
+        m_scheduledWidgets.push_back(child);
+        scheduleUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
+        TGUI_PROFILE_SCOPE(Event, getWidgetType());
+
         // Check if a mouse button has moved
         if ((event.type == sf::Event::MouseMoved) || ((event.type == sf::Event::TouchMoved) && (event.touch.finger == 0)))
         {
@@ -835,6 +1130,7 @@ namespace tgui
                     if (widget->m_draggableWidget || widget->isContainer())
                     {
                         widget->mouseMoved(mousePos);
+                        invalidateAfterEvent(*widget);
                         return true;
                     }
                 }
@@ -846,6 +1142,7 @@ namespace tgui
             {
                 // Send the event to the widget
                 widget->mouseMoved(mousePos);
+                invalidateAfterEvent(*widget);
                 return true;
             }
 
@@ -878,11 +1175,13 @@ namespace tgui
                  || ((event.type == sf::Event::TouchBegan) && (event.touch.finger == 0)))
                 {
                     widget->leftMousePressed(mousePos);
+                    invalidateAfterEvent(*widget);
                     return true;
                 }
                 else if ((event.type == sf::Event::MouseButtonPressed) && (event.mouseButton.button == sf::Mouse::Right))
                 {
                     widget->rightMousePressed(mousePos);
+                    invalidateAfterEvent(*widget);
                     return true;
                 }
             }
@@ -911,7 +1210,10 @@ namespace tgui
             // Check if the mouse is on top of a widget
             Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mousePos);
             if (widgetBelowMouse != nullptr)
+            {
                 widgetBelowMouse->leftMouseReleased(mousePos);
+                invalidateAfterEvent(*widgetBelowMouse);
+            }
 
             // Tell all widgets that the mouse has gone up
             // But don't do this when leftMouseReleased was called on this container because
@@ -919,7 +1221,12 @@ namespace tgui
             if (!m_handingMouseReleased)
             {
                 for (auto& widget : m_widgets)
+                {
+                    if (widget->m_mouseDown)
+                        invalidateAfterEvent(*widget);
+
                     widget->mouseNoLongerDown();
+                }
             }
 
             if (widgetBelowMouse != nullptr)
@@ -945,6 +1252,7 @@ namespace tgui
 
                     // Tell the widget that the key was pressed
                     m_focusedWidget->keyPressed(event.key);
+                    invalidateAfterEvent(*m_focusedWidget);
                     return true;
                 }
             }
@@ -962,6 +1270,7 @@ namespace tgui
                 if (m_focusedWidget && m_focusedWidget->isFocused())
                 {
                     m_focusedWidget->textEntered(event.text.unicode);
+                    invalidateAfterEvent(*m_focusedWidget);
                     return true;
                 }
             }
@@ -975,7 +1284,13 @@ namespace tgui
             // Send the event to the widget below the mouse
             Widget::Ptr widget = mouseOnWhichWidget({static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
             if (widget != nullptr)
-                return widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
+            {
+                const bool scrolled = widget->mouseWheelScrolled(event.mouseWheelScroll.delta, {static_cast<float>(event.mouseWheelScroll.x), static_cast<float>(event.mouseWheelScroll.y)});
+                if (scrolled)
+                    invalidateAfterEvent(*widget);
+
+                return scrolled;
+            }
 
             return false;
         }
@@ -988,16 +1303,37 @@ namespace tgui
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        if (m_spatialIndex)
         {
-            if ((*it)->isVisible())
+            // Only check the widgets that could be below the mouse, starting with the one in front
+            updateSpatialIndex();
+            for (Widget* candidate : m_spatialIndex->query(mousePos))
             {
-                if ((*it)->mouseOnWidget(mousePos))
+                if (candidate->isVisible())
                 {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                    if (candidate->mouseOnWidget(mousePos))
+                    {
+                        if (candidate->isEnabled())
+                            widget = candidate->shared_from_this();
 
-                    break;
+                        break;
+                    }
+                }
+            }
+        }
+        else
+        {
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+            {
+                if ((*it)->isVisible())
+                {
+                    if ((*it)->mouseOnWidget(mousePos))
+                    {
+                        if ((*it)->isEnabled())
+                            widget = *it;
+
+                        break;
+                    }
                 }
             }
         }
@@ -1012,13 +1348,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::invalidateRegion(const FloatRect& region)
+    {
+        if (m_parent)
+            m_parent->invalidateRegion(region);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childHitTestBoundsChanged(Widget* child)
+    {
+        if (!m_spatialIndex || m_spatialIndexNeedsRebuild)
+            return;
+
+        m_spatialIndexChangedWidgets.push_back(child);
+
+        // The same widget may be added many times when nothing asks for the widget below the mouse (e.g. during an animation)
+        if (m_spatialIndexChangedWidgets.size() > m_widgets.size())
+            resetSpatialIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
         // Draw all widgets when they are visible
-        for (const auto& widget : m_widgets)
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (widget->isVisible())
-                widget->draw(*target, states);
+            const auto& widget = m_widgets[i];
+            if (!widget->isVisible())
+                continue;
+
+            // Skip widgets that lie completely outside the clipping area. Containers are always drawn as their children
+            // don't necessarily lie inside their bounds. The hit test bounds are used as they also contain the parts that
+            // some widgets draw outside their size (e.g. the open menu of a MenuBar).
+            if (!widget->isContainer() && !Clipping::isRectVisible(states.transform.transformRect(widget->getHitTestBounds())))
+                continue;
+
+            TGUI_PROFILE_SCOPE(Draw, widget->getWidgetType(), m_widgetNames[i]);
+            widget->draw(*target, states);
         }
     }
 
@@ -1074,6 +1442,192 @@ namespace tgui
         return true;
     }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::resetSpatialIndex()
+    {
+        m_spatialIndexNeedsRebuild = true;
+        m_spatialIndexChangedWidgets.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateSpatialIndex()
+    {
+        if (m_spatialIndexNeedsRebuild)
+        {
+            m_spatialIndex->clear();
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+                m_spatialIndex->insert(m_widgets[i].get(), i, m_widgets[i]->getHitTestBounds());
+
+            m_spatialIndexNextOrder = m_widgets.size();
+            m_spatialIndexNeedsRebuild = false;
+            return;
+        }
+
+        for (Widget* widget : m_spatialIndexChangedWidgets)
+        {
+            // The widget may have been removed from the container in the meantime
+            if (m_spatialIndex->contains(widget))
+                m_spatialIndex->update(widget, widget->getHitTestBounds());
+        }
+
+        m_spatialIndexChangedWidgets.clear();
+    }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToNameIndex(const Widget::Ptr& widget, const sf::String& name)
+    {
+        // The widget was added to the back, so it only becomes the first child with the name if there was none yet
+        if (m_childNameIndexValid)
+            m_childNameIndex.emplace(name, widget);
+
+        // A container that gets a parent uses the table of the top-level container from now on
+        if (widget->isContainer())
+        {
+            const auto container = std::static_pointer_cast<Container>(widget);
+            container->m_descendantNameIndex.clear();
+            container->m_descendantNameIndexValid = false;
+        }
+
+        const Container* root = getNameIndexRoot();
+        if (root->m_descendantNameIndexValid)
+            root->addToDescendantNameIndex(widget, name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromNameIndex(const Widget::Ptr& widget, const sf::String& name)
+    {
+        updateChildNameIndex(name);
+
+        const Container* root = getNameIndexRoot();
+        if (root->m_descendantNameIndexValid)
+            root->removeFromDescendantNameIndex(widget, name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateChildNameIndex(const sf::String& name) const
+    {
+        // The table will be filled in when it is needed
+        if (!m_childNameIndexValid)
+            return;
+
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgetNames[i] == name)
+            {
+                m_childNameIndex[name] = m_widgets[i];
+                return;
+            }
+        }
+
+        m_childNameIndex.erase(name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateNameIndex()
+    {
+        m_childNameIndex.clear();
+        m_childNameIndexValid = false;
+
+        const Container* root = getNameIndexRoot();
+        root->m_descendantNameIndex.clear();
+        root->m_descendantNameIndexValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Container* Container::getNameIndexRoot() const
+    {
+        const Container* root = this;
+        while (root->getParent())
+            root = root->getParent();
+
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::addToDescendantNameIndex(const Widget::Ptr& widget, const sf::String& name) const
+    {
+        if (!name.isEmpty())
+            m_descendantNameIndex.emplace(name, widget);
+
+        if (widget->isContainer())
+        {
+            const auto container = std::static_pointer_cast<Container>(widget);
+            for (std::size_t i = 0; i < container->m_widgets.size(); ++i)
+                addToDescendantNameIndex(container->m_widgets[i], container->m_widgetNames[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromDescendantNameIndex(const Widget::Ptr& widget, const sf::String& name) const
+    {
+        if (!name.isEmpty())
+        {
+            const auto range = m_descendantNameIndex.equal_range(name);
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == widget)
+                {
+                    m_descendantNameIndex.erase(it);
+                    break;
+                }
+            }
+        }
+
+        if (widget->isContainer())
+        {
+            const auto container = std::static_pointer_cast<Container>(widget);
+            for (std::size_t i = 0; i < container->m_widgets.size(); ++i)
+                removeFromDescendantNameIndex(container->m_widgets[i], container->m_widgetNames[i]);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget::Ptr Container::findWidgetRecursive(const sf::String& widgetName) const
+    {
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            if (m_widgetNames[i] == widgetName)
+                return m_widgets[i];
+        }
+
+        for (const auto& widget : m_widgets)
+        {
+            if (!widget->isContainer())
+                continue;
+
+            const Widget::Ptr foundWidget = std::static_pointer_cast<Container>(widget)->findWidgetRecursive(widgetName);
+            if (foundWidget)
+                return foundWidget;
+        }
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::NameHash::operator()(const sf::String& name) const
+    {
+        // FNV-1a hash over the UTF-32 characters
+        std::size_t hash = 2166136261u;
+        const sf::Uint32* data = name.getData();
+        for (std::size_t i = 0; i < name.getSize(); ++i)
+        {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1107,6 +1661,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidateRegion(const FloatRect& region)
+    {
+        if ((region.width <= 0) || (region.height <= 0))
+            return;
+
+        // Don't let the list grow when the gui isn't being drawn, a single region that contains everything is good enough then
+        if (m_invalidatedRegions.size() >= 64)
+        {
+            FloatRect& bounds = m_invalidatedRegions.front();
+            for (std::size_t i = 1; i < m_invalidatedRegions.size(); ++i)
+            {
+                const FloatRect& rect = m_invalidatedRegions[i];
+                const float right = std::max(bounds.left + bounds.width, rect.left + rect.width);
+                const float bottom = std::max(bounds.top + bounds.height, rect.top + rect.height);
+                bounds.left = std::min(bounds.left, rect.left);
+                bounds.top = std::min(bounds.top, rect.top);
+                bounds.width = right - bounds.left;
+                bounds.height = bottom - bounds.top;
+            }
+
+            m_invalidatedRegions.resize(1);
+        }
+
+        m_invalidatedRegions.push_back(region);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/CustomWidgetForBindings.hpp>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -114,6 +115,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool CustomWidgetForBindings::isUpdateNeeded() const
+    {
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time CustomWidgetForBindings::getTimeUntilNextUpdate() const
+    {
+        return sf::Time::Zero;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool CustomWidgetForBindings::mouseOnWidget(Vector2f pos) const
     {
         return implMouseOnWidget(pos);
@@ -121,6 +136,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect CustomWidgetForBindings::getHitTestBounds() const
+    {
+        const float maxValue = std::numeric_limits<float>::max() / 4;
+        return {-maxValue, -maxValue, 2 * maxValue, 2 * maxValue};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void CustomWidgetForBindings::leftMousePressed(Vector2f pos)
     {
         Widget::leftMousePressed(pos);
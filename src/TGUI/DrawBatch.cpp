@@ -0,0 +1,395 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/Clipping.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <vector>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct Bucket
+        {
+            const sf::Texture* texture = nullptr;
+            const sf::Shader* shader = nullptr;
+            sf::BlendMode blendMode;
+            std::vector<sf::Vertex> vertices;
+
+            // Bounding box of all vertices in the bucket
+            float left = 0;
+            float top = 0;
+            float right = 0;
+            float bottom = 0;
+        };
+
+        sf::RenderTarget* batchTarget = nullptr;
+
+        // Buckets are reused between frames to avoid reallocating the vertex storage, only the first usedBuckets are in use
+        std::vector<Bucket> buckets;
+        std::size_t usedBuckets = 0;
+
+        // Storage for transforming the vertices before they are copied into a bucket
+        std::vector<sf::Vertex> transformedVertices;
+
+        // Storage for the separate triangles, after they were clipped
+        std::vector<sf::Vertex> triangleVertices;
+
+        DrawBatch::Statistics statistics;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void drawDirectly(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Vertex* vertices,
+                          std::size_t vertexCount, sf::PrimitiveType type)
+        {
+            target.draw(vertices, vertexCount, type, states);
+
+            statistics.drawCalls++;
+            statistics.vertices += vertexCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::size_t getMinimumVertexCount(sf::PrimitiveType type)
+        {
+            if (type == sf::PrimitiveType::Points)
+                return 1;
+            else if ((type == sf::PrimitiveType::Lines) || (type == sf::PrimitiveType::LineStrip))
+                return 2;
+            else
+                return 3;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        sf::Vertex interpolateVertex(const sf::Vertex& first, const sf::Vertex& second, float ratio)
+        {
+            const auto interpolateComponent = [ratio](sf::Uint8 from, sf::Uint8 to)
+                { return static_cast<sf::Uint8>(from + (static_cast<float>(to) - from) * ratio + 0.5f); };
+
+            return {first.position + (second.position - first.position) * ratio,
+                    {interpolateComponent(first.color.r, second.color.r),
+                     interpolateComponent(first.color.g, second.color.g),
+                     interpolateComponent(first.color.b, second.color.b),
+                     interpolateComponent(first.color.a, second.color.a)},
+                    first.texCoords + (second.texCoords - first.texCoords) * ratio};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Removes the part of a convex polygon that lies on the wrong side of a horizontal or vertical line
+        std::size_t clipPolygonToLine(const sf::Vertex* input, std::size_t inputCount, sf::Vertex* output,
+                                      bool vertical, float bound, bool keepGreater)
+        {
+            std::size_t outputCount = 0;
+            for (std::size_t i = 0; i < inputCount; ++i)
+            {
+                const sf::Vertex& current = input[i];
+                const sf::Vertex& next = input[(i + 1) % inputCount];
+                const float currentValue = vertical ? current.position.x : current.position.y;
+                const float nextValue = vertical ? next.position.x : next.position.y;
+                const bool currentInside = keepGreater ? (currentValue >= bound) : (currentValue <= bound);
+                const bool nextInside = keepGreater ? (nextValue >= bound) : (nextValue <= bound);
+
+                if (currentInside)
+                    output[outputCount++] = current;
+                if (currentInside != nextInside)
+                    output[outputCount++] = interpolateVertex(current, next, (bound - currentValue) / (nextValue - currentValue));
+            }
+
+            return outputCount;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Adds the part of the triangle that lies inside the clipping rectangle to the output, as separate triangles
+        void addClippedTriangle(const sf::Vertex& v1, const sf::Vertex& v2, const sf::Vertex& v3, const FloatRect& clipRect,
+                                std::vector<sf::Vertex>& output)
+        {
+            const float clipRight = clipRect.left + clipRect.width;
+            const float clipBottom = clipRect.top + clipRect.height;
+            const float left = std::min({v1.position.x, v2.position.x, v3.position.x});
+            const float top = std::min({v1.position.y, v2.position.y, v3.position.y});
+            const float right = std::max({v1.position.x, v2.position.x, v3.position.x});
+            const float bottom = std::max({v1.position.y, v2.position.y, v3.position.y});
+
+            // Most triangles lie either completely inside or completely outside the clipping area
+            if ((right <= clipRect.left) || (left >= clipRight) || (bottom <= clipRect.top) || (top >= clipBottom))
+                return;
+
+            if ((left >= clipRect.left) && (right <= clipRight) && (top >= clipRect.top) && (bottom <= clipBottom))
+            {
+                output.push_back(v1);
+                output.push_back(v2);
+                output.push_back(v3);
+                return;
+            }
+
+            // Each of the 4 sides can add at most one extra corner to the polygon
+            sf::Vertex polygon[8] = {v1, v2, v3};
+            sf::Vertex clipped[8];
+            std::size_t count = 3;
+            count = clipPolygonToLine(polygon, count, clipped, true, clipRect.left, true);
+            count = clipPolygonToLine(clipped, count, polygon, true, clipRight, false);
+            count = clipPolygonToLine(polygon, count, clipped, false, clipRect.top, true);
+            count = clipPolygonToLine(clipped, count, polygon, false, clipBottom, false);
+
+            for (std::size_t i = 2; i < count; ++i)
+            {
+                output.push_back(polygon[0]);
+                output.push_back(polygon[i-1]);
+                output.push_back(polygon[i]);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Transforms the vertices and stores them as separate triangles in triangleVertices, clipped when a clipping area exists.
+        // Returns false when nothing remains to be drawn.
+        bool createTriangles(const sf::Transform& transform, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                             float& left, float& top, float& right, float& bottom)
+        {
+            transformedVertices.assign(vertices, vertices + vertexCount);
+            for (auto& vertex : transformedVertices)
+                vertex.position = transform.transformPoint(vertex.position);
+
+            triangleVertices.clear();
+            const bool clipping = Clipping::isActive();
+            const FloatRect& clipRect = Clipping::getClipRect();
+            const std::size_t step = (type == sf::PrimitiveType::Triangles) ? 3 : 1;
+            for (std::size_t i = 2; i < vertexCount; i += step)
+            {
+                const sf::Vertex& v1 = transformedVertices[i-2];
+                const sf::Vertex& v2 = transformedVertices[i-1];
+                const sf::Vertex& v3 = transformedVertices[i];
+                if (clipping)
+                    addClippedTriangle(v1, v2, v3, clipRect, triangleVertices);
+                else
+                {
+                    triangleVertices.push_back(v1);
+                    triangleVertices.push_back(v2);
+                    triangleVertices.push_back(v3);
+                }
+            }
+
+            if (triangleVertices.empty())
+                return false;
+
+            left = right = triangleVertices[0].position.x;
+            top = bottom = triangleVertices[0].position.y;
+            for (const auto& vertex : triangleVertices)
+            {
+                left = std::min(left, vertex.position.x);
+                top = std::min(top, vertex.position.y);
+                right = std::max(right, vertex.position.x);
+                bottom = std::max(bottom, vertex.position.y);
+            }
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool bucketMatchesStates(const Bucket& bucket, const sf::RenderStates& states)
+        {
+            return (bucket.texture == states.texture) && (bucket.shader == states.shader) && (bucket.blendMode == states.blendMode);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::begin(sf::RenderTarget& target)
+    {
+        flush();
+        batchTarget = &target;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::end()
+    {
+        flush();
+        batchTarget = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DrawBatch::isActive()
+    {
+        return batchTarget != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::flush()
+    {
+        if (!batchTarget || (usedBuckets == 0))
+            return;
+
+        // The geometry was already clipped on the cpu, possibly by clipping areas that no longer exist,
+        // so it must not be cut off by the scissor rectangle of the current clipping area
+        Clipping::setScissorTestEnabled(*batchTarget, false);
+
+        for (std::size_t i = 0; i < usedBuckets; ++i)
+        {
+            Bucket& bucket = buckets[i];
+
+            sf::RenderStates states;
+            states.texture = bucket.texture;
+            states.shader = bucket.shader;
+            states.blendMode = bucket.blendMode;
+            drawDirectly(*batchTarget, states, bucket.vertices.data(), bucket.vertices.size(), sf::PrimitiveType::Triangles);
+
+            bucket.vertices.clear();
+        }
+
+        usedBuckets = 0;
+        Clipping::setScissorTestEnabled(*batchTarget, true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::addVertices(sf::RenderTarget& target, const sf::RenderStates& states, const sf::Vertex* vertices,
+                                std::size_t vertexCount, sf::PrimitiveType type)
+    {
+        if (vertexCount < getMinimumVertexCount(type))
+            return;
+
+        if ((type != sf::PrimitiveType::Triangles) && (type != sf::PrimitiveType::TrianglesStrip))
+        {
+            // Only triangles are clipped on the cpu, other primitives are cut off by the scissor rectangle of the clipping area
+            flush();
+            if (!Clipping::isActive() || ((Clipping::getClipRect().width > 0) && (Clipping::getClipRect().height > 0)))
+                drawDirectly(target, states, vertices, vertexCount, type);
+            return;
+        }
+
+        if ((batchTarget != &target) && !Clipping::isActive())
+        {
+            flush();
+            drawDirectly(target, states, vertices, vertexCount, type);
+            return;
+        }
+
+        // Transform the vertices upfront so that geometry with different transformations can share a draw call
+        float left;
+        float top;
+        float right;
+        float bottom;
+        if (!createTriangles(states.transform, vertices, vertexCount, type, left, top, right, bottom))
+            return;
+
+        if (batchTarget != &target)
+        {
+            flush();
+
+            sf::RenderStates clippedStates = states;
+            clippedStates.transform = sf::Transform::Identity;
+            drawDirectly(target, clippedStates, triangleVertices.data(), triangleVertices.size(), sf::PrimitiveType::Triangles);
+            return;
+        }
+
+        // Search for a bucket with the same states, as long as the geometry doesn't overlap with anything that was added later
+        Bucket* bucket = nullptr;
+        for (std::size_t i = usedBuckets; i > 0; --i)
+        {
+            Bucket& candidate = buckets[i-1];
+            if (bucketMatchesStates(candidate, states))
+            {
+                bucket = &candidate;
+                break;
+            }
+
+            if ((left < candidate.right) && (right > candidate.left) && (top < candidate.bottom) && (bottom > candidate.top))
+                break;
+        }
+
+        if (bucket)
+        {
+            bucket->left = std::min(bucket->left, left);
+            bucket->top = std::min(bucket->top, top);
+            bucket->right = std::max(bucket->right, right);
+            bucket->bottom = std::max(bucket->bottom, bottom);
+        }
+        else
+        {
+            if (usedBuckets == buckets.size())
+                buckets.emplace_back();
+
+            bucket = &buckets[usedBuckets++];
+            bucket->texture = states.texture;
+            bucket->shader = states.shader;
+            bucket->blendMode = states.blendMode;
+            bucket->left = left;
+            bucket->top = top;
+            bucket->right = right;
+            bucket->bottom = bottom;
+        }
+
+        bucket->vertices.insert(bucket->vertices.end(), triangleVertices.begin(), triangleVertices.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        if (batchTarget == &target)
+            flush();
+
+        // The drawable can't be clipped on the cpu, it is cut off by the scissor rectangle of the clipping area instead
+        if (Clipping::isActive())
+        {
+            const FloatRect& clipRect = Clipping::getClipRect();
+            if ((clipRect.width <= 0) || (clipRect.height <= 0))
+                return;
+        }
+
+        target.draw(drawable, states);
+
+        statistics.drawCalls++;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DrawBatch::Statistics DrawBatch::getStatistics()
+    {
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::resetStatistics()
+    {
+        statistics = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,13 +26,76 @@
 #include <TGUI/Font.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
+#include <unordered_map>
+#include <array>
 #include <cassert>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Metrics that are stored when they are requested for the first time. NaN is used for values that weren't requested yet.
+        const float notCached = std::numeric_limits<float>::quiet_NaN();
+
+        // Advances of the Latin-1 characters and kerning of the ASCII pairs are stored in arrays, other values in hash maps
+        const std::uint32_t advanceArraySize = 256;
+        const std::uint32_t kerningArraySize = 128;
+
+        struct CharacterSizeMetrics
+        {
+            CharacterSizeMetrics()
+            {
+                advances[0].fill(notCached);
+                advances[1].fill(notCached);
+            }
+
+            float lineSpacing = notCached;
+
+            // Index 0 contains the regular advances, index 1 the bold ones
+            std::array<std::array<float, advanceArraySize>, 2> advances;
+            std::array<std::unordered_map<std::uint32_t, float>, 2> otherAdvances;
+
+            // The kerning array is only allocated once kerning is requested for this character size
+            std::vector<float> kerning;
+            std::unordered_map<std::uint64_t, float> otherKerning;
+        };
+    }
+
+    struct Font::MetricsCache
+    {
+        CharacterSizeMetrics& get(unsigned int characterSize)
+        {
+            // Consecutive requests are almost always for the same character size
+            if (lastMetrics && (lastCharacterSize == characterSize))
+                return *lastMetrics;
+
+            lastCharacterSize = characterSize;
+            lastMetrics = &characterSizes[characterSize];
+            return *lastMetrics;
+        }
+
+        std::unordered_map<unsigned int, CharacterSizeMetrics> characterSizes;
+        unsigned int lastCharacterSize = 0;
+        CharacterSizeMetrics* lastMetrics = nullptr;
+
+        struct Entry
+        {
+            std::weak_ptr<sf::Font> font;
+            std::shared_ptr<MetricsCache> cache;
+        };
+
+        // The caches are shared between all Font objects that use the same sf::Font
+        static std::map<const sf::Font*, Entry> caches;
+    };
+
+    std::map<const sf::Font*, Font::MetricsCache::Entry> Font::MetricsCache::caches;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -88,6 +151,7 @@ namespace tgui
 
             m_font = other.m_font;
             m_id = other.m_id;
+            m_metricsCache = other.m_metricsCache;
         }
 
         return *this;
@@ -105,6 +169,7 @@ namespace tgui
 
             m_font = std::move(other.m_font);
             m_id = std::move(other.m_id);
+            m_metricsCache = std::move(other.m_metricsCache);
         }
 
         return *this;
@@ -191,22 +256,94 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const
+    float Font::getAdvance(std::uint32_t codePoint, unsigned int characterSize, bool bold) const
     {
-        if (m_font)
-            return m_font->getKerning(first, second, characterSize);
+        if (!m_font)
+            return 0;
+
+        CharacterSizeMetrics& metrics = getMetricsCache().get(characterSize);
+        float* advance;
+        if (codePoint < advanceArraySize)
+            advance = &metrics.advances[bold ? 1 : 0][codePoint];
         else
+        {
+            const auto it = metrics.otherAdvances[bold ? 1 : 0].insert({codePoint, notCached}).first;
+            advance = &it->second;
+        }
+
+        if (std::isnan(*advance))
+            *advance = m_font->getGlyph(codePoint, characterSize, bold).advance;
+
+        return *advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float Font::getKerning(std::uint32_t first, std::uint32_t second, unsigned int characterSize) const
+    {
+        if (!m_font)
             return 0;
+
+        CharacterSizeMetrics& metrics = getMetricsCache().get(characterSize);
+        float* kerning;
+        if ((first < kerningArraySize) && (second < kerningArraySize))
+        {
+            if (metrics.kerning.empty())
+                metrics.kerning.resize(kerningArraySize * kerningArraySize, notCached);
+
+            kerning = &metrics.kerning[first * kerningArraySize + second];
+        }
+        else
+        {
+            const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | second;
+            kerning = &metrics.otherKerning.insert({key, notCached}).first->second;
+        }
+
+        if (std::isnan(*kerning))
+            *kerning = m_font->getKerning(first, second, characterSize);
+
+        return *kerning;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     float Font::getLineSpacing(unsigned int characterSize) const
     {
-        if (m_font)
-            return m_font->getLineSpacing(characterSize);
-        else
+        if (!m_font)
             return 0;
+
+        CharacterSizeMetrics& metrics = getMetricsCache().get(characterSize);
+        if (std::isnan(metrics.lineSpacing))
+            metrics.lineSpacing = m_font->getLineSpacing(characterSize);
+
+        return metrics.lineSpacing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font::MetricsCache& Font::getMetricsCache() const
+    {
+        assert(m_font != nullptr);
+        if (m_metricsCache)
+            return *m_metricsCache;
+
+        auto it = MetricsCache::caches.find(m_font.get());
+        if ((it == MetricsCache::caches.end()) || (it->second.font.lock() != m_font))
+        {
+            // Remove the caches of fonts that no longer exist. A new font may have been created at the address of an old one.
+            for (auto cacheIt = MetricsCache::caches.begin(); cacheIt != MetricsCache::caches.end();)
+            {
+                if (cacheIt->second.font.expired())
+                    cacheIt = MetricsCache::caches.erase(cacheIt);
+                else
+                    ++cacheIt;
+            }
+
+            it = MetricsCache::caches.insert({m_font.get(), {m_font, std::make_shared<MetricsCache>()}}).first;
+        }
+
+        m_metricsCache = it->second.cache;
+        return *m_metricsCache;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,9 +26,14 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
+#include <TGUI/TextureManager.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <cassert>
 
 #ifdef SFML_SYSTEM_WINDOWS
@@ -45,6 +50,12 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // How often the gui has to check for images that are being decoded in the background, as it isn't told when one is ready
+        const sf::Time asyncLoadPollInterval = sf::milliseconds(10);
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Gui::Gui() :
@@ -134,12 +145,13 @@ namespace tgui
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
             for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
 
         Clipping::setGuiView(m_view);
+        m_fullRedrawNeeded = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +167,8 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        flushLayouts();
+
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -278,18 +292,30 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
-        // Update the time
-        if (m_windowFocused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+        flushLayouts();
+
+        updateTime();
+
+        m_redrawNeeded = isRedrawNeeded();
 
-        // Change the view
         const sf::View oldView = m_target->getView();
-        m_target->setView(m_view);
 
-        // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        // Draw the widgets. The view is passed to the clipping code again in case multiple gui objects exist.
+        Clipping::setGuiView(m_view);
+        DrawBatch::resetStatistics();
+        if (m_frameCachingEnabled)
+            drawCachedFrame();
+        else
+        {
+            m_target->setView(m_view);
+            drawWidgets(*m_target);
+        }
+
+        m_drawStatistics = DrawBatch::getStatistics();
+        TGUI_PROFILE_END_FRAME(m_drawStatistics);
+
+        m_container->m_invalidatedRegions.clear();
+        m_fullRedrawNeeded = false;
 
         // Restore the old view
         m_target->setView(oldView);
@@ -297,6 +323,125 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setDrawBatchingEnabled(bool enabled)
+    {
+        m_drawBatchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDrawBatchingEnabled() const
+    {
+        return m_drawBatchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setTextureUploadBudget(sf::Time budget)
+    {
+        m_textureUploadBudget = budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getTextureUploadBudget() const
+    {
+        return m_textureUploadBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const DrawBatch::Statistics& Gui::getDrawStatistics() const
+    {
+        return m_drawStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setFrameCachingEnabled(bool enabled)
+    {
+        m_frameCachingEnabled = enabled;
+        m_fullRedrawNeeded = true;
+
+        if (!enabled)
+            m_frameCache = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isFrameCachingEnabled() const
+    {
+        return m_frameCachingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::wasRedrawNeeded() const
+    {
+        return m_redrawNeeded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isRedrawNeeded() const
+    {
+        return m_fullRedrawNeeded || !m_container->m_invalidatedRegions.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::getTimeUntilNextUpdate() const
+    {
+        const sf::Time nothingScheduled = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+
+        // Images that are loaded in the background are uploaded by updateTime, even when the window isn't focused.
+        // Decoded images can be uploaded right away, for the others we can only check again a bit later.
+        sf::Time asyncLoadTime = nothingScheduled;
+        if (TextureManager::isAsyncLoadReady())
+            return sf::Time::Zero;
+        else if (TextureManager::getPendingAsyncLoads() > 0)
+            asyncLoadTime = asyncLoadPollInterval;
+
+        if (!m_windowFocused)
+            return asyncLoadTime;
+
+        sf::Time time = nothingScheduled;
+        if (m_container->isUpdateNeeded())
+            time = m_container->getTimeUntilNextUpdate();
+
+        if (m_tooltipPossible)
+            time = std::min(time, ToolTip::getTimeToDisplay() - m_tooltipTime);
+
+        // The widgets don't know about the time that passed since the last update
+        if (time != nothingScheduled)
+            time = std::max(sf::Time::Zero, time - m_clock.getElapsedTime());
+
+        return std::min(time, asyncLoadTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setLayoutBatchingEnabled(bool enabled)
+    {
+        Layout::setUpdatesDeferred(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isLayoutBatchingEnabled() const
+    {
+        return Layout::areUpdatesDeferred();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::flushLayouts()
+    {
+        Layout::flushDeferredUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -451,6 +596,47 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::loadWidgetsFromBinary(const std::string& filename)
+    {
+        m_container->loadWidgetsFromBinary(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::loadWidgetsFromBinary(const char* data, std::size_t size)
+    {
+        m_container->loadWidgetsFromBinary(data, size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::saveWidgetsToBinary(const std::string& filename) const
+    {
+        m_container->saveWidgetsToBinary(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::updateTime()
+    {
+        if (m_windowFocused)
+            updateTime(m_clock.restart());
+        else
+            m_clock.restart();
+
+        // Upload the images that were decoded in the background, the widgets that use them have to be drawn again
+        TextureManager::processAsyncLoads(m_textureUploadBudget);
+        if (m_finishedAsyncLoads != TextureManager::getFinishedAsyncLoadCount())
+        {
+            m_finishedAsyncLoads = TextureManager::getFinishedAsyncLoadCount();
+            m_fullRedrawNeeded = true;
+        }
+
+        return isRedrawNeeded();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
         m_container->m_animationTimeElapsed = elapsedTime;
@@ -488,6 +674,133 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawWidgets(sf::RenderTarget& target)
+    {
+        if (m_drawBatchingEnabled)
+        {
+            DrawBatch::begin(target);
+            m_container->drawWidgetContainer(&target, sf::RenderStates::Default);
+            DrawBatch::end();
+        }
+        else
+            m_container->drawWidgetContainer(&target, sf::RenderStates::Default);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::drawCachedFrame()
+    {
+        const sf::Vector2u targetSize = m_target->getSize();
+        if (!m_frameCache || (m_frameCache->getSize() != targetSize))
+        {
+            m_frameCache = std::make_unique<sf::RenderTexture>();
+            if (!m_frameCache->create(targetSize.x, targetSize.y))
+            {
+                // Fall back to drawing directly on the target when the texture can't be created
+                m_frameCache = nullptr;
+                m_target->setView(m_view);
+                drawWidgets(*m_target);
+                return;
+            }
+
+            m_fullRedrawNeeded = true;
+            m_redrawNeeded = true;
+        }
+
+        if (m_redrawNeeded)
+        {
+            if (m_fullRedrawNeeded || (m_view.getRotation() != 0))
+            {
+                m_frameCache->clear(sf::Color::Transparent);
+                m_frameCache->setView(m_view);
+                drawWidgets(*m_frameCache);
+            }
+            else
+            {
+                // Convert the regions to pixels, grown by one pixel to account for rounding, and merge the ones that overlap
+                const sf::IntRect viewport = m_frameCache->getViewport(m_view);
+                std::vector<sf::IntRect> pixelRegions;
+                for (const auto& region : m_container->m_invalidatedRegions)
+                {
+                    const sf::Vector2i topLeft = m_frameCache->mapCoordsToPixel({region.left, region.top}, m_view);
+                    const sf::Vector2i bottomRight = m_frameCache->mapCoordsToPixel({region.left + region.width, region.top + region.height}, m_view);
+                    const int left = std::max(viewport.left, std::min(topLeft.x, bottomRight.x) - 1);
+                    const int top = std::max(viewport.top, std::min(topLeft.y, bottomRight.y) - 1);
+                    const int right = std::min(viewport.left + viewport.width, std::max(topLeft.x, bottomRight.x) + 1);
+                    const int bottom = std::min(viewport.top + viewport.height, std::max(topLeft.y, bottomRight.y) + 1);
+                    if ((left >= right) || (top >= bottom))
+                        continue;
+
+                    sf::IntRect pixelRegion{left, top, right - left, bottom - top};
+                    for (auto it = pixelRegions.begin(); it != pixelRegions.end();)
+                    {
+                        if (it->intersects(pixelRegion))
+                        {
+                            const int mergedRight = std::max(it->left + it->width, pixelRegion.left + pixelRegion.width);
+                            const int mergedBottom = std::max(it->top + it->height, pixelRegion.top + pixelRegion.height);
+                            pixelRegion.left = std::min(it->left, pixelRegion.left);
+                            pixelRegion.top = std::min(it->top, pixelRegion.top);
+                            pixelRegion.width = mergedRight - pixelRegion.left;
+                            pixelRegion.height = mergedBottom - pixelRegion.top;
+
+                            // The merged region may now overlap with regions that were already checked
+                            pixelRegions.erase(it);
+                            it = pixelRegions.begin();
+                        }
+                        else
+                            ++it;
+                    }
+
+                    pixelRegions.push_back(pixelRegion);
+                }
+
+                for (const auto& pixelRegion : pixelRegions)
+                {
+                    const float left = static_cast<float>(pixelRegion.left);
+                    const float top = static_cast<float>(pixelRegion.top);
+                    const float right = static_cast<float>(pixelRegion.left + pixelRegion.width);
+                    const float bottom = static_cast<float>(pixelRegion.top + pixelRegion.height);
+
+                    // Erase the old contents of the region
+                    const sf::Vertex vertices[] = {
+                        {{left, top}, sf::Color::Transparent},
+                        {{right, top}, sf::Color::Transparent},
+                        {{left, bottom}, sf::Color::Transparent},
+                        {{right, bottom}, sf::Color::Transparent}
+                    };
+                    m_frameCache->setView(m_frameCache->getDefaultView());
+                    DrawBatch::addVertices(*m_frameCache, sf::RenderStates{sf::BlendNone}, vertices, 4, sf::PrimitiveType::TrianglesStrip);
+
+                    // Draw the widgets with a view that only covers the region. The clipping code has to use this view as well,
+                    // so that widgets outside the region are skipped and clipped contents can't end up outside the region.
+                    const sf::Vector2f viewTopLeft = m_frameCache->mapPixelToCoords({pixelRegion.left, pixelRegion.top}, m_view);
+                    const sf::Vector2f viewBottomRight = m_frameCache->mapPixelToCoords({pixelRegion.left + pixelRegion.width, pixelRegion.top + pixelRegion.height}, m_view);
+                    sf::View regionView{{viewTopLeft, viewBottomRight - viewTopLeft}};
+                    regionView.setViewport({left / targetSize.x, top / targetSize.y,
+                                            pixelRegion.width / static_cast<float>(targetSize.x), pixelRegion.height / static_cast<float>(targetSize.y)});
+
+                    m_frameCache->setView(regionView);
+                    Clipping::setGuiView(regionView);
+                    drawWidgets(*m_frameCache);
+                }
+
+                Clipping::setGuiView(m_view);
+            }
+
+            m_frameCache->display();
+        }
+
+        // The cached frame contains colors that were already multiplied with their alpha value while blending the widgets,
+        // so the alpha value must not be applied a second time when drawing the frame on the target
+        sf::RenderStates states;
+        states.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+
+        m_target->setView(m_target->getDefaultView());
+        DrawBatch::draw(*m_target, sf::Sprite{m_frameCache->getTexture()}, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
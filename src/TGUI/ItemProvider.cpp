@@ -0,0 +1,224 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/ItemProvider.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemProvider::ItemProvider(const ItemProvider&)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemProvider& ItemProvider::operator=(const ItemProvider&)
+    {
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemProvider::~ItemProvider()
+    {
+        // If a listener destroyed the provider then the notify function has to stop calling listeners.
+        // The listeners are kept alive by the outermost notification, as some of them are still being executed.
+        if (m_notifyGuard)
+        {
+            m_notifyGuard->providerDestroyed = true;
+
+            NotifyGuard* outermostGuard = m_notifyGuard;
+            while (outermostGuard->outerGuard)
+                outermostGuard = outermostGuard->outerGuard;
+
+            outermostGuard->orphanedListeners = std::move(m_listeners);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ItemProvider::getItemId(std::size_t) const
+    {
+        return "";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemProvider::itemsChanged(std::size_t first, std::size_t count)
+    {
+        if (count > 0)
+            notify(Change::Changed, first, count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemProvider::itemsInserted(std::size_t first, std::size_t count)
+    {
+        if (count > 0)
+            notify(Change::Inserted, first, count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemProvider::itemsRemoved(std::size_t first, std::size_t count)
+    {
+        if (count > 0)
+            notify(Change::Removed, first, count);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemProvider::itemsReset()
+    {
+        notify(Change::Reset, 0, getItemCount());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ItemProvider::connect(const Listener& listener)
+    {
+        const unsigned int id = ++m_lastListenerId;
+
+        // Adding a listener to m_listeners while notifying could reallocate it and destroy the listener that is being executed
+        if (m_notifyGuard)
+        {
+            m_listenersConnectedWhileNotifying.push_back({id, listener});
+            m_pendingChanges = true;
+        }
+        else
+            m_listeners.push_back({id, listener});
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ItemProvider::disconnect(unsigned int id)
+    {
+        if (id == 0)
+            return false;
+
+        for (auto it = m_listenersConnectedWhileNotifying.begin(); it != m_listenersConnectedWhileNotifying.end(); ++it)
+        {
+            if (it->id == id)
+            {
+                m_listenersConnectedWhileNotifying.erase(it);
+                return true;
+            }
+        }
+
+        for (auto it = m_listeners.begin(); it != m_listeners.end(); ++it)
+        {
+            if (it->id != id)
+                continue;
+
+            // The listener might be executing right now, so it is only removed when the notification is finished
+            if (m_notifyGuard)
+            {
+                it->id = 0;
+                m_pendingChanges = true;
+            }
+            else
+                m_listeners.erase(it);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemProvider::notify(Change change, std::size_t first, std::size_t count)
+    {
+        if (m_listeners.empty())
+            return;
+
+        // The listener list can't grow or shrink while notifying, so the listeners are called directly from it. Listeners that
+        // are disconnected by an earlier listener are skipped, and we must stop touching the provider when it gets destroyed.
+        NotifyGuard guard{*this};
+        const std::size_t listenerCount = m_listeners.size();
+        for (std::size_t i = 0; i < listenerCount; ++i)
+        {
+            if (m_listeners[i].id == 0)
+                continue;
+
+            m_listeners[i].listener(change, first, count);
+            if (guard.providerDestroyed)
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ItemProvider::applyPendingChanges()
+    {
+        if (!m_pendingChanges)
+            return;
+
+        m_listeners.erase(std::remove_if(m_listeners.begin(), m_listeners.end(), [](const ListenerEntry& entry){ return entry.id == 0; }),
+                          m_listeners.end());
+
+        for (auto& entry : m_listenersConnectedWhileNotifying)
+            m_listeners.push_back(std::move(entry));
+
+        m_listenersConnectedWhileNotifying.clear();
+        m_pendingChanges = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemProvider::NotifyGuard::NotifyGuard(ItemProvider& notifyingProvider) :
+        provider  (notifyingProvider),
+        outerGuard(notifyingProvider.m_notifyGuard)
+    {
+        provider.m_notifyGuard = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemProvider::NotifyGuard::~NotifyGuard()
+    {
+        if (providerDestroyed)
+        {
+            if (outerGuard)
+                outerGuard->providerDestroyed = true;
+
+            return;
+        }
+
+        provider.m_notifyGuard = outerGuard;
+        if (!outerGuard)
+            provider.applyPendingChanges();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,14 +26,37 @@
 #include <TGUI/Layout.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        bool updatesDeferred = false;
+
+        // Layouts of which the bound widget changed while updates were deferred
+        std::unordered_set<Layout*> queuedLayouts;
+
+        // Position or size of a widget in the graph that is used to order the deferred updates
+        struct DependencyNode
+        {
+            Widget* widget = nullptr;
+            bool size = false; // Does the node represent the size of the widget instead of its position?
+            std::size_t unresolvedDependencies = 0;
+            std::vector<Layout2d*> dependents;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(std::string expression)
@@ -403,6 +426,9 @@ namespace tgui
 
     void Layout::unbindLayout()
     {
+        if (!queuedLayouts.empty())
+            queuedLayouts.erase(this);
+
         if (m_boundWidget)
         {
             assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
@@ -454,6 +480,7 @@ namespace tgui
 
         // Restore the callback function
         m_connectedWidgetCallback = valueChangedCallbackHandler;
+        m_connectedWidget = widget;
 
         if (m_value != oldValue)
         {
@@ -483,8 +510,29 @@ namespace tgui
 
     void Layout::recalculateValue()
     {
+        TGUI_PROFILE_SCOPE(Layout, m_connectedWidget ? m_connectedWidget->getWidgetType() : std::string{"Layout"});
+
         const float oldValue = m_value;
 
+        updateValue();
+
+        if (m_value != oldValue)
+        {
+            if (m_parent)
+                m_parent->recalculateValue();
+            else
+            {
+                // The topmost layout must tell the connected widget about the new value
+                if (m_connectedWidgetCallback)
+                    m_connectedWidgetCallback();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::updateValue()
+    {
         switch (m_operation)
         {
             case Operation::Value:
@@ -535,16 +583,185 @@ namespace tgui
                 // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
                 break;
         };
+    }
 
-        if (m_value != oldValue)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::updateValueRecursive()
+    {
+        if (m_leftOperand)
         {
-            if (m_parent)
-                m_parent->recalculateValue();
+            m_leftOperand->updateValueRecursive();
+            m_rightOperand->updateValueRecursive();
+        }
+
+        updateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::removeFromQueueRecursive()
+    {
+        if (m_leftOperand)
+        {
+            m_leftOperand->removeFromQueueRecursive();
+            m_rightOperand->removeFromQueueRecursive();
+        }
+
+        queuedLayouts.erase(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::boundWidgetChanged()
+    {
+        if (updatesDeferred)
+            queuedLayouts.insert(this);
+        else
+            recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::setUpdatesDeferred(bool deferred)
+    {
+        updatesDeferred = deferred;
+        if (!deferred)
+            flushDeferredUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::areUpdatesDeferred()
+    {
+        return updatesDeferred;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::flushDeferredUpdates()
+    {
+        // Finds the position or size of the widget of which the layout is part, returns nullptr if no widget uses the layout
+        const auto findOwner = [](Layout* layout, DependencyNode& node) -> Layout2d* {
+            while (layout->m_parent)
+                layout = layout->m_parent;
+
+            Widget* widget = layout->m_connectedWidget;
+            if (!widget)
+                return nullptr;
+
+            node.widget = widget;
+            if ((layout == &widget->m_position.x) || (layout == &widget->m_position.y))
+            {
+                node.size = false;
+                return &widget->m_position;
+            }
+            else if ((layout == &widget->m_size.x) || (layout == &widget->m_size.y))
+            {
+                node.size = true;
+                return &widget->m_size;
+            }
             else
+                return nullptr;
+        };
+
+        // Changing a widget can queue new layouts, so keep going until nothing changes anymore
+        while (!queuedLayouts.empty())
+        {
+            std::unordered_map<Layout2d*, DependencyNode> nodes;
+            std::vector<Layout2d*> nodesToVisit;
+
+            const std::vector<Layout*> layouts(queuedLayouts.begin(), queuedLayouts.end());
+            for (Layout* layout : layouts)
             {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                DependencyNode node;
+                Layout2d* owner = findOwner(layout, node);
+                if (owner)
+                {
+                    if (nodes.emplace(owner, node).second)
+                        nodesToVisit.push_back(owner);
+                }
+                else // The layout isn't used by a widget, so nothing else depends on it
+                {
+                    queuedLayouts.erase(layout);
+                    layout->recalculateValue();
+                }
+            }
+
+            // Find all widgets that depend on the changed ones, directly or indirectly
+            while (!nodesToVisit.empty())
+            {
+                Layout2d* owner = nodesToVisit.back();
+                nodesToVisit.pop_back();
+
+                const DependencyNode& node = nodes[owner];
+                const auto& boundLayouts = node.size ? node.widget->m_boundSizeLayouts : node.widget->m_boundPositionLayouts;
+                for (Layout* boundLayout : boundLayouts)
+                {
+                    DependencyNode dependentNode;
+                    Layout2d* dependent = findOwner(boundLayout, dependentNode);
+                    if (!dependent)
+                        continue;
+
+                    nodes[owner].dependents.push_back(dependent);
+
+                    const auto result = nodes.emplace(dependent, dependentNode);
+                    ++result.first->second.unresolvedDependencies;
+                    if (result.second)
+                        nodesToVisit.push_back(dependent);
+                }
+            }
+
+            // Updates the position or size of a widget, after the widgets it depends on were updated
+            const auto updateNode = [](Layout2d* owner){
+                owner->x.removeFromQueueRecursive();
+                owner->y.removeFromQueueRecursive();
+
+                const Vector2f oldValue = owner->getValue();
+                owner->x.updateValueRecursive();
+                owner->y.updateValueRecursive();
+
+                if ((owner->getValue() != oldValue) && owner->x.m_connectedWidgetCallback)
+                    owner->x.m_connectedWidgetCallback();
+            };
+
+            // Update the widgets in topological order
+            std::vector<Layout2d*> readyNodes;
+            for (const auto& pair : nodes)
+            {
+                if (pair.second.unresolvedDependencies == 0)
+                    readyNodes.push_back(pair.first);
+            }
+
+            std::size_t updatedNodes = 0;
+            while (!readyNodes.empty())
+            {
+                Layout2d* owner = readyNodes.back();
+                readyNodes.pop_back();
+
+                updateNode(owner);
+                ++updatedNodes;
+
+                for (Layout2d* dependent : nodes[owner].dependents)
+                {
+                    if (--nodes[dependent].unresolvedDependencies == 0)
+                        readyNodes.push_back(dependent);
+                }
+            }
+
+            // Widgets that still have unresolved dependencies are part of a cycle
+            if (updatedNodes < nodes.size())
+            {
+                TGUI_PRINT_WARNING("cycle detected in layouts, the widgets involved are only updated once.");
+
+                for (auto& pair : nodes)
+                {
+                    if (pair.second.unresolvedDependencies > 0)
+                        updateNode(pair.first);
+                }
+
+                // Recalculating the layouts again would never end
+                queuedLayouts.clear();
             }
         }
     }
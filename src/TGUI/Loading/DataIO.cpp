@@ -24,60 +24,25 @@
 
 
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Global.hpp>
 #include <TGUI/to_string.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <cassert>
+#include <cstring>
+#include <cstdint>
+#include <locale>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #define REMOVE_WHITESPACE_AND_COMMENTS(ReturnErrorOnEOF) \
-    for (;;) \
-    { \
-        stream >> std::ws; \
-        if (stream.peek() == EOF) \
-            break; \
-        \
-        if (stream.peek() == '/') \
-        { \
-            char c; \
-            stream.read(&c, 1); \
-            if (stream.peek() == '/') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (c == '\n') \
-                        break; \
-                } \
-            } \
-            else if (stream.peek() == '*') \
-            { \
-                while (stream.peek() != EOF) \
-                { \
-                    stream.read(&c, 1); \
-                    if (stream.peek() == '*') \
-                    { \
-                        stream.read(&c, 1); \
-                        if (stream.peek() == '/') \
-                        { \
-                            stream.read(&c, 1); \
-                            break; \
-                        } \
-                    } \
-                } \
-                continue; \
-            } \
-            else \
-                return "Unexpected '/' found."; \
-            \
-            continue; \
-        } \
-        break; \
-    } \
+    if (!skipWhitespaceAndComments(input)) \
+        return "Unexpected '/' found."; \
     \
-    if (stream.peek() == EOF) \
+    if (input.atEnd()) \
     { \
         if (ReturnErrorOnEOF) \
             return "Unexpected EOF while parsing."; \
@@ -91,76 +56,146 @@ namespace tgui
 {
     namespace
     {
+        // The input is read directly from a contiguous buffer. Words and values are located in the buffer first and only copied
+        // into a string once, instead of extracting and appending every character separately.
+        struct Input
+        {
+            const char* const begin;
+            const char* pos;
+            const char* const end;
+
+            bool atEnd() const
+            {
+                return pos == end;
+            }
+
+            int peek() const
+            {
+                return (pos != end) ? static_cast<unsigned char>(*pos) : EOF;
+            }
+
+            int peekNext() const
+            {
+                return (pos + 1 < end) ? static_cast<unsigned char>(pos[1]) : EOF;
+            }
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isSpace(int c)
+        {
+            return (c != EOF) && ::isspace(c);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Skips a comment, the input must be pointing to its first slash. Returns false if the slash did not start a comment.
+        bool skipComment(Input& input)
+        {
+            if (input.peekNext() == '/')
+            {
+                const char* lineEnd = static_cast<const char*>(std::memchr(input.pos, '\n', input.end - input.pos));
+                input.pos = lineEnd ? lineEnd + 1 : input.end;
+                return true;
+            }
+            else if (input.peekNext() == '*')
+            {
+                input.pos += 2;
+                while ((input.pos != input.end) && !((*input.pos == '*') && (input.peekNext() == '/')))
+                    ++input.pos;
+
+                input.pos = (input.pos != input.end) ? input.pos + 2 : input.end;
+                return true;
+            }
+            else
+                return false;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns false when a slash was found that isn't part of a comment
+        bool skipWhitespaceAndComments(Input& input)
+        {
+            for (;;)
+            {
+                while (isSpace(input.peek()))
+                    ++input.pos;
+
+                if (input.peek() != '/')
+                    return true;
+
+                if (!skipComment(input))
+                    return false;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Moves past a quoted string, the input must be pointing to the opening quote
+        void skipQuotedString(Input& input)
+        {
+            ++input.pos;
+
+            bool backslash = false;
+            while (input.pos != input.end)
+            {
+                const char c = *input.pos++;
+                if ((c == '"') && !backslash)
+                    break;
+
+                backslash = (c == '\\') && !backslash;
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         // Forward declare one of the functions to solve circular dependency
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
+        std::string parseSection(Input& input, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readWord(std::stringstream& stream)
+        std::string readWord(Input& input)
         {
-            std::string word = "";
-            while (stream.peek() != EOF)
+            // The word is only copied when a comment interrupts it, otherwise it is taken from the buffer at the end
+            std::string word;
+            const char* wordStart = input.pos;
+            while (!input.atEnd())
             {
-                char c = static_cast<char>(stream.peek());
+                const char c = *input.pos;
                 if (c == '\r')
                 {
-                    stream.read(&c, 1);
+                    word.append(wordStart, input.pos);
+                    ++input.pos;
                     return word;
                 }
-                else if (!::isspace(c) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
+                else if (!isSpace(static_cast<unsigned char>(c)) && (c != '=') && (c != ';') && (c != '{') && (c != '}'))
                 {
-                    stream.read(&c, 1);
-
-                    if ((c == '/') && (stream.peek() == '/'))
+                    if ((c == '/') && (input.peekNext() == '/'))
                     {
-                        while (stream.peek() != EOF)
+                        word.append(wordStart, input.pos);
+                        skipComment(input);
+                        if (input.pos[-1] == '\n')
                         {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                            {
-                                assert(!word.empty()); // No known case in which you can pass here with an empty word
-                                return word;
-                            }
+                            assert(!word.empty()); // No known case in which you can pass here with an empty word
+                            return word;
                         }
                     }
-                    else if ((c == '/') && (stream.peek() == '*'))
+                    else if ((c == '/') && (input.peekNext() == '*'))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '*')
-                            {
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
+                        word.append(wordStart, input.pos);
+                        skipComment(input);
+                        wordStart = input.pos;
                     }
                     else if (c == '"')
-                    {
-                        word.push_back(c);
-                        bool backslash = false;
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            word.push_back(c);
-
-                            if (c == '"' && !backslash)
-                                break;
-
-                            if (c == '\\' && !backslash)
-                                backslash = true;
-                            else
-                                backslash = false;
-                        }
-                    }
+                        skipQuotedString(input);
                     else
-                        word.push_back(c);
+                        ++input.pos;
                 }
                 else
+                {
+                    word.append(wordStart, input.pos);
                     return word;
+                }
             }
 
             return "";
@@ -168,73 +203,36 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string readLine(std::stringstream& stream)
+        std::string readLine(Input& input)
         {
+            // Comments are removed and whitespace is collapsed into a single space
             std::string line;
             bool whitespaceFound = false;
-            while (stream.peek() != EOF)
+            while (!input.atEnd())
             {
-                char c = static_cast<char>(stream.peek());
+                char c = *input.pos;
 
-                if (stream.peek() == '/')
+                if (c == '/')
                 {
-                    stream.read(&c, 1);
-                    if (stream.peek() == '/')
-                    {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (c == '\n')
-                                break;
-                        }
-                    }
-                    else if (stream.peek() == '*')
+                    if (!skipComment(input))
                     {
-                        while (stream.peek() != EOF)
-                        {
-                            stream.read(&c, 1);
-                            if (stream.peek() == '*')
-                            {
-                                stream.read(&c, 1);
-                                if (stream.peek() == '/')
-                                {
-                                    stream.read(&c, 1);
-                                    break;
-                                }
-                            }
-                        }
-                        continue;
-                    }
-                    else
+                        ++input.pos;
                         return "";
+                    }
 
                     continue;
                 }
 
                 if (c == '"')
                 {
-                    stream.read(&c, 1);
-                    line.push_back(c);
-
-                    bool backslash = false;
-                    while (stream.peek() != EOF)
-                    {
-                        stream.read(&c, 1);
-                        line.push_back(c);
-
-                        if (c == '"' && !backslash)
-                            break;
+                    const char* quoteStart = input.pos;
+                    skipQuotedString(input);
+                    line.append(quoteStart, input.pos);
 
-                        if (c == '\\' && !backslash)
-                            backslash = true;
-                        else
-                            backslash = false;
-                    }
-
-                    if (stream.peek() == EOF)
+                    if (input.atEnd())
                         return "";
 
-                    c = static_cast<char>(stream.peek());
+                    c = *input.pos;
                 }
 
                 if ((c == '=') || (c == '{'))
@@ -245,9 +243,9 @@ namespace tgui
                     line.erase(line.find_last_not_of(" \n\r\t")+1);
                     return line;
                 }
-                else if (::isspace(c))
+                else if (isSpace(static_cast<unsigned char>(c)))
                 {
-                    stream.read(&c, 1);
+                    ++input.pos;
                     if (!whitespaceFound)
                     {
                         whitespaceFound = true;
@@ -256,9 +254,18 @@ namespace tgui
                 }
                 else
                 {
+                    // Copy all characters up to the next one that needs special treatment at once
+                    const char* runStart = input.pos;
+                    do
+                    {
+                        ++input.pos;
+                        c = input.atEnd() ? ' ' : *input.pos;
+                    }
+                    while (!isSpace(static_cast<unsigned char>(c)) && (c != '/') && (c != '"')
+                        && (c != '=') && (c != '{') && (c != ';') && (c != '}'));
+
                     whitespaceFound = false;
-                    line.push_back(c);
-                    stream.read(&c, 1);
+                    line.append(runStart, input.pos);
                 }
             }
 
@@ -267,25 +274,68 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseKeyValue(std::stringstream& stream, std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        void splitListValue(const std::string& line, std::vector<sf::String>& valueList)
         {
-            // Read the assignment symbol from the stream and remove the whitespace behind it
-            char chr;
-            stream.read(&chr, 1);
+            // The first and last characters are the brackets around the list
+            std::string item;
+            std::size_t i = 1;
+            while (i < line.size()-1)
+            {
+                if (line[i] == ',')
+                {
+                    i++;
+                    valueList.push_back(trim(item));
+                    item.clear();
+                }
+                else if (line[i] == '"')
+                {
+                    const std::size_t quoteStart = i++;
+
+                    bool backslash = false;
+                    while (i < line.size()-1)
+                    {
+                        if (line[i] == '"' && !backslash)
+                        {
+                            i++;
+                            break;
+                        }
+
+                        backslash = (line[i] == '\\') && !backslash;
+                        i++;
+                    }
+
+                    item.append(line, quoteStart, i - quoteStart);
+                }
+                else
+                {
+                    item.push_back(line[i]);
+                    i++;
+                }
+            }
+
+            valueList.push_back(trim(item));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::string parseKeyValue(Input& input, const std::unique_ptr<DataIO::Node>& node, const std::string& key)
+        {
+            // Skip the assignment symbol and remove the whitespace behind it
+            ++input.pos;
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
 
             // Check for subsection as value
-            if (stream.peek() == '{')
-                return parseSection(stream, node, key);
+            if (input.peek() == '{')
+                return parseSection(input, node, key);
 
             // Read the value
-            std::string line = trim(readLine(stream));
+            std::string line = trim(readLine(input));
             if (!line.empty())
             {
                 // Remove the ';' if it is there
-                if (stream.peek() == ';')
-                    stream.read(&chr, 1);
+                if (input.peek() == ';')
+                    ++input.pos;
 
                 // Create a value node to store the value
                 auto valueNode = std::make_unique<DataIO::ValueNode>();
@@ -296,51 +346,7 @@ namespace tgui
                 {
                     valueNode->listNode = true;
                     if (line.size() >= 3)
-                    {
-                        valueNode->valueList.push_back("");
-
-                        std::size_t i = 1;
-                        while (i < line.size()-1)
-                        {
-                            if (line[i] == ',')
-                            {
-                                i++;
-                                valueNode->valueList.back() = trim(valueNode->valueList.back());
-                                valueNode->valueList.push_back("");
-                            }
-                            else if (line[i] == '"')
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-
-                                bool backslash = false;
-                                while (i < line.size()-1)
-                                {
-                                    valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-
-                                    if (line[i] == '"' && !backslash)
-                                    {
-                                        i++;
-                                        break;
-                                    }
-
-                                    if (line[i] == '\\' && !backslash)
-                                        backslash = true;
-                                    else
-                                        backslash = false;
-
-                                    i++;
-                                }
-                            }
-                            else
-                            {
-                                valueNode->valueList.back().insert(valueNode->valueList.back().getSize(), line[i]);
-                                i++;
-                            }
-                        }
-
-                        valueNode->valueList.back() = trim(valueNode->valueList.back());
-                    }
+                        splitListValue(line, valueNode->valueList);
                 }
 
                 node->propertyValuePairs[toLower(key)] = std::move(valueNode);
@@ -348,76 +354,71 @@ namespace tgui
             }
             else
             {
-                if (stream.peek() == EOF)
+                if (input.atEnd())
                     return "Found EOF while trying to read a value.";
+                else if (input.peek() == '=')
+                    return "Found '=' while trying to read a value.";
+                else if (input.peek() == '{')
+                    return "Found '{' while trying to read a value.";
                 else
-                {
-                    chr = static_cast<char>(stream.peek());
-                    if (chr == '=')
-                        return "Found '=' while trying to read a value.";
-                    else if (chr == '{')
-                        return "Found '{' while trying to read a value.";
-                    else
-                        return "Found empty value.";
-                }
+                    return "Found empty value.";
             }
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseSection(std::stringstream& stream, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
+        std::string parseSection(Input& input, const std::unique_ptr<DataIO::Node>& node, const std::string& sectionName)
         {
             // Create a new node for this section
             auto sectionNode = std::make_unique<DataIO::Node>();
             sectionNode->parent = node.get();
             sectionNode->name = sectionName;
 
-            // Read the brace from the stream
-            char chr;
-            stream.read(&chr, 1);
+            // Skip the brace
+            ++input.pos;
 
-            while (stream.peek() != EOF)
+            while (!input.atEnd())
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
 
-                std::string word = readWord(stream);
+                std::string word = readWord(input);
                 if (word == "")
                 {
-                    if (stream.peek() == EOF)
+                    if (input.atEnd())
                         return "Found EOF while trying to read property or nested section name.";
-                    else if (stream.peek() == '}')
+                    else if (input.peek() == '}')
                     {
                         node->children.push_back(std::move(sectionNode));
 
-                        stream.read(&chr, 1);
+                        ++input.pos;
 
                         // Ignore semicolon behind closing brace
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
-                        if (stream.peek() == ';')
-                            stream.read(&chr, 1);
+                        if (input.peek() == ';')
+                            ++input.pos;
 
                         REMOVE_WHITESPACE_AND_COMMENTS(false)
                         return "";
                     }
-                    else if (stream.peek() != '{')
-                        return "Expected property or nested section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                    else if (input.peek() != '{')
+                        return "Expected property or nested section name, found '" + std::string(1, *input.pos) + "' instead.";
                 }
 
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() == '{')
+                if (input.peek() == '{')
                 {
-                    std::string error = parseSection(stream, sectionNode, word);
+                    std::string error = parseSection(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
-                else if (stream.peek() == '=')
+                else if (input.peek() == '=')
                 {
-                    std::string error = parseKeyValue(stream, sectionNode, word);
+                    std::string error = parseKeyValue(input, sectionNode, word);
                     if (!error.empty())
                         return error;
                 }
                 else
-                    return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                    return "Expected '{' or '=', found '" + std::string(1, *input.pos) + "' instead.";
             }
 
             return "Found EOF while reading section.";
@@ -425,25 +426,25 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        std::string parseRootSection(std::stringstream& stream, std::unique_ptr<DataIO::Node>& root)
+        std::string parseRootSection(Input& input, const std::unique_ptr<DataIO::Node>& root)
         {
             REMOVE_WHITESPACE_AND_COMMENTS(false)
 
-            std::string word = readWord(stream);
+            std::string word = readWord(input);
             if (word == "")
             {
                 REMOVE_WHITESPACE_AND_COMMENTS(true)
-                if (stream.peek() != '{')
-                    return "Expected section name, found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                if (input.peek() != '{')
+                    return "Expected section name, found '" + std::string(1, *input.pos) + "' instead.";
             }
 
             REMOVE_WHITESPACE_AND_COMMENTS(true)
-            if (stream.peek() == '{')
-                return parseSection(stream, root, word);
-            else if (stream.peek() == '=')
-                return parseKeyValue(stream, root, word);
+            if (input.peek() == '{')
+                return parseSection(input, root, word);
+            else if (input.peek() == '=')
+                return parseKeyValue(input, root, word);
             else
-                return "Expected '{' or '=', found '" + std::string(1, static_cast<char>(stream.peek())) + "' instead.";
+                return "Expected '{' or '=', found '" + std::string(1, *input.pos) + "' instead.";
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -482,29 +483,499 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Binary widget files start with these bytes, followed by a 16-bit version number.
+        // All numbers are stored in little endian byte order.
+        const char binaryMagic[6] = {'T', 'G', 'U', 'I', 'W', 'B'};
+        const std::uint16_t binaryVersion = 2;
+
+        // Deeper nesting is rejected when reading a binary file, so that corrupt data can't cause a stack overflow
+        const unsigned int binaryMaxNestingDepth = 256;
+
+        void writeUInt8(std::string& output, std::uint8_t value)
+        {
+            output.push_back(static_cast<char>(value));
+        }
+
+        void writeUInt16(std::string& output, std::uint16_t value)
+        {
+            output.push_back(static_cast<char>(value & 0xFF));
+            output.push_back(static_cast<char>((value >> 8) & 0xFF));
+        }
+
+        void writeUInt32(std::string& output, std::uint32_t value)
+        {
+            for (unsigned int i = 0; i < 4; ++i)
+                output.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+        }
+
+        void writeFloat(std::string& output, float value)
+        {
+            static_assert(sizeof(float) == sizeof(std::uint32_t), "Floats are stored as 32-bit values");
+
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            writeUInt32(output, bits);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Since version 2, every value is followed by one of these tags and the parsed value. The string is still stored as
+        // well, so that code which doesn't use the parsed value keeps working.
+        enum class BinaryValueType : std::uint8_t
+        {
+            String,  // Nothing follows
+            Number,  // Followed by a float
+            Color,   // Followed by a byte that is 1 when the color is set and the red, green, blue and alpha bytes
+            Outline, // Followed by the left, top, right and bottom floats
+            Layout   // Followed by the x and y values, each being a byte that is 1 for a constant and then a float or string
+        };
+
+        // Layouts with a number are constants, other layouts are expressions
+        enum class BinaryLayoutType : std::uint8_t
+        {
+            Expression,
+            Constant
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns true when the string only consists of a number
+        bool parseNumber(const std::string& str, float& number)
+        {
+            std::istringstream stream{str};
+            stream.imbue(std::locale::classic());
+            stream >> number;
+            return !stream.fail() && (stream >> std::ws).eof();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Splits the value of a position or size in its two parts, in the same way as Widget::load does
+        bool splitLayout(std::string str, std::string& x, std::string& y)
+        {
+            if (str.empty())
+                return false;
+
+            // Remove the brackets around the value
+            if (((str.front() == '(') && (str.back() == ')')) || ((str.front() == '{') && (str.back() == '}')))
+                str = str.substr(1, str.length() - 2);
+
+            if (str.empty())
+            {
+                x = "0";
+                y = "0";
+                return true;
+            }
+
+            const auto commaPos = str.find(',');
+            if (commaPos == std::string::npos)
+                return false;
+
+            // Remove quotes around the values
+            x = trim(str.substr(0, commaPos));
+            if ((x.size() >= 2) && ((x[0] == '"') && (x[x.length()-1] == '"')))
+                x = x.substr(1, x.length()-2);
+
+            y = trim(str.substr(commaPos + 1));
+            if ((y.size() >= 2) && ((y[0] == '"') && (y[y.length()-1] == '"')))
+                y = y.substr(1, y.length()-2);
+
+            return true;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Every distinct string in the file is stored once, nodes only contain indices in the table
+        struct StringTable
+        {
+            std::uint32_t add(const std::string& str)
+            {
+                const auto it = indices.find(str);
+                if (it != indices.end())
+                    return it->second;
+
+                const auto index = static_cast<std::uint32_t>(strings.size());
+                indices.emplace(str, index);
+                strings.push_back(str);
+                return index;
+            }
+
+            std::uint32_t add(const sf::String& str)
+            {
+                const auto utf8 = str.toUtf8();
+                return add(std::string(utf8.begin(), utf8.end()));
+            }
+
+            std::unordered_map<std::string, std::uint32_t> indices;
+            std::vector<std::string> strings;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Writes the type of the value and its parsed form. Which type a value has is decided by the key, like the renderer
+        // and widget properties do, and by whether the value can be parsed as that type.
+        void emitBinaryValueType(const std::string& key, const sf::String& value, std::string& output, StringTable& table)
+        {
+            const std::string str = value.toAnsiString();
+            const auto endsWith = [&key](const std::string& suffix){
+                    return (key.size() >= suffix.size()) && (key.compare(key.size() - suffix.size(), suffix.size(), suffix) == 0);
+                };
+
+            try
+            {
+                if (endsWith("color") && !str.empty())
+                {
+                    const Color color{str};
+                    writeUInt8(output, static_cast<std::uint8_t>(BinaryValueType::Color));
+                    writeUInt8(output, color.isSet() ? 1 : 0);
+                    writeUInt8(output, color.getRed());
+                    writeUInt8(output, color.getGreen());
+                    writeUInt8(output, color.getBlue());
+                    writeUInt8(output, color.getAlpha());
+                    return;
+                }
+
+                // Relative outlines depend on the size of the widget, so only absolute ones are stored
+                if (((key == "borders") || (key == "padding")) && (str.find('%') == std::string::npos))
+                {
+                    const Outline outline = Deserializer::deserialize(ObjectConverter::Type::Outline, str).getOutline();
+                    writeUInt8(output, static_cast<std::uint8_t>(BinaryValueType::Outline));
+                    writeFloat(output, outline.getLeft());
+                    writeFloat(output, outline.getTop());
+                    writeFloat(output, outline.getRight());
+                    writeFloat(output, outline.getBottom());
+                    return;
+                }
+            }
+            catch (const Exception&)
+            {
+                // The value is stored as a string, loading it will report the error
+            }
+
+            std::string layoutX;
+            std::string layoutY;
+            if (((key == "position") || (key == "size")) && splitLayout(str, layoutX, layoutY))
+            {
+                writeUInt8(output, static_cast<std::uint8_t>(BinaryValueType::Layout));
+                for (const auto& layout : {layoutX, layoutY})
+                {
+                    float number;
+                    if (parseNumber(layout, number))
+                    {
+                        writeUInt8(output, static_cast<std::uint8_t>(BinaryLayoutType::Constant));
+                        writeFloat(output, number);
+                    }
+                    else
+                    {
+                        writeUInt8(output, static_cast<std::uint8_t>(BinaryLayoutType::Expression));
+                        writeUInt32(output, table.add(layout));
+                    }
+                }
+                return;
+            }
+
+            // The numbers 0 and 1 are left as strings as they could also be booleans
+            float number;
+            if ((str != "0") && (str != "1") && parseNumber(str, number))
+            {
+                writeUInt8(output, static_cast<std::uint8_t>(BinaryValueType::Number));
+                writeFloat(output, number);
+                return;
+            }
+
+            writeUInt8(output, static_cast<std::uint8_t>(BinaryValueType::String));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void emitBinaryNode(const DataIO::Node& node, std::string& output, StringTable& table)
+        {
+            writeUInt32(output, table.add(node.name));
+
+            writeUInt32(output, static_cast<std::uint32_t>(node.propertyValuePairs.size()));
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                writeUInt32(output, table.add(pair.first));
+                writeUInt32(output, table.add(pair.second->value));
+                writeUInt8(output, pair.second->listNode ? 1 : 0);
+                if (pair.second->listNode)
+                {
+                    writeUInt32(output, static_cast<std::uint32_t>(pair.second->valueList.size()));
+                    for (const auto& item : pair.second->valueList)
+                        writeUInt32(output, table.add(item));
+
+                    writeUInt8(output, static_cast<std::uint8_t>(BinaryValueType::String));
+                }
+                else
+                    emitBinaryValueType(pair.first, pair.second->value, output, table);
+            }
+
+            writeUInt32(output, static_cast<std::uint32_t>(node.children.size()));
+            for (const auto& child : node.children)
+                emitBinaryNode(*child, output, table);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the binary format directly from the buffer. The strings from the table are only copied when a node uses them.
+        class BinaryReader
+        {
+        public:
+
+            BinaryReader(const char* data, std::size_t size) :
+                m_pos{data},
+                m_end{data + size}
+            {
+            }
+
+            std::uint8_t readUInt8()
+            {
+                requireBytes(1);
+                return static_cast<std::uint8_t>(*m_pos++);
+            }
+
+            std::uint16_t readUInt16()
+            {
+                requireBytes(2);
+                const auto* bytes = reinterpret_cast<const unsigned char*>(m_pos);
+                m_pos += 2;
+                return static_cast<std::uint16_t>(bytes[0] | (bytes[1] << 8));
+            }
+
+            std::uint32_t readUInt32()
+            {
+                requireBytes(4);
+                const auto* bytes = reinterpret_cast<const unsigned char*>(m_pos);
+                m_pos += 4;
+                return static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                     | (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24);
+            }
+
+            float readFloat()
+            {
+                const std::uint32_t bits = readUInt32();
+
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            // Reads an element count and checks that the data can contain that many elements of the given minimum size
+            std::uint32_t readCount(std::size_t minElementSize)
+            {
+                const std::uint32_t count = readUInt32();
+                if (count > static_cast<std::size_t>(m_end - m_pos) / minElementSize)
+                    throw Exception{"Invalid binary widget file. Element count exceeds the size of the data."};
+
+                return count;
+            }
+
+            void readHeader()
+            {
+                requireBytes(sizeof(binaryMagic));
+                if (std::memcmp(m_pos, binaryMagic, sizeof(binaryMagic)) != 0)
+                    throw Exception{"Data does not contain a binary widget file."};
+
+                m_pos += sizeof(binaryMagic);
+                m_version = readUInt16();
+                if ((m_version < 1) || (m_version > binaryVersion))
+                    throw Exception{"Binary widget file has unsupported version " + to_string(m_version) + "."};
+            }
+
+            void readStringTable()
+            {
+                const std::uint32_t count = readCount(4);
+                m_strings.reserve(count);
+                for (std::uint32_t i = 0; i < count; ++i)
+                {
+                    const std::uint32_t length = readUInt32();
+                    requireBytes(length);
+                    m_strings.emplace_back(m_pos, length);
+                    m_pos += length;
+                }
+
+                m_decodedStrings.resize(count);
+                m_stringDecoded.resize(count, false);
+            }
+
+            std::string readString()
+            {
+                const std::uint32_t index = readStringIndex();
+                return std::string(m_strings[index].first, m_strings[index].second);
+            }
+
+            const sf::String& readUtf8String()
+            {
+                const std::uint32_t index = readStringIndex();
+                if (!m_stringDecoded[index])
+                {
+                    m_decodedStrings[index] = sf::String::fromUtf8(m_strings[index].first, m_strings[index].first + m_strings[index].second);
+                    m_stringDecoded[index] = true;
+                }
+
+                return m_decodedStrings[index];
+            }
+
+            void readNode(DataIO::Node& node, unsigned int depth = 0)
+            {
+                if (depth > binaryMaxNestingDepth)
+                    throw Exception{"Invalid binary widget file. Nodes are nested more than " + to_string(binaryMaxNestingDepth) + " levels deep."};
+
+                node.name = readString();
+
+                const std::uint32_t propertyCount = readCount((m_version >= 2) ? 10 : 9);
+                for (std::uint32_t i = 0; i < propertyCount; ++i)
+                {
+                    const std::string key = readString();
+
+                    auto valueNode = std::make_unique<DataIO::ValueNode>(readUtf8String());
+                    valueNode->listNode = (readUInt8() != 0);
+                    if (valueNode->listNode)
+                    {
+                        const std::uint32_t itemCount = readCount(4);
+                        valueNode->valueList.reserve(itemCount);
+                        for (std::uint32_t j = 0; j < itemCount; ++j)
+                            valueNode->valueList.push_back(readUtf8String());
+                    }
+
+                    if (m_version >= 2)
+                        readParsedValue(*valueNode);
+
+                    node.propertyValuePairs[key] = std::move(valueNode);
+                }
+
+                const std::uint32_t childCount = readCount(12);
+                node.children.reserve(childCount);
+                for (std::uint32_t i = 0; i < childCount; ++i)
+                {
+                    auto child = std::make_unique<DataIO::Node>();
+                    child->parent = &node;
+                    readNode(*child, depth + 1);
+                    node.children.push_back(std::move(child));
+                }
+            }
+
+            bool atEnd() const
+            {
+                return m_pos == m_end;
+            }
+
+        private:
+
+            void readParsedValue(DataIO::ValueNode& valueNode)
+            {
+                switch (static_cast<BinaryValueType>(readUInt8()))
+                {
+                    case BinaryValueType::String:
+                        break;
+
+                    case BinaryValueType::Number:
+                        valueNode.parsedValue = readFloat();
+                        break;
+
+                    case BinaryValueType::Color:
+                    {
+                        const bool isSet = (readUInt8() != 0);
+                        const std::uint8_t red = readUInt8();
+                        const std::uint8_t green = readUInt8();
+                        const std::uint8_t blue = readUInt8();
+                        const std::uint8_t alpha = readUInt8();
+                        valueNode.parsedValue = isSet ? Color{red, green, blue, alpha} : Color{};
+                        break;
+                    }
+
+                    case BinaryValueType::Outline:
+                    {
+                        const float left = readFloat();
+                        const float top = readFloat();
+                        const float right = readFloat();
+                        const float bottom = readFloat();
+                        valueNode.parsedValue = Outline{left, top, right, bottom};
+                        break;
+                    }
+
+                    case BinaryValueType::Layout:
+                    {
+                        const Layout layoutX = readLayout();
+                        const Layout layoutY = readLayout();
+                        valueNode.parsedLayout = std::make_unique<Layout2d>(layoutX, layoutY);
+                        break;
+                    }
+
+                    default:
+                        throw Exception{"Invalid binary widget file. Unknown value type."};
+                }
+            }
+
+            Layout readLayout()
+            {
+                if (static_cast<BinaryLayoutType>(readUInt8()) == BinaryLayoutType::Constant)
+                    return {readFloat()};
+                else
+                    return {readString()};
+            }
+
+            void requireBytes(std::size_t count) const
+            {
+                if (count > static_cast<std::size_t>(m_end - m_pos))
+                    throw Exception{"Invalid binary widget file. Unexpected end of data."};
+            }
+
+            std::uint32_t readStringIndex()
+            {
+                const std::uint32_t index = readUInt32();
+                if (index >= m_strings.size())
+                    throw Exception{"Invalid binary widget file. String index out of range."};
+
+                return index;
+            }
+
+        private:
+
+            const char* m_pos;
+            const char* const m_end;
+            std::uint16_t m_version = binaryVersion;
+            std::vector<std::pair<const char*, std::size_t>> m_strings;
+            std::vector<sf::String> m_decodedStrings;
+            std::vector<bool> m_stringDecoded;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<DataIO::Node> DataIO::parse(std::stringstream& stream)
+    {
+        const std::string str = stream.str();
+
+        // Continue from the current read position, in case part of the stream was already consumed
+        std::size_t offset = 0;
+        const auto position = stream.tellg();
+        if (position != std::stringstream::pos_type(-1))
+            offset = std::min(static_cast<std::size_t>(position), str.size());
+
+        auto root = parse(str.data() + offset, str.size() - offset);
+
+        stream.seekg(0, std::ios_base::end);
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parse(const char* data, std::size_t size)
     {
         auto root = std::make_unique<Node>();
 
-        std::string error;
-        while (stream.peek() != EOF)
+        Input input{data, data, data + size};
+        while (!input.atEnd())
         {
-            error = parseRootSection(stream, root);
+            const std::string error = parseRootSection(input, root);
             if (!error.empty())
             {
-                if (stream.tellg() != std::stringstream::pos_type(-1))
-                {
-                    std::string str = stream.str();
-                    auto position = static_cast<std::iterator_traits<std::string::const_iterator>::difference_type>(stream.tellg());
-                    std::size_t lineNumber = std::count(str.begin(), str.begin() + position, '\n') + 1;
-                    throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
-                }
-                else
-                    throw Exception{"Error while parsing input. " + error};
+                const std::size_t lineNumber = std::count(input.begin, input.pos, '\n') + 1;
+                throw Exception{"Error while parsing input at line " + to_string(lineNumber) + ". " + error};
             }
         }
 
@@ -536,6 +1007,54 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<DataIO::Node> DataIO::parseBinary(const char* data, std::size_t size)
+    {
+        BinaryReader reader{data, size};
+        reader.readHeader();
+        reader.readStringTable();
+
+        auto root = std::make_unique<Node>();
+        reader.readNode(*root);
+
+        if (!reader.atEnd())
+            throw Exception{"Invalid binary widget file. Unexpected data found after the root node."};
+
+        return root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DataIO::emitBinary(const std::unique_ptr<Node>& rootNode, std::string& output)
+    {
+        // The nodes are written first to collect the strings, but the string table has to come before them in the output
+        StringTable table;
+        std::string nodeData;
+        emitBinaryNode(*rootNode, nodeData, table);
+
+        output.append(binaryMagic, sizeof(binaryMagic));
+        writeUInt16(output, binaryVersion);
+
+        writeUInt32(output, static_cast<std::uint32_t>(table.strings.size()));
+        for (const auto& str : table.strings)
+        {
+            writeUInt32(output, static_cast<std::uint32_t>(str.size()));
+            output.append(str);
+        }
+
+        output.append(nodeData);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string DataIO::convertToBinary(const std::string& text)
+    {
+        std::string output;
+        emitBinary(parse(text.data(), text.size()), output);
+        return output;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
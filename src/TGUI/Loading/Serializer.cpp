@@ -166,7 +166,7 @@ namespace tgui
                             + ", " + to_string(texture.getData()->rect.width) + ", " + to_string(texture.getData()->rect.height) + ")";
             }
 
-            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->texture.getSize().x), static_cast<int>(texture.getData()->texture.getSize().y)})
+            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getImageSize().x), static_cast<int>(texture.getImageSize().y)})
             {
                 result += " Middle(" + to_string(texture.getMiddleRect().left) + ", " + to_string(texture.getMiddleRect().top)
                               + ", " + to_string(texture.getMiddleRect().width) + ", " + to_string(texture.getMiddleRect().height) + ")";
@@ -207,20 +207,31 @@ namespace tgui
 
         std::string serializeRendererData(ObjectConverter&& value)
         {
+            const auto& propertyValuePairs = value.getRenderer()->propertyValuePairs;
+
+            // The properties are stored in a hash table, sort them so that nested renderers are always written in the same order
+            std::vector<PropertyId> properties;
+            properties.reserve(propertyValuePairs.size());
+            for (const auto& pair : propertyValuePairs)
+                properties.push_back(pair.first);
+            RendererData::sortByName(properties);
+
             auto node = std::make_unique<DataIO::Node>();
-            for (const auto& pair : value.getRenderer()->propertyValuePairs)
+            for (const auto& property : properties)
             {
+                const ObjectConverter& propertyValue = propertyValuePairs.at(property);
+
                 sf::String strValue;
-                if (pair.second.getType() == ObjectConverter::Type::RendererData)
+                if (propertyValue.getType() == ObjectConverter::Type::RendererData)
                 {
-                    std::stringstream ss{ObjectConverter{pair.second}.getString()};
+                    std::stringstream ss{ObjectConverter{propertyValue}.getString()};
                     node->children.push_back(DataIO::parse(ss));
-                    node->children.back()->name = pair.first;
+                    node->children.back()->name = property.getName();
                 }
                 else
                 {
-                    strValue = ObjectConverter{pair.second}.getString();
-                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(strValue);
+                    strValue = ObjectConverter{propertyValue}.getString();
+                    node->propertyValuePairs[property.getName()] = std::make_unique<DataIO::ValueNode>(strValue);
                 }
             }
 
@@ -26,6 +26,7 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Global.hpp>
+#include <SFML/System/Err.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -253,6 +254,25 @@ namespace tgui
     {
         if (m_defaultTheme == this)
             setDefault(nullptr);
+
+        // The renderers can outlive the theme, make sure they aren't left waiting for a commit that will never come.
+        // An observer that throws can't be allowed to leave the destructor, nor to keep the other renderers in the batch.
+        if (m_batchDepth > 0)
+        {
+            m_batchDepth = 0;
+            for (auto& pair : m_renderers)
+            {
+                try
+                {
+                    pair.second->batchDepth = 1;
+                    pair.second->commitBatch();
+                }
+                catch (const std::exception& e)
+                {
+                    TGUI_PRINT_WARNING("exception thrown while committing the pending changes of a destroyed theme: " << e.what());
+                }
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -266,65 +286,62 @@ namespace tgui
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
-
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
 
-            auto& properties = m_themeLoader->load(m_primary, pair.first);
+            auto rendererData = m_themeLoader->loadRenderer(m_primary, pair.first);
 
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
-            for (const auto& property : properties)
-                renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
-
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
-            auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
-            {
-                if (oldIt->first < newIt->first)
-                {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
+            std::unordered_map<PropertyId, ObjectConverter> oldProperties;
+            oldProperties.swap(renderer->propertyValuePairs);
+            renderer->propertyValuePairs = std::move(rendererData->propertyValuePairs);
 
-                    ++oldIt;
-                }
-                else
-                {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
-
-                    if (newIt->first < oldIt->first)
-                        ++newIt;
-                    else
-                    {
-                        ++oldIt;
-                        ++newIt;
-                    }
-                }
-            }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
+            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that
+            // were now reset to their default value. The widgets are only updated at the end, after all properties were set.
+            renderer->beginBatch();
 
-                ++oldIt;
+            for (const auto& newProperty : renderer->propertyValuePairs)
+            {
+                // Update new and changed properties
+                const auto oldIt = oldProperties.find(newProperty.first);
+                if ((oldIt == oldProperties.end()) || (oldIt->second != newProperty.second))
+                    renderer->notifyPropertyChanged(newProperty.first);
             }
-            while (newIt != renderer->propertyValuePairs.end())
+            for (const auto& oldProperty : oldProperties)
             {
-                for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
-
-                ++newIt;
+                // Update values that no longer exist in the new renderer and are now reset to the default value
+                if (renderer->propertyValuePairs.find(oldProperty.first) == renderer->propertyValuePairs.end())
+                    renderer->notifyPropertyChanged(oldProperty.first);
             }
+
+            renderer->commitBatch();
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Theme::beginBatch()
+    {
+        if (m_batchDepth++ > 0)
+            return;
+
+        for (auto& pair : m_renderers)
+            pair.second->beginBatch();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::commitBatch()
+    {
+        if ((m_batchDepth == 0) || (--m_batchDepth > 0))
+            return;
+
+        for (auto& pair : m_renderers)
+            pair.second->commitBatch();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<RendererData> Theme::getRenderer(const std::string& id)
     {
         std::string lowercaseSecondary = toLower(id);
@@ -335,9 +352,11 @@ namespace tgui
             return it->second;
 
         m_renderers[lowercaseSecondary] = RendererData::create();
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        if (m_batchDepth > 0)
+            m_renderers[lowercaseSecondary]->beginBatch();
+
+        auto rendererData = m_themeLoader->loadRenderer(m_primary, lowercaseSecondary);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = std::move(rendererData->propertyValuePairs);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -354,13 +373,14 @@ namespace tgui
             return it->second;
 
         m_renderers[lowercaseSecondary] = RendererData::create();
+        if (m_batchDepth > 0)
+            m_renderers[lowercaseSecondary]->beginBatch();
 
         if (!m_themeLoader->canLoad(m_primary, lowercaseSecondary))
             return nullptr;
 
-        auto& properties = m_themeLoader->load(m_primary, lowercaseSecondary);
-        for (const auto& property : properties)
-            m_renderers[lowercaseSecondary]->propertyValuePairs[property.first] = ObjectConverter(property.second);
+        auto rendererData = m_themeLoader->loadRenderer(m_primary, lowercaseSecondary);
+        m_renderers[lowercaseSecondary]->propertyValuePairs = std::move(rendererData->propertyValuePairs);
 
         return m_renderers[lowercaseSecondary];
     }
@@ -369,6 +389,14 @@ namespace tgui
 
     void Theme::addRenderer(const std::string& id, std::shared_ptr<RendererData> renderer)
     {
+        // A renderer that is replaced is no longer part of the batch, so its widgets have to be updated now
+        auto it = m_renderers.find(toLower(id));
+        if ((it != m_renderers.end()) && (m_batchDepth > 0))
+            it->second->commitBatch();
+
+        if (m_batchDepth > 0)
+            renderer->beginBatch();
+
         m_renderers[toLower(id)] = renderer;
     }
 
@@ -379,6 +407,9 @@ namespace tgui
         auto it = m_renderers.find(toLower(id));
         if (it != m_renderers.end())
         {
+            if (m_batchDepth > 0)
+                it->second->commitBatch();
+
             m_renderers.erase(it);
             return true;
         }
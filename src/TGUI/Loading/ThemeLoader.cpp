@@ -26,7 +26,10 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Global.hpp>
+#include <SFML/System/Clock.hpp>
 
 #include <cassert>
 #include <sstream>
@@ -53,6 +56,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    std::map<std::string, DefaultThemeLoader::CachedTheme> DefaultThemeLoader::m_themeCache;
+    bool DefaultThemeLoader::m_imagePreloadingEnabled = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -105,7 +110,8 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        void resolveReferences(std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections, const std::unique_ptr<DataIO::Node>& node)
+        void resolveReferences(std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections,
+                               std::map<const DataIO::ValueNode*, const DataIO::Node*>& references, const std::unique_ptr<DataIO::Node>& node)
         {
             for (const auto& pair : node->propertyValuePairs)
             {
@@ -119,7 +125,8 @@ namespace tgui
                         throw Exception{"Undefined reference to '" + name + "' encountered."};
 
                     // Resolve references recursively
-                    resolveReferences(sections, sectionsIt->second);
+                    resolveReferences(sections, references, sectionsIt->second);
+                    references[pair.second.get()] = sectionsIt->second.get().get();
 
                     // Make a copy of the section
                     std::stringstream ss;
@@ -129,7 +136,67 @@ namespace tgui
             }
 
             for (const auto& child : node->children)
-                resolveReferences(sections, child);
+                resolveReferences(sections, references, child);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool isAbsolutePath(const std::string& filename)
+        {
+        #ifdef SFML_SYSTEM_WINDOWS
+            return (filename[0] == '/') || (filename[0] == '\\') || ((filename.size() > 1) && (filename[1] == ':'));
+        #else
+            return (filename[0] == '/');
+        #endif
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Extracts the filename from a serialized texture in the same way as the deserializer and Texture::load would
+        std::string getTextureFilename(const std::string& value)
+        {
+            if (value.empty() || (toLower(value) == "none") || (value == "null") || (value == "nullptr"))
+                return "";
+
+            std::string filename;
+            if (value[0] != '"')
+            {
+                filename = isAbsolutePath(value) ? value : getResourcePath() + value;
+            }
+            else
+            {
+                char prev = '\0';
+                auto c = value.begin() + 1;
+                while ((c != value.end()) && ((*c != '"') || (prev == '\\')))
+                {
+                    prev = *c;
+                    filename.push_back(*c);
+                    ++c;
+                }
+
+                if ((c == value.end()) || filename.empty())
+                    return "";
+            }
+
+            return isAbsolutePath(filename) ? filename : getResourcePath() + filename;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void collectImageFilenames(const DataIO::Node& node, std::set<std::string>& filenames)
+        {
+            for (const auto& pair : node.propertyValuePairs)
+            {
+                if ((pair.first.size() >= 7) && (toLower(pair.first.substr(0, 7)) == "texture"))
+                {
+                    const std::string filename = getTextureFilename(pair.second->value);
+                    if (!filename.empty())
+                        filenames.insert(filename);
+                }
+            }
+
+            for (const auto& child : node.children)
+                collectImageFilenames(*child, filenames);
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -143,6 +210,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<RendererData> BaseThemeLoader::loadRenderer(const std::string& primary, const std::string& secondary)
+    {
+        auto rendererData = RendererData::create();
+        for (const auto& property : load(primary, secondary))
+            rendererData->propertyValuePairs[PropertyId{property.first}] = ObjectConverter(property.second);
+
+        return rendererData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
         if (filename != "")
@@ -150,10 +228,21 @@ namespace tgui
             auto propertiesCacheIt = m_propertiesCache.find(filename);
             if (propertiesCacheIt != m_propertiesCache.end())
                 m_propertiesCache.erase(propertiesCacheIt);
+
+            auto themeCacheIt = m_themeCache.find(filename);
+            if (themeCacheIt != m_themeCache.end())
+            {
+                TextureManager::removePreloadedImages(themeCacheIt->second.images);
+                m_themeCache.erase(themeCacheIt);
+            }
         }
         else
         {
+            for (const auto& pair : m_themeCache)
+                TextureManager::removePreloadedImages(pair.second.images);
+
             m_propertiesCache.clear();
+            m_themeCache.clear();
         }
     }
 
@@ -165,8 +254,10 @@ namespace tgui
             return;
 
         // Load the file when not already in cache
-        if (m_propertiesCache.find(filename) == m_propertiesCache.end())
+        if (m_themeCache.find(filename) == m_themeCache.end())
         {
+            sf::Clock clock;
+
             std::string resourcePath;
             auto slashPos = filename.find_last_of("/\\");
             if (slashPos != std::string::npos)
@@ -195,8 +286,9 @@ namespace tgui
                 sections.emplace(name, std::cref(child));
             }
 
-            // Resolve references to sections
-            resolveReferences(sections, root);
+            // Resolve references to sections. The referenced nodes are remembered so that renderers can be created from them directly.
+            CachedTheme cachedTheme;
+            resolveReferences(sections, cachedTheme.references, root);
 
             // Cache all propery value pairs
             for (const auto& section : sections)
@@ -213,6 +305,25 @@ namespace tgui
                     m_propertiesCache[filename][name][toLower(nestedProperty->name)] = "{\n" + ss.str() + "}";
                 }
             }
+
+            for (const auto& section : sections)
+                cachedTheme.sections[section.first] = section.second.get().get();
+
+            m_propertiesCache[filename]; // Also cache files without sections
+            cachedTheme.root = std::move(root);
+            cachedTheme.parseTime = clock.getElapsedTime();
+
+            // Start decoding the images of the theme on worker threads
+            if (m_imagePreloadingEnabled)
+            {
+                std::set<std::string> imageFilenames;
+                collectImageFilenames(*cachedTheme.root, imageFilenames);
+
+                cachedTheme.images.assign(imageFilenames.begin(), imageFilenames.end());
+                cachedTheme.imageDecodeTime = TextureManager::preloadImages(cachedTheme.images);
+            }
+
+            m_themeCache[filename] = std::move(cachedTheme);
         }
     }
 
@@ -236,6 +347,76 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<RendererData> DefaultThemeLoader::loadRenderer(const std::string& filename, const std::string& section)
+    {
+        preload(filename);
+
+        // An empty filename is not considered an error and will result in an empty renderer
+        if (filename.empty())
+            return RendererData::create();
+
+        const CachedTheme& cachedTheme = m_themeCache[filename];
+        auto sectionIt = cachedTheme.sections.find(toLower(section));
+        if (sectionIt == cachedTheme.sections.end())
+            throw Exception{"No section '" + section + "' was found in file '" + filename + "'."};
+
+        return createRendererData(cachedTheme, *sectionIt->second);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DefaultThemeLoader::setImagePreloadingEnabled(bool preload)
+    {
+        m_imagePreloadingEnabled = preload;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DefaultThemeLoader::isImagePreloadingEnabled()
+    {
+        return m_imagePreloadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DefaultThemeLoader::LoadTimings DefaultThemeLoader::getLoadTimings(const std::string& filename)
+    {
+        LoadTimings timings;
+
+        auto themeIt = m_themeCache.find(filename);
+        if (themeIt == m_themeCache.end())
+            return timings;
+
+        timings.parseTime = themeIt->second.parseTime;
+        timings.images = themeIt->second.images.size();
+        if (themeIt->second.imageDecodeTime.valid())
+            timings.imageDecodeTime = themeIt->second.imageDecodeTime.get();
+
+        return timings;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<RendererData> DefaultThemeLoader::createRendererData(const CachedTheme& cachedTheme, const DataIO::Node& node)
+    {
+        auto rendererData = RendererData::create();
+        for (const auto& pair : node.propertyValuePairs)
+        {
+            auto referenceIt = cachedTheme.references.find(pair.second.get());
+            if (referenceIt != cachedTheme.references.end())
+                rendererData->propertyValuePairs[pair.first] = ObjectConverter(createRendererData(cachedTheme, *referenceIt->second));
+            else
+                rendererData->propertyValuePairs[pair.first] = ObjectConverter(pair.second->value);
+        }
+
+        for (const auto& child : node.children)
+            rendererData->propertyValuePairs[toLower(child->name)] = ObjectConverter(createRendererData(cachedTheme, *child));
+
+        return rendererData;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool DefaultThemeLoader::canLoad(const std::string& filename, const std::string& section)
     {
         if (filename.empty())
@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/PrimitiveBuilder.hpp>
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const float pi = 3.14159265358979f;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBuilder::addRectangle(std::vector<sf::Vertex>& vertices, Vector2f position, Vector2f size, const sf::Color& color)
+    {
+        if ((size.x <= 0) || (size.y <= 0))
+            return;
+
+        const sf::Vector2f topLeft = {position.x, position.y};
+        const sf::Vector2f topRight = {position.x + size.x, position.y};
+        const sf::Vector2f bottomLeft = {position.x, position.y + size.y};
+        const sf::Vector2f bottomRight = {position.x + size.x, position.y + size.y};
+
+        vertices.emplace_back(topLeft, color);
+        vertices.emplace_back(topRight, color);
+        vertices.emplace_back(bottomLeft, color);
+        vertices.emplace_back(bottomLeft, color);
+        vertices.emplace_back(topRight, color);
+        vertices.emplace_back(bottomRight, color);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBuilder::addBorders(std::vector<sf::Vertex>& vertices, Vector2f position, Vector2f size, const Borders& borders, const sf::Color& color)
+    {
+        // If size is too small then draw entire size as border
+        if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
+        {
+            addRectangle(vertices, position, size, color);
+            return;
+        }
+
+        const float innerHeight = size.y - borders.getTop() - borders.getBottom();
+        addRectangle(vertices, position, {size.x, borders.getTop()}, color);
+        addRectangle(vertices, {position.x, position.y + size.y - borders.getBottom()}, {size.x, borders.getBottom()}, color);
+        addRectangle(vertices, {position.x, position.y + borders.getTop()}, {borders.getLeft(), innerHeight}, color);
+        addRectangle(vertices, {position.x + size.x - borders.getRight(), position.y + borders.getTop()}, {borders.getRight(), innerHeight}, color);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBuilder::addTriangle(std::vector<sf::Vertex>& vertices, Vector2f point1, Vector2f point2, Vector2f point3, const sf::Color& color)
+    {
+        vertices.emplace_back(sf::Vector2f{point1.x, point1.y}, color);
+        vertices.emplace_back(sf::Vector2f{point2.x, point2.y}, color);
+        vertices.emplace_back(sf::Vector2f{point3.x, point3.y}, color);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBuilder::addCircle(std::vector<sf::Vertex>& vertices, Vector2f center, float radius, const sf::Color& color, unsigned int pointCount)
+    {
+        // Start at the top of the circle, like sf::CircleShape does
+        addArc(vertices, center, 0, radius, -90, 270, color, pointCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBuilder::addRing(std::vector<sf::Vertex>& vertices, Vector2f center, float innerRadius, float outerRadius, const sf::Color& color, unsigned int pointCount)
+    {
+        addArc(vertices, center, innerRadius, outerRadius, -90, 270, color, pointCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void PrimitiveBuilder::addArc(std::vector<sf::Vertex>& vertices, Vector2f center, float innerRadius, float outerRadius,
+                                  float startAngle, float endAngle, const sf::Color& color, unsigned int pointCount)
+    {
+        if ((outerRadius <= 0) || (outerRadius <= innerRadius) || (pointCount == 0))
+            return;
+
+        float sweep = endAngle - startAngle;
+        if (sweep < 0)
+            sweep += 360;
+        if (sweep <= 0)
+            return;
+        if (sweep > 360)
+            sweep = 360;
+
+        const unsigned int segments = std::max(1u, static_cast<unsigned int>(std::ceil(pointCount * sweep / 360)));
+        const float step = sweep / segments * pi / 180;
+        const float start = startAngle * pi / 180;
+
+        sf::Vector2f previousDirection = {std::cos(start), std::sin(start)};
+        for (unsigned int i = 1; i <= segments; ++i)
+        {
+            const sf::Vector2f direction = {std::cos(start + i * step), std::sin(start + i * step)};
+
+            const sf::Vector2f outer1 = {center.x + previousDirection.x * outerRadius, center.y + previousDirection.y * outerRadius};
+            const sf::Vector2f outer2 = {center.x + direction.x * outerRadius, center.y + direction.y * outerRadius};
+            if (innerRadius <= 0)
+            {
+                vertices.emplace_back(sf::Vector2f{center.x, center.y}, color);
+                vertices.emplace_back(outer1, color);
+                vertices.emplace_back(outer2, color);
+            }
+            else
+            {
+                const sf::Vector2f inner1 = {center.x + previousDirection.x * innerRadius, center.y + previousDirection.y * innerRadius};
+                const sf::Vector2f inner2 = {center.x + direction.x * innerRadius, center.y + direction.y * innerRadius};
+
+                vertices.emplace_back(inner1, color);
+                vertices.emplace_back(outer1, color);
+                vertices.emplace_back(outer2, color);
+                vertices.emplace_back(inner1, color);
+                vertices.emplace_back(outer2, color);
+                vertices.emplace_back(inner2, color);
+            }
+
+            previousDirection = direction;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
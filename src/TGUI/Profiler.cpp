@@ -0,0 +1,347 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Profiler.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct TraceEvent
+        {
+            Profiler::Category category;
+            std::string label;
+            std::int64_t start;
+            std::int64_t duration;
+        };
+
+        struct FrameMarker
+        {
+            std::int64_t time;
+            std::size_t drawCalls;
+            std::size_t clippingScopes;
+            std::size_t allocations;
+        };
+
+        bool enabled = false;
+
+        std::chrono::steady_clock::time_point startTime;
+        std::int64_t frameStartTime = 0;
+
+        Profiler::FrameStatistics currentFrame;
+        Profiler::FrameStatistics lastFrame;
+        std::unordered_map<std::string, std::size_t> currentFrameScopeIndices;
+        std::atomic<std::size_t> allocationCount{0};
+
+        std::vector<TraceEvent> traceEvents;
+        std::vector<FrameMarker> frameMarkers;
+        std::size_t maxTraceEvents = 1000000;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the amount of nanoseconds since the profiler was enabled
+        std::int64_t now()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime).count();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void writeJsonString(std::ostream& stream, const std::string& str)
+        {
+            stream << '"';
+            for (const char c : str)
+            {
+                if ((c == '"') || (c == '\\'))
+                    stream << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 32)
+                    stream << ' ';
+                else
+                    stream << c;
+            }
+            stream << '"';
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Trace event timestamps are in microseconds
+        void writeMicroseconds(std::ostream& stream, std::int64_t nanoseconds)
+        {
+            stream << (nanoseconds / 1000) << '.';
+            const std::int64_t fraction = nanoseconds % 1000;
+            if (fraction < 100)
+                stream << '0';
+            if (fraction < 10)
+                stream << '0';
+            stream << fraction;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void addMeasurement(Profiler::Category category, std::string&& label, std::int64_t start, std::int64_t duration)
+        {
+            std::string key = static_cast<char>('0' + static_cast<int>(category)) + label;
+            const auto it = currentFrameScopeIndices.find(key);
+            if (it != currentFrameScopeIndices.end())
+            {
+                auto& scope = currentFrame.scopes[it->second];
+                ++scope.calls;
+                scope.time += sf::microseconds(duration / 1000);
+            }
+            else
+            {
+                Profiler::ScopeStatistics scope;
+                scope.category = category;
+                scope.label = label;
+                scope.calls = 1;
+                scope.time = sf::microseconds(duration / 1000);
+                currentFrameScopeIndices[std::move(key)] = currentFrame.scopes.size();
+                currentFrame.scopes.push_back(std::move(scope));
+            }
+
+            if (traceEvents.size() < maxTraceEvents)
+                traceEvents.push_back({category, std::move(label), start, duration});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::Scope(Category category) :
+        m_category {category},
+        m_recording{enabled}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Profiler::Scope::~Scope()
+    {
+        // The profiler could have been disabled or restarted while measuring
+        if (m_started && enabled && (m_startTime >= frameStartTime))
+            addMeasurement(m_category, std::move(m_label), m_startTime, now() - m_startTime);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::Scope::start(const std::string& label)
+    {
+        m_label = label;
+        m_started = true;
+        m_startTime = now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::Scope::start(const std::string& type, const sf::String& name)
+    {
+        if (name.isEmpty())
+            m_label = type;
+        else
+            m_label = type + " \"" + name.toAnsiString() + "\"";
+
+        m_started = true;
+        m_startTime = now();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isAvailable()
+    {
+    #ifdef TGUI_ENABLE_PROFILER
+        return true;
+    #else
+        return false;
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setEnabled(bool enable)
+    {
+        if (!isAvailable() || (enable == enabled))
+            return;
+
+        enabled = enable;
+        if (enabled)
+        {
+            startTime = std::chrono::steady_clock::now();
+            frameStartTime = 0;
+            currentFrame = {};
+            lastFrame = {};
+            currentFrameScopeIndices.clear();
+            allocationCount = 0;
+            traceEvents.clear();
+            frameMarkers.clear();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::isEnabled()
+    {
+        return enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::endFrame(const DrawBatch::Statistics& drawStatistics)
+    {
+        if (!enabled)
+            return;
+
+        const std::int64_t frameEndTime = now();
+        currentFrame.duration = sf::microseconds((frameEndTime - frameStartTime) / 1000);
+        currentFrame.drawCalls = drawStatistics.drawCalls;
+        currentFrame.vertices = drawStatistics.vertices;
+        currentFrame.allocations = allocationCount.exchange(0);
+
+        std::sort(currentFrame.scopes.begin(), currentFrame.scopes.end(),
+                  [](const ScopeStatistics& left, const ScopeStatistics& right){ return left.time > right.time; });
+
+        if (traceEvents.size() < maxTraceEvents)
+            frameMarkers.push_back({frameEndTime, currentFrame.drawCalls, currentFrame.clippingScopes, currentFrame.allocations});
+
+        const std::size_t frame = currentFrame.frame;
+        lastFrame = std::move(currentFrame);
+        currentFrame = {};
+        currentFrame.frame = frame + 1;
+        currentFrameScopeIndices.clear();
+        frameStartTime = frameEndTime;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Profiler::FrameStatistics& Profiler::getLastFrame()
+    {
+        return lastFrame;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::addClippingScope()
+    {
+        if (enabled)
+            ++currentFrame.clippingScopes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::addAllocation()
+    {
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::setMaxTraceEvents(std::size_t maxEvents)
+    {
+        maxTraceEvents = maxEvents;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Profiler::writeTrace(std::ostream& stream)
+    {
+        stream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        bool first = true;
+        for (const auto& event : traceEvents)
+        {
+            if (!first)
+                stream << ",";
+            first = false;
+
+            stream << "\n{\"name\":";
+            writeJsonString(stream, event.label);
+            stream << ",\"cat\":\"" << getCategoryName(event.category) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":";
+            writeMicroseconds(stream, event.start);
+            stream << ",\"dur\":";
+            writeMicroseconds(stream, event.duration);
+            stream << "}";
+        }
+
+        // The frame counters are shown as graphs above the measurements
+        for (const auto& marker : frameMarkers)
+        {
+            if (!first)
+                stream << ",";
+            first = false;
+
+            stream << "\n{\"name\":\"frame\",\"ph\":\"C\",\"pid\":1,\"ts\":";
+            writeMicroseconds(stream, marker.time);
+            stream << ",\"args\":{\"drawCalls\":" << marker.drawCalls << ",\"clippingScopes\":" << marker.clippingScopes
+                   << ",\"allocations\":" << marker.allocations << "}}";
+        }
+
+        stream << "\n]}\n";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Profiler::saveTrace(const std::string& filename)
+    {
+        std::ofstream out{filename};
+        if (!out.is_open())
+            return false;
+
+        writeTrace(out);
+        return static_cast<bool>(out);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* Profiler::getCategoryName(Category category)
+    {
+        switch (category)
+        {
+            case Category::Draw:
+                return "draw";
+            case Category::Update:
+                return "update";
+            case Category::Event:
+                return "event";
+            case Category::RendererChanged:
+                return "rendererChanged";
+            case Category::Layout:
+                return "layout";
+            case Category::Text:
+                return "text";
+        }
+
+        return "";
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/PropertyId.hpp>
+#include <TGUI/Global.hpp>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct PropertyNameTable
+        {
+            PropertyNameTable()
+            {
+                #define TGUI_PROPERTY_ID_INTERN(NAME) intern(toLower(#NAME));
+                TGUI_BUILTIN_PROPERTY_IDS(TGUI_PROPERTY_ID_INTERN)
+                #undef TGUI_PROPERTY_ID_INTERN
+            }
+
+            std::uint32_t intern(const std::string& name)
+            {
+                const auto it = indices.find(name);
+                if (it != indices.end())
+                    return it->second;
+
+                // A deque is used because it never moves its elements, so the names returned by getName stay valid
+                names.push_back(name);
+                const auto index = static_cast<std::uint32_t>(names.size() - 1);
+                indices.emplace(name, index);
+                return index;
+            }
+
+            std::mutex mutex;
+            std::deque<std::string> names;
+            std::unordered_map<std::string, std::uint32_t> indices;
+        };
+
+        PropertyNameTable& getPropertyNameTable()
+        {
+            static PropertyNameTable table;
+            return table;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId::PropertyId(const std::string& name)
+    {
+        auto& table = getPropertyNameTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        m_index = table.intern(name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    PropertyId::PropertyId(const char* name) :
+        PropertyId{std::string{name}}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& PropertyId::getName() const
+    {
+        auto& table = getPropertyNameTable();
+        std::lock_guard<std::mutex> lock(table.mutex);
+        return table.names[m_index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -54,12 +54,12 @@ namespace tgui
 
     float ChildWindowRenderer::getTitleBarHeight() const
     {
-        auto it = m_data->propertyValuePairs.find("titlebarheight");
+        auto it = m_data->propertyValuePairs.find(PropertyId::TitleBarHeight);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getNumber();
         else
         {
-            it = m_data->propertyValuePairs.find("texturetitlebar");
+            it = m_data->propertyValuePairs.find(PropertyId::TextureTitleBar);
             if (it != m_data->propertyValuePairs.end() && it->second.getTexture().getData())
                 return it->second.getTexture().getImageSize().y;
             else
@@ -71,7 +71,7 @@ namespace tgui
 
     void ChildWindowRenderer::setTitleBarHeight(float number)
     {
-        setProperty("titlebarheight", ObjectConverter{number});
+        setProperty(PropertyId::TitleBarHeight, ObjectConverter{number});
     }
 }
 
@@ -43,21 +43,21 @@ namespace tgui
         else if (opacity > 1)
             opacity = 1;
 
-        setProperty("opacity", ObjectConverter{opacity});
+        setProperty(PropertyId::Opacity, ObjectConverter{opacity});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        setProperty(PropertyId::Font, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
+        auto it = m_data->propertyValuePairs.find(PropertyId::Font);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -68,14 +68,25 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        setProperty(PropertyId{toLower(property)}, std::move(value));
+    }
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
-        {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::setProperty(const char* property, ObjectConverter&& value)
+    {
+        setProperty(PropertyId{toLower(property)}, std::move(value));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
+    void WidgetRenderer::setProperty(PropertyId property, ObjectConverter&& value)
+    {
+        ObjectConverter& storedValue = m_data->propertyValuePairs[property];
+        if (storedValue != value)
+        {
+            storedValue = std::move(value);
+            m_data->notifyPropertyChanged(property);
         }
     }
 
@@ -83,7 +94,21 @@ namespace tgui
 
     ObjectConverter WidgetRenderer::getProperty(const std::string& property) const
     {
-        auto it = m_data->propertyValuePairs.find(toLower(property));
+        return getProperty(PropertyId{toLower(property)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter WidgetRenderer::getProperty(const char* property) const
+    {
+        return getProperty(PropertyId{toLower(property)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter WidgetRenderer::getProperty(PropertyId property) const
+    {
+        auto it = m_data->propertyValuePairs.find(property);
         if (it != m_data->propertyValuePairs.end())
             return it->second;
         else
@@ -92,14 +117,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    const std::unordered_map<PropertyId, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
     {
         return m_data->propertyValuePairs;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(PropertyId property)>& function)
     {
         m_data->observers[id] = function;
     }
@@ -131,6 +156,8 @@ namespace tgui
     {
         auto data = std::make_shared<RendererData>(*m_data);
         data->observers = {};
+        data->batchDepth = 0;
+        data->changedProperties = {};
         return data;
     }
 
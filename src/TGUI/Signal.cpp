@@ -28,6 +28,7 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <algorithm>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,7 +59,25 @@ namespace tgui
 {
     namespace internal_signal
     {
-        std::deque<const void*> parameters;
+        const void* parameters[3];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal::~Signal()
+    {
+        // If the signal is destroyed by one of its own handlers then let the emit function know that it should stop.
+        // The handlers are kept alive by the outermost emit, as some of them are still being executed.
+        if (m_emitGuard)
+        {
+            m_emitGuard->signalDestroyed = true;
+
+            EmitGuard* outermostGuard = m_emitGuard;
+            while (outermostGuard->outerGuard)
+                outermostGuard = outermostGuard->outerGuard;
+
+            outermostGuard->orphanedHandlers = std::move(m_handlers);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,12 +90,42 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Signal::Signal(Signal&& other) :
+        m_name                          {std::move(other.m_name)},
+        m_handlers                      {std::move(other.m_handlers)},
+        m_handlersConnectedWhileEmitting{std::move(other.m_handlersConnectedWhileEmitting)},
+        m_pendingChanges                {other.m_pendingChanges}
+    {
+        assert(!other.m_emitGuard); // Signals can't be moved while they are being emitted
+        applyPendingChanges();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& Signal::operator=(const Signal& other)
     {
         if (this != &other)
         {
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            disconnectAll(); // signal handlers are not copied with the widget
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& Signal::operator=(Signal&& other)
+    {
+        if (this != &other)
+        {
+            assert(!m_emitGuard && !other.m_emitGuard); // Signals can't be moved while they are being emitted
+
+            m_name = std::move(other.m_name);
+            m_handlers = std::move(other.m_handlers);
+            m_handlersConnectedWhileEmitting = std::move(other.m_handlersConnectedWhileEmitting);
+            m_pendingChanges = other.m_pendingChanges;
+            applyPendingChanges();
         }
 
         return *this;
@@ -86,39 +135,111 @@ namespace tgui
 
     unsigned int Signal::connect(const Delegate& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = handler;
-        return id;
+        return addHandler(Delegate{handler});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Signal::connect(const DelegateEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        if (id == 0)
+            return false;
+
+        for (auto it = m_handlersConnectedWhileEmitting.begin(); it != m_handlersConnectedWhileEmitting.end(); ++it)
+        {
+            if (it->id == id)
+            {
+                m_handlersConnectedWhileEmitting.erase(it);
+                return true;
+            }
+        }
+
+        for (auto it = m_handlers.begin(); it != m_handlers.end(); ++it)
+        {
+            if (it->id != id)
+                continue;
+
+            // The handler might be executing right now, so it is only removed when the signal is no longer being emitted
+            if (m_emitGuard)
+            {
+                it->id = 0;
+                m_pendingChanges = true;
+            }
+            else
+                m_handlers.erase(it);
+
+            return true;
+        }
+
+        return false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        m_handlersConnectedWhileEmitting.clear();
+
+        if (m_emitGuard)
+        {
+            for (auto& handler : m_handlers)
+                handler.id = 0;
+
+            m_pendingChanges = true;
+        }
+        else
+            m_handlers.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::addHandler(std::function<void()>&& handler)
+    {
+        const auto id = generateUniqueId();
+
+        // Adding an element to m_handlers while emitting could reallocate it and destroy the handler that is being executed
+        if (m_emitGuard)
+        {
+            m_handlersConnectedWhileEmitting.push_back({id, std::move(handler)});
+            m_pendingChanges = true;
+        }
+        else
+            m_handlers.push_back({id, std::move(handler)});
+
+        return id;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Signal::applyPendingChanges()
+    {
+        if (!m_pendingChanges)
+            return;
+
+        m_handlers.erase(std::remove_if(m_handlers.begin(), m_handlers.end(), [](const Handler& handler){ return handler.id == 0; }),
+                         m_handlers.end());
+
+        for (auto& handler : m_handlersConnectedWhileEmitting)
+            m_handlers.push_back(std::move(handler));
+
+        m_handlersConnectedWhileEmitting.clear();
+        m_pendingChanges = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Widget::Ptr Signal::getWidget()
     {
-        return internal_signal::dereference<Widget*>(internal_signal::parameters[0])->shared_from_this();
+        // Signals that don't belong to a widget (e.g. in the TextureManager) are emitted without a sender
+        Widget* widget = internal_signal::dereference<Widget*>(internal_signal::parameters[0]);
+        return widget ? widget->shared_from_this() : nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,16 +258,12 @@ namespace tgui
     #define TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(TypeName, Type) \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return addHandler([handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
     } \
     \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }); \
     }
 
     TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Int, int)
@@ -221,18 +338,14 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalRange::connect(const DelegateRangeEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,18 +374,14 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -301,36 +410,28 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndIdEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -353,36 +454,28 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalMenuItem::connect(const DelegateMenuItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalMenuItem::connect(const DelegateMenuItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalMenuItem::connect(const DelegateMenuItemFull& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalMenuItem::connect(const DelegateMenuItemFullEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return addHandler([handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,257 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/SpatialIndex.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Widgets that would be stored in more cells than this are added to the list of large widgets instead
+        const int maxCellsPerWidget = 64;
+
+        // Coordinates further away from the origin than this amount of cells aren't stored in the grid
+        const float maxCellIndex = 1000000;
+
+        void removeFromList(std::vector<Widget*>& list, const Widget* widget)
+        {
+            const auto it = std::find(list.begin(), list.end(), widget);
+            if (it != list.end())
+            {
+                *it = list.back();
+                list.pop_back();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SpatialIndex::SpatialIndex(float cellSize) :
+        m_cellSize{cellSize}
+    {
+        assert(cellSize > 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::insert(Widget* widget, std::size_t order, const FloatRect& bounds)
+    {
+        auto it = m_entries.find(widget);
+        if (it != m_entries.end())
+            removeFromCells(widget, it->second);
+        else
+            it = m_entries.insert({widget, Entry{}}).first;
+
+        Entry& entry = it->second;
+        entry.order = order;
+        entry.bounds = bounds;
+        addToCells(widget, entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::update(Widget* widget, const FloatRect& bounds)
+    {
+        const auto it = m_entries.find(widget);
+        assert(it != m_entries.end());
+        if (it == m_entries.end())
+            return;
+
+        Entry& entry = it->second;
+        if ((entry.bounds.left == bounds.left) && (entry.bounds.top == bounds.top)
+         && (entry.bounds.width == bounds.width) && (entry.bounds.height == bounds.height))
+            return;
+
+        // When the widget still overlaps with the same cells then only the bounds have to be updated
+        int left, top, right, bottom;
+        if (!entry.large && getCell(bounds.left, left) && getCell(bounds.top, top)
+         && getCell(bounds.left + bounds.width, right) && getCell(bounds.top + bounds.height, bottom)
+         && (left == entry.left) && (top == entry.top) && (right == entry.right) && (bottom == entry.bottom))
+        {
+            entry.bounds = bounds;
+            return;
+        }
+
+        removeFromCells(widget, entry);
+        entry.bounds = bounds;
+        addToCells(widget, entry);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::setOrder(const Widget* widget, std::size_t order)
+    {
+        const auto it = m_entries.find(widget);
+        if (it != m_entries.end())
+            it->second.order = order;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::remove(const Widget* widget)
+    {
+        const auto it = m_entries.find(widget);
+        if (it == m_entries.end())
+            return;
+
+        removeFromCells(widget, it->second);
+        m_entries.erase(it);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::clear()
+    {
+        m_entries.clear();
+        m_cells.clear();
+        m_largeWidgets.clear();
+        m_queryResult.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SpatialIndex::contains(const Widget* widget) const
+    {
+        return m_entries.find(widget) != m_entries.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SpatialIndex::getSize() const
+    {
+        return m_entries.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Widget*>& SpatialIndex::query(Vector2f point) const
+    {
+        m_queryResult.clear();
+
+        const auto addCandidates = [this,point](const std::vector<Widget*>& candidates)
+            {
+                for (Widget* widget : candidates)
+                {
+                    // The bounds are inclusive on all sides so that no widget can be missed due to rounding
+                    const FloatRect& bounds = m_entries.at(widget).bounds;
+                    if ((point.x >= bounds.left) && (point.x <= bounds.left + bounds.width)
+                     && (point.y >= bounds.top) && (point.y <= bounds.top + bounds.height))
+                        m_queryResult.push_back(widget);
+                }
+            };
+
+        int cellX;
+        int cellY;
+        if (getCell(point.x, cellX) && getCell(point.y, cellY))
+        {
+            const auto it = m_cells.find(getCellKey(cellX, cellY));
+            if (it != m_cells.end())
+                addCandidates(it->second);
+        }
+
+        addCandidates(m_largeWidgets);
+
+        std::sort(m_queryResult.begin(), m_queryResult.end(), [this](const Widget* left, const Widget* right)
+            { return m_entries.at(left).order > m_entries.at(right).order; });
+
+        return m_queryResult;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::addToCells(Widget* widget, Entry& entry)
+    {
+        const FloatRect& bounds = entry.bounds;
+        entry.large = !getCell(bounds.left, entry.left) || !getCell(bounds.top, entry.top)
+                   || !getCell(bounds.left + bounds.width, entry.right) || !getCell(bounds.top + bounds.height, entry.bottom)
+                   || (static_cast<long long>(entry.right - entry.left + 1) * (entry.bottom - entry.top + 1) > maxCellsPerWidget);
+
+        if (entry.large)
+        {
+            m_largeWidgets.push_back(widget);
+            return;
+        }
+
+        for (int x = entry.left; x <= entry.right; ++x)
+        {
+            for (int y = entry.top; y <= entry.bottom; ++y)
+                m_cells[getCellKey(x, y)].push_back(widget);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SpatialIndex::removeFromCells(const Widget* widget, const Entry& entry)
+    {
+        if (entry.large)
+        {
+            removeFromList(m_largeWidgets, widget);
+            return;
+        }
+
+        for (int x = entry.left; x <= entry.right; ++x)
+        {
+            for (int y = entry.top; y <= entry.bottom; ++y)
+            {
+                const auto it = m_cells.find(getCellKey(x, y));
+                if (it == m_cells.end())
+                    continue;
+
+                removeFromList(it->second, widget);
+                if (it->second.empty())
+                    m_cells.erase(it);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SpatialIndex::getCell(float value, int& cell) const
+    {
+        const float cellIndex = std::floor(value / m_cellSize);
+        if (!(std::abs(cellIndex) <= maxCellIndex)) // Also fails for NaN
+            return false;
+
+        cell = static_cast<int>(cellIndex);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t SpatialIndex::getCellKey(int x, int y)
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,9 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/Profiler.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
 
@@ -44,6 +47,7 @@ namespace tgui
     void Text::setString(const sf::String& string)
     {
         m_text.setString(string);
+        m_verticesNeedUpdate = true;
         recalculateSize();
     }
 
@@ -59,6 +63,7 @@ namespace tgui
     void Text::setCharacterSize(unsigned int size)
     {
         m_text.setCharacterSize(size);
+        m_verticesNeedUpdate = true;
         recalculateSize();
     }
 
@@ -74,6 +79,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
+        m_verticesNeedUpdate = true;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
@@ -94,6 +100,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
+        m_verticesNeedUpdate = true;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
@@ -114,6 +121,7 @@ namespace tgui
     void Text::setFont(Font font)
     {
         m_font = font;
+        m_verticesNeedUpdate = true;
 
         if (font)
             m_text.setFont(*font.getFont());
@@ -152,6 +160,7 @@ namespace tgui
         if (style != m_text.getStyle())
         {
             m_text.setStyle(style);
+            m_verticesNeedUpdate = true;
             recalculateSize();
         }
     }
@@ -182,15 +191,30 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        // The glyphs are passed as vertices when batching or clipping, so that they can be combined or cut off on the cpu
+        if (DrawBatch::isActive() || Clipping::isActive())
+        {
+            const std::shared_ptr<sf::Font> font = m_font;
+            if (font == nullptr)
+                return;
+
+            if (m_verticesNeedUpdate)
+                updateVertices();
+
+            states.texture = &font->getTexture(getCharacterSize());
+            DrawBatch::addVertices(target, states, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles);
+        }
+        else
+            DrawBatch::draw(target, m_text, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Text::recalculateSize()
     {
-        const std::shared_ptr<sf::Font> font = m_font;
-        if (font == nullptr)
+        TGUI_PROFILE_SCOPE(Text, "Text");
+
+        if (m_font == nullptr)
         {
             m_size = {0, 0};
             return;
@@ -205,7 +229,7 @@ namespace tgui
         const unsigned int textSize = m_text.getCharacterSize();
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
-            const float kerning = font->getKerning(prevChar, string[i], textSize);
+            const float kerning = m_font.getKerning(prevChar, string[i], textSize);
             if (string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
@@ -213,20 +237,132 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (m_font.getAdvance(' ', textSize, bold) * 4) + kerning;
             else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += m_font.getAdvance(string[i], textSize, bold) + kerning;
 
             prevChar = string[i];
         }
 
         const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        const float height = lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
+        const float height = lines * m_font.getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace;
         m_size = {std::max(maxWidth, width), height};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Text::updateVertices() const
+    {
+        // This function creates the same geometry as sf::Text does internally
+        m_verticesNeedUpdate = false;
+        m_vertices.clear();
+
+        const std::shared_ptr<sf::Font> font = m_font;
+        const sf::String& string = m_text.getString();
+        if ((font == nullptr) || string.isEmpty())
+            return;
+
+        const unsigned int characterSize = m_text.getCharacterSize();
+        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
+        const bool underlined = (m_text.getStyle() & sf::Text::Underlined) != 0;
+        const bool strikeThrough = (m_text.getStyle() & sf::Text::StrikeThrough) != 0;
+        const float italicShear = (m_text.getStyle() & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees
+        const Color color = Color::calcColorOpacity(m_color, m_opacity);
+
+        const float underlineOffset = font->getUnderlinePosition(characterSize);
+        const float underlineThickness = font->getUnderlineThickness(characterSize);
+        const sf::FloatRect xBounds = font->getGlyph(U'x', characterSize, bold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+        const float whitespaceWidth = m_font.getAdvance(U' ', characterSize, bold);
+        const float lineSpacing = m_font.getLineSpacing(characterSize);
+
+        // Lines use the white square in the top left corner of the font texture
+        const auto addLine = [&](float lineLength, float lineTop, float offset)
+            {
+                const float top = std::floor(lineTop + offset - (underlineThickness / 2) + 0.5f);
+                const float bottom = top + std::floor(underlineThickness + 0.5f);
+
+                m_vertices.emplace_back(sf::Vector2f{0, top}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+                m_vertices.emplace_back(sf::Vector2f{lineLength, bottom}, color, sf::Vector2f{1, 1});
+            };
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        std::uint32_t prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const std::uint32_t curChar = string[i];
+            if (curChar == '\r')
+                continue;
+
+            x += m_font.getKerning(prevChar, curChar, characterSize);
+
+            if ((curChar == '\n') && (prevChar != '\n'))
+            {
+                if (underlined)
+                    addLine(x, y, underlineOffset);
+                if (strikeThrough)
+                    addLine(x, y, strikeThroughOffset);
+            }
+
+            prevChar = curChar;
+
+            if (curChar == ' ')
+            {
+                x += whitespaceWidth;
+                continue;
+            }
+            else if (curChar == '\t')
+            {
+                x += whitespaceWidth * 4;
+                continue;
+            }
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+                continue;
+            }
+
+            const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, bold);
+
+            const float padding = 1.0;
+            const float left = glyph.bounds.left - padding;
+            const float top = glyph.bounds.top - padding;
+            const float right = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+            m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * top, y + top}, color, sf::Vector2f{u1, v1});
+            m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * top, y + top}, color, sf::Vector2f{u2, v1});
+            m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+            m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+            m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * top, y + top}, color, sf::Vector2f{u2, v1});
+            m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * bottom, y + bottom}, color, sf::Vector2f{u2, v2});
+
+            x += glyph.advance;
+        }
+
+        // Add the line decorations at the end of the last line
+        if (x > 0)
+        {
+            if (underlined)
+                addLine(x, y, underlineOffset);
+            if (strikeThrough)
+                addLine(x, y, strikeThroughOffset);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float Text::getExtraHorizontalPadding(const Text& text)
     {
         return getExtraHorizontalPadding(text.getFont(), text.getCharacterSize(), text.getStyle());
@@ -265,8 +401,7 @@ namespace tgui
 
     unsigned int Text::findBestTextSize(Font fontWrapper, float height, int fit)
     {
-        const std::shared_ptr<sf::Font> font = fontWrapper.getFont();
-        if (!font)
+        if (!fontWrapper)
             return 0;
 
         if (height < 2)
@@ -277,16 +412,16 @@ namespace tgui
             textSizes[i] = i + 1;
 
         const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
-                                           [&](unsigned int charSize, float h) { return font->getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
+                                           [&](unsigned int charSize, float h) { return fontWrapper.getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(fontWrapper, charSize) < h; });
         if (high == textSizes.end())
             return static_cast<unsigned int>(height);
 
-        const float highLineSpacing = font->getLineSpacing(*high);
+        const float highLineSpacing = fontWrapper.getLineSpacing(*high);
         if (highLineSpacing == height)
             return *high;
 
         const auto low = high - 1;
-        const float lowLineSpacing = font->getLineSpacing(*low);
+        const float lowLineSpacing = fontWrapper.getLineSpacing(*low);
 
         if (fit < 0)
             return *low;
@@ -316,7 +451,7 @@ namespace tgui
                                  + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
 
         // Get the line spacing sfml returns
-        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
+        const float lineSpacing = font.getLineSpacing(characterSize);
 
         // Calculate the offset of the text
         return lineHeight - lineSpacing;
@@ -348,11 +483,11 @@ namespace tgui
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
+                    charWidth = font.getAdvance(' ', textSize, bold) * 4;
                 else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
+                    charWidth = font.getAdvance(curChar, textSize, bold);
 
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
+                const float kerning = font.getKerning(prevChar, curChar, textSize);
                 if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
                 {
                     width += kerning + charWidth;
@@ -207,25 +207,40 @@ namespace tgui
 
     Vector2f Texture::getImageSize() const
     {
-        if (m_data)
+        if (!m_data)
+            return {0,0};
+        else if (!m_data->atlasPage)
             return sf::Vector2f{m_data->texture.getSize()};
+        else if (m_data->rect == sf::IntRect{})
+            return sf::Vector2f{m_data->image->getSize()};
         else
-            return {0,0};
+            return {static_cast<float>(m_data->rect.width), static_cast<float>(m_data->rect.height)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Texture::setSmooth(bool smooth)
     {
-        if (m_data)
-            m_data->texture.setSmooth(smooth);
+        if (!m_data)
+            return;
+
+        // The atlas page is shared with other images, so a smooth texture needs a texture of its own
+        if (m_data->atlasPage)
+        {
+            if (!smooth)
+                return;
+
+            TextureManager::removeFromAtlas(m_data);
+        }
+
+        m_data->texture.setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool Texture::isSmooth() const
     {
-        if (m_data)
+        if (m_data && !m_data->atlasPage)
             return m_data->texture.isSmooth();
         else
             return false;
@@ -253,7 +268,11 @@ namespace tgui
 
     sf::IntRect Texture::getMiddleRect() const
     {
-        return m_middleRect;
+        // The size of an image that is loaded in the background is only known once it is ready
+        if ((m_middleRect == sf::IntRect{}) && m_data && !m_data->loading)
+            return {0, 0, static_cast<int>(getImageSize().x), static_cast<int>(getImageSize().y)};
+        else
+            return m_middleRect;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,7 +282,7 @@ namespace tgui
         if (!m_data || !m_data->image)
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < getImageSize().x && pixel.y < getImageSize().y);
 
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
@@ -290,9 +309,9 @@ namespace tgui
     bool Texture::operator==(const Texture& right) const
     {
         if (m_id.isEmpty() && right.m_id.isEmpty())
-            return (m_data == right.m_data) && (m_middleRect == right.m_middleRect);
+            return (m_data == right.m_data) && (getMiddleRect() == right.getMiddleRect());
         else
-            return (m_middleRect == right.m_middleRect) && (m_id == right.m_id);
+            return (getMiddleRect() == right.getMiddleRect()) && (m_id == right.m_id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,8 +360,8 @@ namespace tgui
 
         m_data = data;
 
-        if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+        if ((middleRect == sf::IntRect{}) && !(data && data->loading))
+            m_middleRect = {0, 0, static_cast<int>(getImageSize().x), static_cast<int>(getImageSize().y)};
         else
             m_middleRect = middleRect;
     }
@@ -0,0 +1,160 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/TextureAtlas.hpp>
+#include <algorithm>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // Transparent pixels that are kept around each image so that neighbouring images can't bleed into each other
+    const unsigned int padding = 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    TextureAtlas::TextureAtlas(unsigned int pageSize, unsigned int maxImageSize) :
+        m_pageSize    {pageSize},
+        m_maxImageSize{maxImageSize}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureAtlas::Region TextureAtlas::add(const sf::Image& image, const sf::IntRect& rect)
+    {
+        sf::IntRect part = rect;
+        if (part == sf::IntRect{})
+            part = {0, 0, static_cast<int>(image.getSize().x), static_cast<int>(image.getSize().y)};
+
+        if ((part.left < 0) || (part.top < 0) || (part.width <= 0) || (part.height <= 0)
+         || (static_cast<unsigned int>(part.left + part.width) > image.getSize().x)
+         || (static_cast<unsigned int>(part.top + part.height) > image.getSize().y)
+         || (static_cast<unsigned int>(part.width) > m_maxImageSize)
+         || (static_cast<unsigned int>(part.height) > m_maxImageSize))
+        {
+            return {};
+        }
+
+        // The image is stored together with a transparent border
+        const sf::Vector2u size{part.width + 2 * padding, part.height + 2 * padding};
+        const unsigned int pageSize = std::min(m_pageSize, sf::Texture::getMaximumSize());
+        if ((size.x > pageSize) || (size.y > pageSize))
+            return {};
+
+        sf::Vector2u position;
+        auto pageIt = std::find_if(m_pages.begin(), m_pages.end(), [&](Page& page){ return findRoom(page, size, position); });
+        if (pageIt == m_pages.end())
+        {
+            Page page;
+            page.texture = std::make_shared<sf::Texture>();
+            if (!page.texture->create(pageSize, pageSize))
+                return {};
+
+            m_pages.push_back(std::move(page));
+            pageIt = std::prev(m_pages.end());
+            findRoom(*pageIt, size, position);
+        }
+
+        sf::Image paddedImage;
+        paddedImage.create(size.x, size.y, sf::Color::Transparent);
+        paddedImage.copy(image, padding, padding, part);
+        pageIt->texture->update(paddedImage, position.x, position.y);
+        ++pageIt->regions;
+
+        return {pageIt->texture, {position.x + padding, position.y + padding}};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureAtlas::remove(const Region& region)
+    {
+        auto pageIt = std::find_if(m_pages.begin(), m_pages.end(), [&](const Page& page){ return page.texture == region.page; });
+        if (pageIt == m_pages.end())
+            return;
+
+        if (--pageIt->regions == 0)
+            m_pages.erase(pageIt);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureAtlas::getPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureAtlas::getByteSize() const
+    {
+        std::size_t bytes = 0;
+        for (const auto& page : m_pages)
+            bytes += 4 * static_cast<std::size_t>(page.texture->getSize().x) * page.texture->getSize().y;
+
+        return bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureAtlas::findRoom(Page& page, sf::Vector2u size, sf::Vector2u& position) const
+    {
+        const sf::Vector2u pageSize = page.texture->getSize();
+
+        // Use the lowest shelf on which the image fits, to waste as little space as possible
+        Shelf* bestShelf = nullptr;
+        for (auto& shelf : page.shelves)
+        {
+            if ((shelf.height >= size.y) && (shelf.usedWidth + size.x <= pageSize.x)
+             && (!bestShelf || (shelf.height < bestShelf->height)))
+            {
+                bestShelf = &shelf;
+            }
+        }
+
+        // Start a new shelf when none of the existing ones has room
+        if (!bestShelf)
+        {
+            if (page.usedHeight + size.y > pageSize.y)
+                return false;
+
+            page.shelves.push_back({page.usedHeight, size.y, 0});
+            page.usedHeight += size.y;
+            bestShelf = &page.shelves.back();
+        }
+
+        position = {bestShelf->usedWidth, bestShelf->top};
+        bestShelf->usedWidth += size.x;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
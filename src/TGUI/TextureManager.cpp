@@ -26,126 +26,617 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
+#include <SFML/System/Clock.hpp>
+#include <functional>
+#include <algorithm>
+#include <condition_variable>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <deque>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::unordered_map<TextureManager::TextureKey, TextureDataHolder, TextureManager::TextureKeyHash> TextureManager::m_imageMap;
+    std::unordered_map<std::string, TextureManager::ImageEntry> TextureManager::m_images;
+    std::unordered_map<std::string, std::shared_future<std::shared_ptr<sf::Image>>> TextureManager::m_preloadedImages;
+    TextureManager::Statistics TextureManager::m_statistics;
+    TextureAtlas TextureManager::m_atlas;
+    bool TextureManager::m_atlasEnabled = false;
+    bool TextureManager::m_asyncLoadingEnabled = false;
+    std::unordered_map<std::string, std::vector<std::shared_ptr<TextureData>>> TextureManager::m_asyncLoads;
+    std::size_t TextureManager::m_finishedAsyncLoads = 0;
+    Color TextureManager::m_placeholderColor{0, 0, 0, 0};
+    Signal TextureManager::onAsyncLoadFinished = {"AsyncLoadFinished"};
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
+    namespace
     {
-        // Look if we already had this image
-        auto imageIt = m_imageMap.find(filename);
-        if (imageIt != m_imageMap.end())
+        std::size_t getByteSize(sf::Vector2u size)
+        {
+            return 4 * static_cast<std::size_t>(size.x) * size.y;
+        }
+
+        // Returns the size of the part of the image that is used by the texture data
+        sf::Vector2u getPartSize(const TextureData& data)
+        {
+            if (!data.atlasPage)
+                return data.texture.getSize();
+            else if (data.rect == sf::IntRect{})
+                return data.image->getSize();
+            else
+                return {static_cast<unsigned int>(data.rect.width), static_cast<unsigned int>(data.rect.height)};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Decodes images on worker threads. The amount of images that are being decoded or that are waiting to be picked up
+        // is limited, so that the workers can't run far ahead of the thread that uploads the images.
+        // The same threads also run the jobs of preloadImages, which are only started when no such image is waiting.
+        class AsyncImageDecoder
         {
-            // Loop all our textures to find the one containing the image
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+        public:
+
+            ~AsyncImageDecoder()
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_stopping = true;
+                }
+
+                m_workAvailable.notify_all();
+                for (auto& thread : m_threads)
+                    thread.join();
+            }
+
+            void push(const std::string& filename, const Texture::ImageLoaderFunc& imageLoader)
             {
-                // Only reuse the texture when the exact same part of the image is used
-                if (dataIt->data->rect == partRect)
                 {
-                    // The texture is now used at multiple places
-                    ++(dataIt->users);
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_jobs.push_back({filename, imageLoader});
+                    startThreads();
+                }
+
+                m_workAvailable.notify_one();
+            }
+
+            void pushPreload(std::function<void()> job)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_preloadJobs.push_back(std::move(job));
+                    startThreads();
+                }
+
+                m_workAvailable.notify_one();
+            }
+
+            bool pop(std::pair<std::string, std::unique_ptr<sf::Image>>& decodedImage)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    if (m_decodedImages.empty())
+                        return false;
+
+                    decodedImage = std::move(m_decodedImages.front());
+                    m_decodedImages.pop_front();
+                }
+
+                m_workAvailable.notify_one();
+                return true;
+            }
+
+            bool hasDecodedImages()
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                return !m_decodedImages.empty();
+            }
+
+            void setCapacity(std::size_t capacity)
+            {
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_capacity = std::max<std::size_t>(capacity, 1);
+                }
+
+                m_workAvailable.notify_all();
+            }
+
+            std::size_t getCapacity()
+            {
+                std::lock_guard<std::mutex> lock{m_mutex};
+                return m_capacity;
+            }
+
+        private:
+
+            // The threads are only created when the first job arrives and then live until the program ends
+            void startThreads()
+            {
+                if (!m_threads.empty())
+                    return;
+
+                const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+                const unsigned int threadCount = (hardwareThreads > 2) ? hardwareThreads - 1 : 1;
+                for (unsigned int i = 0; i < threadCount; ++i)
+                    m_threads.emplace_back([this]{ decodeImages(); });
+            }
+
+            bool canDecode() const
+            {
+                return !m_jobs.empty() && (m_decodingCount + m_decodedImages.size() < m_capacity);
+            }
+
+            void decodeImages()
+            {
+                std::unique_lock<std::mutex> lock{m_mutex};
+                while (true)
+                {
+                    m_workAvailable.wait(lock, [this]{ return m_stopping || canDecode() || !m_preloadJobs.empty(); });
+
+                    if (m_stopping)
+                        return;
+
+                    // Images that a texture is waiting for go before the images that are only preloaded
+                    if (!canDecode())
+                    {
+                        auto preloadJob = std::move(m_preloadJobs.front());
+                        m_preloadJobs.pop_front();
+
+                        lock.unlock();
+                        preloadJob();
+                        lock.lock();
+                        continue;
+                    }
 
-                    // Let the texture alert the texture manager when it is being copied or destroyed
-                    texture.setCopyCallback(&TextureManager::copyTexture);
-                    texture.setDestructCallback(&TextureManager::removeTexture);
-                    return dataIt->data;
+                    auto job = std::move(m_jobs.front());
+                    m_jobs.pop_front();
+                    ++m_decodingCount;
+
+                    lock.unlock();
+                    std::unique_ptr<sf::Image> image;
+                    try
+                    {
+                        image = job.second(job.first);
+                    }
+                    catch (...)
+                    {
+                    }
+                    lock.lock();
+
+                    --m_decodingCount;
+                    m_decodedImages.emplace_back(std::move(job.first), std::move(image));
                 }
             }
+
+        private:
+
+            std::mutex m_mutex;
+            std::condition_variable m_workAvailable;
+            std::deque<std::pair<std::string, Texture::ImageLoaderFunc>> m_jobs;
+            std::deque<std::function<void()>> m_preloadJobs;
+            std::deque<std::pair<std::string, std::unique_ptr<sf::Image>>> m_decodedImages;
+            std::vector<std::thread> m_threads;
+            std::size_t m_decodingCount = 0;
+            std::size_t m_capacity = 8;
+            bool m_stopping = false;
+        };
+
+        AsyncImageDecoder asyncImageDecoder;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::TextureKeyHash::operator()(const TextureKey& key) const
+    {
+        std::size_t hash = std::hash<std::string>{}(key.filename);
+        for (const int value : {key.partRect.left, key.partRect.top, key.partRect.width, key.partRect.height})
+            hash ^= std::hash<int>{}(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const std::string& filename, const sf::IntRect& partRect)
+    {
+        // Look if we already had this part of the image
+        auto it = m_imageMap.find({filename, partRect});
+        if (it != m_imageMap.end())
+        {
+            ++m_statistics.hits;
+
+            // The texture is now used at multiple places
+            ++(it->second.users);
+
+            // Let the texture alert the texture manager when it is being copied or destroyed
+            texture.setCopyCallback(&TextureManager::copyTexture);
+            texture.setDestructCallback(&TextureManager::removeTexture);
+            return it->second.data;
         }
-        else // The image doesn't exist yet
+
+        ++m_statistics.misses;
+
+        // Reuse the image when another part of the same file is already loaded, otherwise take the image that was decoded
+        // in the background or load it now
+        auto data = std::make_shared<TextureData>();
+        data->rect = partRect;
+
+        auto imageIt = m_images.find(filename);
+        if (imageIt != m_images.end())
+            data->image = imageIt->second.image;
+        else
         {
-            auto it = m_imageMap.insert({filename, {}});
-            imageIt = it.first;
+            auto preloadedIt = m_preloadedImages.find(filename);
+            if (preloadedIt != m_preloadedImages.end())
+            {
+                const auto preloadedImage = std::move(preloadedIt->second);
+                m_preloadedImages.erase(preloadedIt);
+                data->image = preloadedImage.get();
+            }
+            else if (m_asyncLoadingEnabled)
+            {
+                // The image is decoded on a worker thread and the data remains empty until processAsyncLoads uploads it
+                data->loading = true;
+
+                auto& waitingTextures = m_asyncLoads[filename];
+                if (waitingTextures.empty())
+                    asyncImageDecoder.push(filename, texture.getImageLoader());
+
+                waitingTextures.push_back(data);
+            }
+            else
+                data->image = texture.getImageLoader()(filename);
+        }
+
+        if (!data->loading)
+        {
+            if ((data->image == nullptr) || !uploadImage(*data))
+                return nullptr;
+
+            addImageUser(filename, data->image);
         }
 
-        // Add new data to the list
-        TextureDataHolder dataHolder;
+        // Add the new data to the map. The data keeps a pointer to its entry so that copying and removing it doesn't require a search.
+        TextureDataHolder& dataHolder = m_imageMap[{filename, partRect}];
         dataHolder.filename = filename;
         dataHolder.users = 1;
-        dataHolder.data = std::make_shared<TextureData>();
-        dataHolder.data->rect = partRect;
-        imageIt->second.push_back(std::move(dataHolder));
+        dataHolder.bytes = getByteSize(data->texture.getSize());
+        dataHolder.data = data;
+        data->holder = &dataHolder;
+
+        ++m_statistics.textures;
+        m_statistics.bytesResident += dataHolder.bytes;
+        m_statistics.textureBytes += getByteSize(data->texture.getSize());
+        if (!data->loading)
+            m_statistics.textureBytesWithoutAtlas += getByteSize(getPartSize(*data));
 
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
+        return data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Load the image
-        auto data = imageIt->second.back().data;
-        data->image = texture.getImageLoader()(filename);
-        if (data->image != nullptr)
+    bool TextureManager::uploadImage(TextureData& data)
+    {
+        // Copy the image into the atlas when possible, otherwise create a texture from the image.
+        // A texture that was made smooth while its image was loading in the background can't be placed in the atlas.
+        TextureAtlas::Region region;
+        if (m_atlasEnabled && !data.texture.isSmooth())
+            region = m_atlas.add(*data.image, data.rect);
+
+        if (region.page)
         {
-            // Create a texture from the image
-            bool loadFromImageSuccess;
-            if (partRect == sf::IntRect{})
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-            else
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
+            data.atlasPage = region.page;
+            data.atlasPosition = region.position;
+            return true;
+        }
 
-            if (loadFromImageSuccess)
-                return data;
-            else
-                return nullptr;
+        if (data.rect == sf::IntRect{})
+            return data.texture.loadFromImage(*data.image);
+        else
+            return data.texture.loadFromImage(*data.image, data.rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addImageUser(const std::string& filename, const std::shared_ptr<sf::Image>& image)
+    {
+        ImageEntry& imageEntry = m_images[filename];
+        if (imageEntry.users++ == 0)
+        {
+            imageEntry.image = image;
+            m_statistics.bytesResident += getByteSize(image->getSize());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_future<sf::Time> TextureManager::preloadImages(const std::vector<std::string>& filenames)
+    {
+        // The state is shared with the worker threads, which only touch this object and never the members of the manager
+        struct PreloadBatch
+        {
+            std::vector<std::pair<std::string, std::promise<std::shared_ptr<sf::Image>>>> images;
+            std::atomic<std::size_t> imagesLeft{0};
+            Texture::ImageLoaderFunc imageLoader;
+            sf::Clock clock;
+            std::promise<sf::Time> finished;
+        };
+
+        auto batch = std::make_shared<PreloadBatch>();
+        batch->imageLoader = Texture::getImageLoader();
+        for (const auto& filename : filenames)
+        {
+            if ((m_images.find(filename) != m_images.end()) || (m_preloadedImages.find(filename) != m_preloadedImages.end()))
+                continue;
+
+            batch->images.emplace_back(filename, std::promise<std::shared_ptr<sf::Image>>{});
+            m_preloadedImages[filename] = batch->images.back().second.get_future().share();
+        }
+
+        std::shared_future<sf::Time> finished = batch->finished.get_future().share();
+        if (batch->images.empty())
+        {
+            batch->finished.set_value(sf::Time::Zero);
+            return finished;
+        }
+
+        // Every image is a separate job, so that the images of several calls are spread over the same worker threads
+        batch->imagesLeft = batch->images.size();
+        for (std::size_t index = 0; index < batch->images.size(); ++index)
+        {
+            asyncImageDecoder.pushPreload([batch, index]{
+                auto& image = batch->images[index];
+                try
+                {
+                    image.second.set_value(batch->imageLoader(image.first));
+                }
+                catch (...)
+                {
+                    image.second.set_exception(std::current_exception());
+                }
+
+                if (--batch->imagesLeft == 0)
+                    batch->finished.set_value(batch->clock.getElapsedTime());
+            });
         }
 
-        // The image could not be loaded
-        m_imageMap.erase(imageIt);
-        return nullptr;
+        return finished;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removePreloadedImages(const std::vector<std::string>& filenames)
+    {
+        for (const auto& filename : filenames)
+            m_preloadedImages.erase(filename);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        if (!textureDataToCopy || !textureDataToCopy->holder)
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++(textureDataToCopy->holder->users);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        if (!textureDataToRemove || !textureDataToRemove->holder)
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        TextureDataHolder& dataHolder = *textureDataToRemove->holder;
+        if (--dataHolder.users == 0)
         {
-            for (auto& data : dataHolder.second)
+            --m_statistics.textures;
+            m_statistics.bytesResident -= dataHolder.bytes;
+            m_statistics.textureBytes -= getByteSize(textureDataToRemove->texture.getSize());
+            if (textureDataToRemove->image)
+                m_statistics.textureBytesWithoutAtlas -= getByteSize(getPartSize(*textureDataToRemove));
+
+            // The data keeps its pointer to the page, so that the page remains valid for as long as the data is alive
+            if (textureDataToRemove->atlasPage)
+                m_atlas.remove({textureDataToRemove->atlasPage, textureDataToRemove->atlasPosition});
+
+            // The image is only released when no other part of the file is still loaded.
+            // Data that is still waiting for its image in the background doesn't use an image yet.
+            auto imageIt = m_images.find(dataHolder.filename);
+            if ((imageIt != m_images.end()) && textureDataToRemove->image && (--imageIt->second.users == 0))
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
-                {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
-                }
+                m_statistics.bytesResident -= getByteSize(imageIt->second.image->getSize());
+                m_images.erase(imageIt);
             }
+
+            textureDataToRemove->holder = nullptr;
+            m_imageMap.erase({dataHolder.filename, textureDataToRemove->rect});
         }
+    }
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::Statistics TextureManager::getStatistics()
+    {
+        Statistics statistics = m_statistics;
+        statistics.bytesResident += m_atlas.getByteSize();
+        statistics.textureBytes += m_atlas.getByteSize();
+        statistics.atlasPages = m_atlas.getPageCount();
+        return statistics;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    void TextureManager::resetStatistics()
+    {
+        m_statistics.hits = 0;
+        m_statistics.misses = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeFromAtlas(std::shared_ptr<TextureData> textureData)
+    {
+        if (!textureData || !textureData->atlasPage)
+            return;
+
+        if (textureData->rect == sf::IntRect{})
+            textureData->texture.loadFromImage(*textureData->image);
+        else
+            textureData->texture.loadFromImage(*textureData->image, textureData->rect);
+
+        // When the data is no longer in the texture manager then its region was already removed from the atlas
+        if (textureData->holder)
+        {
+            const std::size_t textureBytes = getByteSize(textureData->texture.getSize());
+            textureData->holder->bytes += textureBytes;
+            m_statistics.bytesResident += textureBytes;
+            m_statistics.textureBytes += textureBytes;
+
+            m_atlas.remove({textureData->atlasPage, textureData->atlasPosition});
+        }
+
+        textureData->atlasPage = nullptr;
+        textureData->atlasPosition = {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncLoadingEnabled(bool enabled)
+    {
+        m_asyncLoadingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAsyncLoadingEnabled()
+    {
+        return m_asyncLoadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncQueueCapacity(std::size_t capacity)
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        asyncImageDecoder.setCapacity(capacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAsyncQueueCapacity()
+    {
+        return asyncImageDecoder.getCapacity();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::processAsyncLoads(sf::Time budget)
+    {
+        if (m_asyncLoads.empty())
+            return 0;
+
+        sf::Clock clock;
+        std::size_t finishedCount = 0;
+        std::pair<std::string, std::unique_ptr<sf::Image>> decodedImage;
+        while (((finishedCount == 0) || (clock.getElapsedTime() < budget)) && asyncImageDecoder.pop(decodedImage))
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            auto asyncLoadIt = m_asyncLoads.find(decodedImage.first);
+            if (asyncLoadIt == m_asyncLoads.end())
+                continue;
+
+            const std::vector<std::shared_ptr<TextureData>> waitingTextures = std::move(asyncLoadIt->second);
+            m_asyncLoads.erase(asyncLoadIt);
+
+            const std::shared_ptr<sf::Image> image = std::move(decodedImage.second);
+            for (const auto& data : waitingTextures)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
-                {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
-                    {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
-                    }
+                data->loading = false;
 
-                    return;
+                // Skip data that was removed while its image was being decoded
+                if (!image || !data->holder)
+                    continue;
+
+                data->image = image;
+                if (!uploadImage(*data))
+                {
+                    data->image = nullptr;
+                    continue;
                 }
+
+                addImageUser(data->holder->filename, image);
+
+                const std::size_t textureBytes = getByteSize(data->texture.getSize());
+                data->holder->bytes += textureBytes;
+                m_statistics.bytesResident += textureBytes;
+                m_statistics.textureBytes += textureBytes;
+                m_statistics.textureBytesWithoutAtlas += getByteSize(getPartSize(*data));
             }
+
+            ++finishedCount;
+            ++m_finishedAsyncLoads;
+            onAsyncLoadFinished.emit(nullptr);
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        return finishedCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getPendingAsyncLoads()
+    {
+        return m_asyncLoads.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAsyncLoadReady()
+    {
+        return !m_asyncLoads.empty() && asyncImageDecoder.hasDecodedImages();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getFinishedAsyncLoadCount()
+    {
+        return m_finishedAsyncLoads;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setPlaceholderColor(const Color& color)
+    {
+        m_placeholderColor = color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Color& TextureManager::getPlaceholderColor()
+    {
+        return m_placeholderColor;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
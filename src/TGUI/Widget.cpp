@@ -27,9 +27,13 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Animation.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/Profiler.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <algorithm>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -37,31 +41,6 @@ namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    namespace
-    {
-        void addAnimation(std::vector<std::shared_ptr<priv::Animation>>& existingAnimations, std::shared_ptr<priv::Animation> newAnimation)
-        {
-            const auto type = newAnimation->getType();
-
-            // If another animation is already running with the same type then instantly finish it
-            unsigned int i = 0;
-            while (i < existingAnimations.size())
-            {
-                if (existingAnimations[i]->getType() == type)
-                {
-                    existingAnimations[i]->finish();
-                    existingAnimations.erase(existingAnimations.begin() + i);
-                }
-                else
-                    ++i;
-            }
-
-            existingAnimations.push_back(newAnimation);
-        }
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     Widget::Widget()
     {
         m_renderer->subscribe(this, m_rendererChangedCallback);
@@ -268,41 +247,30 @@ namespace tgui
         m_renderer->subscribe(this, m_rendererChangedCallback);
         rendererData->shared = true;
 
-        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
-        auto oldIt = oldData->propertyValuePairs.begin();
-        auto newIt = rendererData->propertyValuePairs.begin();
-        while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
-        {
-            if (oldIt->first < newIt->first)
-            {
-                // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
-                ++oldIt;
-            }
-            else
-            {
-                // Update changed and new properties
-                rendererChanged(newIt->first);
+        // Nothing changed when the widget was already using this renderer
+        if (rendererData == oldData)
+            return;
 
-                if (newIt->first < oldIt->first)
-                    ++newIt;
-                else
-                {
-                    ++oldIt;
-                    ++newIt;
-                }
-            }
-        }
-        while (oldIt != oldData->propertyValuePairs.end())
+        // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value.
+        // Properties that have the same value in both renderers are skipped, as the widget already uses that value.
+        std::vector<PropertyId> changedProperties;
+        for (const auto& pair : rendererData->propertyValuePairs)
         {
-            rendererChanged(oldIt->first);
-            ++oldIt;
+            const auto oldIt = oldData->propertyValuePairs.find(pair.first);
+            if ((oldIt == oldData->propertyValuePairs.end()) || (oldIt->second != pair.second))
+                changedProperties.push_back(pair.first);
         }
-        while (newIt != rendererData->propertyValuePairs.end())
+        for (const auto& pair : oldData->propertyValuePairs)
         {
-            rendererChanged(newIt->first);
-            ++newIt;
+            if (rendererData->propertyValuePairs.find(pair.first) == rendererData->propertyValuePairs.end())
+                changedProperties.push_back(pair.first);
         }
+
+        RendererData::sortByName(changedProperties);
+        for (const auto& property : changedProperties)
+            rendererChanged(property);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -361,11 +329,14 @@ namespace tgui
 
         if (getPosition() != m_prevPosition)
         {
+            invalidateArea(m_prevPosition, getFullSize());
+            invalidate();
+
             m_prevPosition = getPosition();
             onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
     }
 
@@ -379,11 +350,14 @@ namespace tgui
 
         if (getSize() != m_prevSize)
         {
+            invalidateArea(getPosition(), getFullSize() - getSize() + m_prevSize);
+            invalidate();
+
             m_prevSize = getSize();
             onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
     }
 
@@ -413,135 +387,144 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::showWithEffect(ShowAnimationType type, sf::Time duration)
+    void Widget::showWithEffect(ShowAnimationType type, sf::Time duration, AnimationEasing easing)
     {
         setVisible(true);
 
+        const Vector2f scaleStartPosition = getPosition() + (getSize() / 2.f);
+        priv::Animation animation{priv::Animation::Type::Move, {}, getPosition(), duration, easing};
         switch (type)
         {
             case ShowAnimationType::Fade:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), 0.f, getInheritedOpacity(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                setInheritedOpacity(0);
+                animation = {priv::Animation::Type::Fade, {0, 0}, {getInheritedOpacity(), 0}, duration, easing};
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), getPosition() + (getSize() / 2.f), getPosition(), duration));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), Vector2f{0, 0}, getSize(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                setPosition(getPosition() + (getSize() / 2.f));
-                setSize(0, 0);
+                addAnimation({priv::Animation::Type::Move, scaleStartPosition, getPosition(), duration, easing});
+                animation = {priv::Animation::Type::Resize, {0, 0}, getSize(), duration, easing};
                 break;
             }
             case ShowAnimationType::SlideFromLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{-getFullSize().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                setPosition({-getFullSize().x, getPosition().y});
+                animation = {priv::Animation::Type::Move, {-getFullSize().x, getPosition().y}, getPosition(), duration, easing};
                 break;
             }
             case ShowAnimationType::SlideFromRight:
             {
-                if (getParent())
-                {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                    setPosition({getParent()->getSize().x + getWidgetOffset().x, getPosition().y});
-                }
-                else
+                if (!getParent())
                 {
                     TGUI_PRINT_WARNING("showWithEffect(SlideFromRight) does not work before widget has a parent.");
+                    return;
                 }
 
+                animation = {priv::Animation::Type::Move, {getParent()->getSize().x + getWidgetOffset().x, getPosition().y}, getPosition(), duration, easing};
                 break;
             }
             case ShowAnimationType::SlideFromTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, -getFullSize().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                setPosition({getPosition().x, -getFullSize().y});
+                animation = {priv::Animation::Type::Move, {getPosition().x, -getFullSize().y}, getPosition(), duration, easing};
                 break;
             }
             case ShowAnimationType::SlideFromBottom:
             {
-                if (getParent())
-                {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), Vector2f{getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, [=]{onAnimationFinished.emit(this, type, true); }));
-                    setPosition({getPosition().x, getParent()->getSize().y + getWidgetOffset().y});
-                }
-                else
+                if (!getParent())
                 {
                     TGUI_PRINT_WARNING("showWithEffect(SlideFromBottom) does not work before widget has a parent.");
+                    return;
                 }
 
+                animation = {priv::Animation::Type::Move, {getPosition().x, getParent()->getSize().y + getWidgetOffset().y}, getPosition(), duration, easing};
                 break;
             }
         }
+
+        animation.showType = type;
+        animation.emitFinished = true;
+        addAnimation(animation);
+
+        // Start from the first frame of the animation
+        if (type == ShowAnimationType::Scale)
+            applyAnimationValue(priv::Animation::Type::Move, scaleStartPosition);
+        applyAnimationValue(animation.getType(), animation.getStartValue());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::hideWithEffect(ShowAnimationType type, sf::Time duration)
+    void Widget::hideWithEffect(ShowAnimationType type, sf::Time duration, AnimationEasing easing)
     {
         const auto position = getPosition();
         const auto size = getSize();
 
+        priv::Animation animation{priv::Animation::Type::Move, position, {}, duration, easing};
         switch (type)
         {
             case ShowAnimationType::Fade:
             {
-                float opacity = getInheritedOpacity();
-                addAnimation(m_showAnimations, std::make_shared<priv::FadeAnimation>(shared_from_this(), getInheritedOpacity(), 0.f, duration,
-                    [=](){ setVisible(false); setInheritedOpacity(opacity); onAnimationFinished.emit(this, type, false); }));
+                animation = {priv::Animation::Type::Fade, {getInheritedOpacity(), 0}, {0, 0}, duration, easing};
                 break;
             }
             case ShowAnimationType::Scale:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, position + (size / 2.f), duration, [=](){ setVisible(false); setPosition(position); setSize(size); }));
-                addAnimation(m_showAnimations, std::make_shared<priv::ResizeAnimation>(shared_from_this(), size, Vector2f{0, 0}, duration,
-                    [=](){ setVisible(false); setPosition(position); setSize(size); onAnimationFinished.emit(this, type, false); }));
+                priv::Animation moveAnimation{priv::Animation::Type::Move, position, position + (size / 2.f), duration, easing};
+                moveAnimation.hideWidget = true;
+                addAnimation(moveAnimation);
+
+                animation = {priv::Animation::Type::Resize, size, {0, 0}, duration, easing};
                 break;
             }
             case ShowAnimationType::SlideToRight:
             {
-                if (getParent())
+                if (!getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{getParent()->getSize().x + getWidgetOffset().x, position.y}, duration,
-                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
-                }
-                else
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToRight) does not work before widget has a parent.");
+                    return;
+                }
 
+                animation = {priv::Animation::Type::Move, position, {getParent()->getSize().x + getWidgetOffset().x, position.y}, duration, easing};
                 break;
             }
             case ShowAnimationType::SlideToLeft:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{-getFullSize().x, position.y}, duration,
-                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                animation = {priv::Animation::Type::Move, position, {-getFullSize().x, position.y}, duration, easing};
                 break;
             }
             case ShowAnimationType::SlideToBottom:
             {
-                if (getParent())
+                if (!getParent())
                 {
-                    addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, getParent()->getSize().y + getWidgetOffset().y}, duration,
-                        [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
-                }
-                else
                     TGUI_PRINT_WARNING("hideWithEffect(SlideToBottom) does not work before widget has a parent.");
+                    return;
+                }
 
+                animation = {priv::Animation::Type::Move, position, {position.x, getParent()->getSize().y + getWidgetOffset().y}, duration, easing};
                 break;
             }
             case ShowAnimationType::SlideToTop:
             {
-                addAnimation(m_showAnimations, std::make_shared<priv::MoveAnimation>(shared_from_this(), position, Vector2f{position.x, -getFullSize().y}, duration,
-                    [=](){ setVisible(false); setPosition(position); onAnimationFinished.emit(this, type, false); }));
+                animation = {priv::Animation::Type::Move, position, {position.x, -getFullSize().y}, duration, easing};
                 break;
             }
         }
+
+        animation.showType = type;
+        animation.hideWidget = true;
+        animation.emitFinished = true;
+        addAnimation(animation);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setVisible(bool visible)
     {
+        if (m_visible != visible)
+        {
+            // The area has to be redrawn while the widget is visible, otherwise it would be ignored
+            m_visible = true;
+            invalidate();
+        }
+
         m_visible = visible;
 
         // If the widget is hiden while still focused then it must be unfocused
@@ -553,6 +536,9 @@ namespace tgui
 
     void Widget::setEnabled(bool enabled)
     {
+        if (m_enabled != enabled)
+            invalidate();
+
         m_enabled = enabled;
 
         if (!enabled)
@@ -570,6 +556,9 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        if (!isContainer())
+            invalidate();
+
         if (focused)
         {
             if (canGainFocus())
@@ -601,6 +590,8 @@ namespace tgui
     {
         if (m_parent)
             m_parent->moveWidgetToFront(shared_from_this());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -609,6 +600,31 @@ namespace tgui
     {
         if (m_parent)
             m_parent->moveWidgetToBack(shared_from_this());
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Widget::getHitTestBounds() const
+    {
+        const Vector2f position = getPosition();
+        const Vector2f size = getSize();
+        const Vector2f fullPosition = position + getWidgetOffset();
+        const Vector2f fullSize = getFullSize();
+
+        const float left = std::min(position.x, fullPosition.x);
+        const float top = std::min(position.y, fullPosition.y);
+        const float right = std::max(position.x + size.x, fullPosition.x + fullSize.x);
+        const float bottom = std::max(position.y + size.y, fullPosition.y + fullSize.y);
+        return {left, top, right - left, bottom - top};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidate()
+    {
+        invalidateArea(getPosition(), getFullSize());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -616,7 +632,8 @@ namespace tgui
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
-        rendererChanged("font");
+        rendererChanged(PropertyId::Font);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -631,7 +648,8 @@ namespace tgui
     void Widget::setInheritedOpacity(float opacity)
     {
         m_inheritedOpacity = opacity;
-        rendererChanged("opacity");
+        rendererChanged(PropertyId::Opacity);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -688,17 +706,50 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        for (unsigned int i = 0; i < m_showAnimations.size();)
+        for (std::size_t i = 0; i < m_showAnimations.size();)
         {
-            if (m_showAnimations[i]->update(elapsedTime))
+            if (m_showAnimations[i].update(elapsedTime))
+            {
+                // The animation is removed before finishing it, in case a signal handler starts a new animation
+                const priv::Animation animation = m_showAnimations[i];
                 m_showAnimations.erase(m_showAnimations.begin() + i);
+                finishAnimation(animation);
+            }
             else
-                i++;
+            {
+                applyAnimationValue(m_showAnimations[i].getType(), m_showAnimations[i].getCurrentValue());
+                ++i;
+            }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Widget::isUpdateNeeded() const
+    {
+        return !m_showAnimations.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Widget::getTimeUntilNextUpdate() const
+    {
+        if (!m_showAnimations.empty())
+            return sf::Time::Zero;
+        else
+            return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::scheduleUpdates()
+    {
+        if (m_parent)
+            m_parent->scheduleChildUpdates(this);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(Vector2f)
     {
     }
@@ -825,11 +876,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::rendererChanged(PropertyId property)
+    {
+        rendererChanged(property.getName());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::rendererChanged(const std::string& property)
     {
         if (property == "opacity")
         {
-            m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
+            m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
         else if (property == "font")
         {
@@ -930,9 +988,19 @@ namespace tgui
         if (node->propertyValuePairs["enabled"])
             setEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["enabled"]->value).getBool());
         if (node->propertyValuePairs["position"])
-            setPosition(parseLayout(node->propertyValuePairs["position"]->value));
+        {
+            if (node->propertyValuePairs["position"]->parsedLayout)
+                setPosition(*node->propertyValuePairs["position"]->parsedLayout);
+            else
+                setPosition(parseLayout(node->propertyValuePairs["position"]->value));
+        }
         if (node->propertyValuePairs["size"])
-            setSize(parseLayout(node->propertyValuePairs["size"]->value));
+        {
+            if (node->propertyValuePairs["size"]->parsedLayout)
+                setSize(*node->propertyValuePairs["size"]->parsedLayout);
+            else
+                setSize(parseLayout(node->propertyValuePairs["size"]->value));
+        }
 
         if (node->propertyValuePairs["renderer"])
         {
@@ -992,6 +1060,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -1000,14 +1069,91 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChangedCallback(const std::string& property)
+    void Widget::rendererChangedCallback(PropertyId property)
     {
+        TGUI_PROFILE_SCOPE(RendererChanged, getWidgetType(), property.getName());
         rendererChanged(property);
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::invalidateArea(Vector2f position, Vector2f fullSize)
+    {
+        if (!m_parent)
+            return;
+
+        // Anything that changes the look of the widget might also change where it can be found by the mouse
+        m_parent->childHitTestBoundsChanged(this);
+
+        if (!m_visible)
+            return;
+
+        m_parent->invalidateRegion({m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + position + getWidgetOffset(), fullSize});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::addAnimation(const priv::Animation& animation)
+    {
+        // If another animation is already running with the same type then instantly finish it
+        for (std::size_t i = 0; i < m_showAnimations.size();)
+        {
+            if (m_showAnimations[i].getType() == animation.getType())
+            {
+                const priv::Animation oldAnimation = m_showAnimations[i];
+                m_showAnimations.erase(m_showAnimations.begin() + i);
+                finishAnimation(oldAnimation);
+            }
+            else
+                ++i;
+        }
+
+        m_showAnimations.push_back(animation);
+        scheduleUpdates();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::applyAnimationValue(priv::Animation::Type type, Vector2f value)
+    {
+        switch (type)
+        {
+            case priv::Animation::Type::Move:
+                setPosition(value);
+                break;
+            case priv::Animation::Type::Resize:
+                setSize(value);
+                break;
+            case priv::Animation::Type::Fade:
+                setInheritedOpacity(value.x);
+                break;
+            case priv::Animation::Type::None:
+                break;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::finishAnimation(const priv::Animation& animation)
+    {
+        applyAnimationValue(animation.getType(), animation.getEndValue());
+
+        // A hidden widget gets back the values that it had before the animation started
+        if (animation.hideWidget)
+        {
+            setVisible(false);
+            applyAnimationValue(animation.getType(), animation.getStartValue());
+        }
+
+        if (animation.emitFinished)
+            onAnimationFinished.emit(this, animation.showType, !animation.hideWidget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1017,14 +1163,15 @@ namespace tgui
                                     Vector2f size,
                                     Color color) const
     {
-        sf::RectangleShape shape{size};
-
-        if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
-
-        target.draw(shape, states);
+        const Color fillColor = (m_opacityCached < 1) ? Color::calcColorOpacity(color, m_opacityCached) : color;
+        const sf::Vertex vertices[] = {
+            {{0, 0}, fillColor},
+            {{size.x, 0}, fillColor},
+            {{0, size.y}, fillColor},
+            {{size.x, size.y}, fillColor}
+        };
+
+        DrawBatch::addVertices(target, states, vertices, 4, sf::PrimitiveType::TrianglesStrip);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1040,10 +1187,14 @@ namespace tgui
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{size.x, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, size.y}, color}
+            };
+
+            DrawBatch::addVertices(target, states, vertices, 4, sf::PrimitiveType::TrianglesStrip);
         }
         else // Draw borders in the normal way
         {
@@ -1057,7 +1208,7 @@ namespace tgui
             // |              | //
             // 2--------------4 //
             //////////////////////
-            const std::vector<sf::Vertex> vertices = {
+            const sf::Vertex vertices[] = {
                 {{0, 0}, color},
                 {{borders.getLeft(), 0}, color},
                 {{0, size.y}, color},
@@ -1070,7 +1221,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            DrawBatch::addVertices(target, states, vertices, 10, sf::PrimitiveType::TrianglesStrip);
         }
     }
 
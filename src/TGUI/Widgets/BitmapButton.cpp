@@ -79,6 +79,8 @@ namespace tgui
 
     void BitmapButton::setImage(const Texture& image)
     {
+        invalidate();
+
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
@@ -95,6 +97,8 @@ namespace tgui
 
     void BitmapButton::setImageScaling(float relativeHeight)
     {
+        invalidate();
+
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
     }
@@ -95,6 +95,10 @@ namespace tgui
 
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgetNames.insert(m_widgetNames.begin() + index, widgetName);
+            updateChildNameIndex(widgetName);
+
+            if (m_spatialIndex)
+                resetSpatialIndex();
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
@@ -140,14 +144,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::rendererChanged(const std::string& property)
+    void BoxLayout::rendererChanged(PropertyId property)
     {
-        if (property == "spacebetweenwidgets")
+        if (property == PropertyId::SpaceBetweenWidgets)
         {
             m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
             updateWidgets();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::Padding)
         {
             Group::rendererChanged(property);
 
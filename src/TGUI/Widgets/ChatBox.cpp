@@ -25,11 +25,30 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        std::size_t lowestBit(std::size_t index)
+        {
+            return index & (~index + 1);
+        }
+
+        // Returns the sum of the heights in the first slots of the binary indexed tree
+        float sumOfSlots(const std::vector<float>& tree, std::size_t slotCount)
+        {
+            float sum = 0;
+            for (std::size_t i = slotCount; i > 0; i -= lowestBit(i))
+                sum += tree[i];
+
+            return sum;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ChatBox::ChatBox()
@@ -115,6 +134,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text)
     {
+        invalidate();
+
         addLine(text, m_textColor);
     }
 
@@ -122,6 +143,8 @@ namespace tgui
 
     void ChatBox::addLine(const sf::String& text, Color color)
     {
+        invalidate();
+
         // Remove the oldest line if you exceed the maximum
         if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
         {
@@ -131,21 +154,46 @@ namespace tgui
                 removeLine(m_maxLines-1);
         }
 
+        // The text is only word wrapped once the line becomes visible
         Line line;
         line.string = text;
         line.text.setColor(color);
         line.text.setOpacity(m_opacityCached);
         line.text.setCharacterSize(m_textSize);
-        line.text.setString(text);
         line.text.setFont(m_fontCached);
-
-        recalculateLineText(line);
+        line.height = estimateLineHeight(line);
 
         if (m_newLinesBelowOthers)
+        {
+            const std::size_t slot = m_firstLineSlot + m_lines.size();
             m_lines.push_back(std::move(line));
+
+            if (m_lineHeightIndex.empty())
+                m_lineHeightIndex.push_back(0);
+
+            if (slot + 1 < m_lineHeightIndex.size())
+                addToLineHeightIndex(slot, m_lines.back().height);
+            else
+            {
+                // Append the slot to the tree, it contains the sum of the slots that lie in its range
+                const std::size_t treeIndex = m_lineHeightIndex.size();
+                const float rangeHeight = sumOfSlots(m_lineHeightIndex, slot) - sumOfSlots(m_lineHeightIndex, treeIndex - lowestBit(treeIndex));
+                m_lineHeightIndex.push_back(m_lines.back().height + rangeHeight);
+            }
+        }
         else
+        {
             m_lines.push_front(std::move(line));
 
+            if (m_firstLineSlot > 0)
+            {
+                --m_firstLineSlot;
+                addToLineHeightIndex(m_firstLineSlot, m_lines.front().height);
+            }
+            else
+                rebuildLineHeightIndex();
+        }
+
         recalculateFullTextHeight();
     }
 
@@ -177,9 +225,30 @@ namespace tgui
 
     bool ChatBox::removeLine(std::size_t lineIndex)
     {
+        invalidate();
+
         if (lineIndex < m_lines.size())
         {
-            m_lines.erase(m_lines.begin() + lineIndex);
+            if (lineIndex == 0)
+            {
+                addToLineHeightIndex(m_firstLineSlot, -m_lines.front().height);
+                m_lines.pop_front();
+                ++m_firstLineSlot;
+
+                // Don't let the unused slots keep growing when lines are constantly added at the bottom and removed from the top
+                if (m_firstLineSlot > m_lines.size() + 16)
+                    rebuildLineHeightIndex();
+            }
+            else if (lineIndex == m_lines.size() - 1)
+            {
+                addToLineHeightIndex(m_firstLineSlot + lineIndex, -m_lines.back().height);
+                m_lines.pop_back();
+            }
+            else
+            {
+                m_lines.erase(m_lines.begin() + lineIndex);
+                rebuildLineHeightIndex();
+            }
 
             recalculateFullTextHeight();
             return true;
@@ -192,7 +261,11 @@ namespace tgui
 
     void ChatBox::removeAllLines()
     {
+        invalidate();
+
         m_lines.clear();
+        m_lineHeightIndex.clear();
+        m_firstLineSlot = 0;
 
         recalculateFullTextHeight();
     }
@@ -208,6 +281,8 @@ namespace tgui
 
     void ChatBox::setLineLimit(std::size_t maxLines)
     {
+        invalidate();
+
         m_maxLines = maxLines;
 
         // Remove the oldest lines if there are too many lines
@@ -218,6 +293,7 @@ namespace tgui
             else
                 m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
 
+            rebuildLineHeightIndex();
             recalculateFullTextHeight();
         }
     }
@@ -233,6 +309,8 @@ namespace tgui
 
     void ChatBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
         m_scroll->setScrollAmount(size);
 
@@ -253,6 +331,8 @@ namespace tgui
 
     void ChatBox::setTextColor(Color color)
     {
+        invalidate();
+
         m_textColor = color;
     }
 
@@ -267,6 +347,8 @@ namespace tgui
 
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
+        invalidate();
+
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
     }
@@ -282,6 +364,8 @@ namespace tgui
 
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
+        invalidate();
+
         m_newLinesBelowOthers = newLinesBelowOthers;
     }
 
@@ -314,7 +398,12 @@ namespace tgui
 
         // Pass the event to the scrollbar
         if (m_scroll->mouseOnWidget(pos - getPosition()))
+        {
             m_scroll->leftMousePressed(pos - getPosition());
+
+            if (wrapVisibleLines())
+                recalculateFullTextHeight();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -322,7 +411,12 @@ namespace tgui
     void ChatBox::leftMouseReleased(Vector2f pos)
     {
         if (m_scroll->isMouseDown())
+        {
             m_scroll->leftMouseReleased(pos - getPosition());
+
+            if (wrapVisibleLines())
+                recalculateFullTextHeight();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,7 +428,12 @@ namespace tgui
 
         // Pass the event to the scrollbar when the mouse is on top of it or when we are dragging its thumb
         if (((m_scroll->isMouseDown()) && (m_scroll->isMouseDownOnThumb())) || m_scroll->mouseOnWidget(pos - getPosition()))
+        {
             m_scroll->mouseMoved(pos - getPosition());
+
+            if (wrapVisibleLines())
+                recalculateFullTextHeight();
+        }
         else
             m_scroll->mouseNoLongerOnWidget();
     }
@@ -362,6 +461,10 @@ namespace tgui
         if (m_scroll->getViewportSize() < m_scroll->getMaximum())
         {
             m_scroll->mouseWheelScrolled(delta, pos - getPosition());
+
+            if (wrapVisibleLines())
+                recalculateFullTextHeight();
+
             return true;
         }
 
@@ -373,6 +476,7 @@ namespace tgui
     void ChatBox::recalculateLineText(Line& line)
     {
         line.text.setString("");
+        line.wrapped = true;
 
         // Find the maximum width of one line
         const float maxWidth = getInnerSize().x - m_scroll->getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
@@ -387,8 +491,13 @@ namespace tgui
     void ChatBox::recalculateAllLines()
     {
         for (auto& line : m_lines)
-            recalculateLineText(line);
+        {
+            line.text.setString("");
+            line.wrapped = false;
+            line.height = estimateLineHeight(line);
+        }
 
+        rebuildLineHeightIndex();
         recalculateFullTextHeight();
     }
 
@@ -396,62 +505,171 @@ namespace tgui
 
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        // Wrapping the lines that become visible can change the full text height, which can in turn change which lines are visible
+        do
+        {
+            m_fullTextHeight = getLineTop(m_lines.size());
+
+            // Update the maximum of the scrollbar
+            const unsigned int oldMaximum = m_scroll->getMaximum();
+            m_scroll->setMaximum(static_cast<unsigned int>(m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize)));
+
+            // Scroll down to the last item when there is a scrollbar and it is at the bottom
+            if (m_newLinesBelowOthers)
+            {
+                if (((oldMaximum >= m_scroll->getViewportSize()) && (m_scroll->getValue() == oldMaximum - m_scroll->getViewportSize()))
+                 || ((oldMaximum <= m_scroll->getViewportSize()) && (m_scroll->getMaximum() > m_scroll->getViewportSize())))
+                {
+                    m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+                }
+            }
+        }
+        while (wrapVisibleLines());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChatBox::wrapVisibleLines()
+    {
+        if (m_lines.empty())
+            return false;
 
-        // Update the maximum of the scrollbar
-        const unsigned int oldMaximum = m_scroll->getMaximum();
-        m_scroll->setMaximum(static_cast<unsigned int>(m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize)));
+        const float visibleTop = static_cast<float>(m_scroll->getValue());
+        const float visibleBottom = visibleTop + m_scroll->getViewportSize();
 
-        // Scroll down to the last item when there is a scrollbar and it is at the bottom
-        if (m_newLinesBelowOthers)
+        bool heightChanged = false;
+        std::size_t lineIndex = findLineAt(visibleTop);
+        float lineTop = getLineTop(lineIndex);
+        for (; (lineIndex < m_lines.size()) && (lineTop < visibleBottom); ++lineIndex)
+        {
+            Line& line = m_lines[lineIndex];
+            if (!line.wrapped)
+            {
+                recalculateLineText(line);
+
+                const float height = line.text.getSize().y;
+                if (height != line.height)
+                {
+                    addToLineHeightIndex(m_firstLineSlot + lineIndex, height - line.height);
+                    line.height = height;
+                    heightChanged = true;
+                }
+            }
+
+            lineTop += line.height;
+        }
+
+        return heightChanged;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::estimateLineHeight(const Line& line) const
+    {
+        // Until the line is word wrapped, assume that it only spans multiple rows where it contains newline characters
+        const auto newlines = static_cast<float>(std::count(line.string.begin(), line.string.end(), '\n'));
+        return (newlines * m_fontCached.getLineSpacing(m_textSize)) + Text::getLineHeight(m_fontCached, m_textSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::rebuildLineHeightIndex()
+    {
+        // Leave free slots in front of the first line when new lines are being inserted at the top
+        m_firstLineSlot = m_newLinesBelowOthers ? 0 : std::max<std::size_t>(m_lines.size(), 16);
+
+        m_lineHeightIndex.assign(m_firstLineSlot + m_lines.size() + 1, 0);
+        for (std::size_t i = 0; i < m_lines.size(); ++i)
+            m_lineHeightIndex[m_firstLineSlot + i + 1] = m_lines[i].height;
+
+        for (std::size_t i = 1; i < m_lineHeightIndex.size(); ++i)
         {
-            if (((oldMaximum >= m_scroll->getViewportSize()) && (m_scroll->getValue() == oldMaximum - m_scroll->getViewportSize()))
-             || ((oldMaximum <= m_scroll->getViewportSize()) && (m_scroll->getMaximum() > m_scroll->getViewportSize())))
+            const std::size_t parent = i + lowestBit(i);
+            if (parent < m_lineHeightIndex.size())
+                m_lineHeightIndex[parent] += m_lineHeightIndex[i];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addToLineHeightIndex(std::size_t slot, float heightDiff)
+    {
+        for (std::size_t i = slot + 1; i < m_lineHeightIndex.size(); i += lowestBit(i))
+            m_lineHeightIndex[i] += heightDiff;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::getLineTop(std::size_t lineIndex) const
+    {
+        return sumOfSlots(m_lineHeightIndex, m_firstLineSlot + lineIndex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ChatBox::findLineAt(float top) const
+    {
+        if (m_lineHeightIndex.empty())
+            return 0;
+
+        // Descend the tree to find the amount of slots that end above the given position
+        std::size_t step = 1;
+        while (step * 2 < m_lineHeightIndex.size())
+            step *= 2;
+
+        std::size_t slotCount = 0;
+        for (; step > 0; step /= 2)
+        {
+            if ((slotCount + step < m_lineHeightIndex.size()) && (m_lineHeightIndex[slotCount + step] <= top))
             {
-                m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+                slotCount += step;
+                top -= m_lineHeightIndex[slotCount];
             }
         }
+
+        if (slotCount < m_firstLineSlot)
+            return 0;
+        else
+            return std::min(slotCount - m_firstLineSlot, m_lines.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::rendererChanged(const std::string& property)
+    void ChatBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (property == PropertyId::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (property == PropertyId::Scrollbar)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
             setSize(m_size);
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -461,7 +679,7 @@ namespace tgui
             for (auto& line : m_lines)
                 line.text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
@@ -593,10 +811,18 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
 
-        for (const auto& line : m_lines)
+        // Only draw the lines that are inside the visible area
+        const float visibleTop = static_cast<float>(m_scroll->getValue());
+        const float visibleBottom = visibleTop + m_scroll->getViewportSize();
+
+        std::size_t lineIndex = findLineAt(visibleTop);
+        float lineTop = getLineTop(lineIndex);
+        states.transform.translate(0, lineTop);
+        for (; (lineIndex < m_lines.size()) && (lineTop < visibleBottom); ++lineIndex)
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            m_lines[lineIndex].text.draw(target, states);
+            states.transform.translate(0, m_lines[lineIndex].height);
+            lineTop += m_lines[lineIndex].height;
         }
     }
 
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -111,6 +112,8 @@ namespace tgui
 
     void CheckBox::setChecked(bool checked)
     {
+        invalidate();
+
         if (checked && !m_checked)
         {
             m_checked = true;
@@ -151,11 +154,11 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBox::rendererChanged(const std::string& property)
+    void CheckBox::rendererChanged(PropertyId property)
     {
-        if (property == "textureunchecked")
+        if (property == PropertyId::TextureUnchecked)
             m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "texturechecked")
+        else if (property == PropertyId::TextureChecked)
             m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
 
         RadioButton::rendererChanged(property);
@@ -248,7 +251,7 @@ namespace tgui
                 const Vector2f rightPoint = {0.86f * size.x, 0.28f * size.y};
                 const float x = (lineThickness / 2.f) * std::cos(pi / 4.f);
                 const float y = (lineThickness / 2.f) * std::sin(pi / 4.f);
-                const std::vector<sf::Vertex> vertices = {
+                const sf::Vertex vertices[] = {
                     {{leftPoint.x - x, leftPoint.y + y}, checkColor},
                     {{leftPoint.x + x, leftPoint.y - y}, checkColor},
                     {{middlePoint.x, middlePoint.y + 2*y}, checkColor},
@@ -257,7 +260,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                DrawBatch::addVertices(target, states, vertices, 6, sf::PrimitiveType::TrianglesStrip);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
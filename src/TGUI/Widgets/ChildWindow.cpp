@@ -247,6 +247,8 @@ namespace tgui
 
     void ChildWindow::setTitle(const sf::String& title)
     {
+        invalidate();
+
         m_titleText.setString(title);
 
         // Reposition the images and text
@@ -264,6 +266,8 @@ namespace tgui
 
     void ChildWindow::setTitleTextSize(unsigned int size)
     {
+        invalidate();
+
         m_titleTextSize = size;
 
         if (m_titleTextSize)
@@ -283,6 +287,8 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        invalidate();
+
         m_titleAlignment = alignment;
 
         // Reposition the images and text
@@ -300,6 +306,8 @@ namespace tgui
 
     void ChildWindow::setTitleButtons(unsigned int buttons)
     {
+        invalidate();
+
         m_titleButtons = buttons;
 
         if (m_titleButtons & TitleButton::Close)
@@ -426,6 +434,22 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ChildWindow::mouseOnWidget(Vector2f pos) const
+    {
+        if (getHitTestBounds().contains(pos))
+        {
+            // If the mouse enters the border or title bar then then none of the widgets can still be under the mouse
+            if (m_widgetBelowMouse && !FloatRect{getPosition() + getChildWidgetsOffset(), getSize()}.contains(pos))
+                m_widgetBelowMouse->mouseNoLongerOnWidget();
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect ChildWindow::getHitTestBounds() const
     {
         FloatRect region{getPosition(), getFullSize()};
 
@@ -440,16 +464,7 @@ namespace tgui
                              + std::max(0.f, m_MinimumResizableBorderWidthCached - m_bordersCached.getBottom());
         }
 
-        if (region.contains(pos))
-        {
-            // If the mouse enters the border or title bar then then none of the widgets can still be under the mouse
-            if (m_widgetBelowMouse && !FloatRect{getPosition() + getChildWidgetsOffset(), getSize()}.contains(pos))
-                m_widgetBelowMouse->mouseNoLongerOnWidget();
-
-            return true;
-        }
-
-        return false;
+        return region;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -491,6 +506,8 @@ namespace tgui
         }
         else if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getSize().x, m_titleBarHeightCached}.contains(pos))
         {
+            invalidateTitleBar();
+
             // Send the mouse press event to the title buttons
             for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
             {
@@ -533,6 +550,8 @@ namespace tgui
             // Check if the mouse is on top of the title bar
             if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getSize().x, m_titleBarHeightCached}.contains(pos))
             {
+                invalidateTitleBar();
+
                 // Send the mouse release event to the title buttons
                 for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
                 {
@@ -623,6 +642,8 @@ namespace tgui
                 if (!m_mouseHover)
                     mouseEnteredWidget();
 
+                invalidateTitleBar();
+
                 // Check if the mouse is on top of the title bar
                 if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getSize().x, m_titleBarHeightCached}.contains(pos))
                 {
@@ -655,6 +676,7 @@ namespace tgui
     void ChildWindow::mouseNoLongerOnWidget()
     {
         Container::mouseNoLongerOnWidget();
+        invalidateTitleBar();
 
         for (const auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
         {
@@ -668,6 +690,7 @@ namespace tgui
     void ChildWindow::mouseNoLongerDown()
     {
         Container::mouseNoLongerDown();
+        invalidateTitleBar();
 
         for (const auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
         {
@@ -678,6 +701,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChildWindow::invalidateTitleBar()
+    {
+        if (m_parent)
+        {
+            m_parent->invalidateRegion({m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset() + getPosition(),
+                                        {getFullSize().x, m_bordersCached.getTop() + m_titleBarHeightCached}});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChildWindow::updateTitleBarHeight()
     {
         m_spriteTitleBar.setSize({getSize().x, m_titleBarHeightCached});
@@ -725,18 +759,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::rendererChanged(const std::string& property)
+    void ChildWindow::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "titlecolor")
+        else if (property == PropertyId::TitleColor)
         {
             m_titleText.setColor(getSharedRenderer()->getTitleColor());
         }
-        else if (property == "texturetitlebar")
+        else if (property == PropertyId::TextureTitleBar)
         {
             m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
@@ -745,35 +779,35 @@ namespace tgui
             if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
                 updateTitleBarHeight();
         }
-        else if (property == "titlebarheight")
+        else if (property == PropertyId::TitleBarHeight)
         {
             m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
             updateTitleBarHeight();
         }
-        else if (property == "borderbelowtitlebar")
+        else if (property == PropertyId::BorderBelowTitleBar)
         {
             m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
         }
-        else if (property == "distancetoside")
+        else if (property == PropertyId::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             setPosition(m_position);
         }
-        else if (property == "paddingbetweenbuttons")
+        else if (property == PropertyId::PaddingBetweenButtons)
         {
             m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
             setPosition(m_position);
         }
-        else if (property == "minimumresizableborderwidth")
+        else if (property == PropertyId::MinimumResizableBorderWidth)
         {
             m_MinimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
         }
-        else if (property == "showtextontitlebuttons")
+        else if (property == PropertyId::ShowTextOnTitleButtons)
         {
             m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
             setTitleButtons(m_titleButtons);
         }
-        else if (property == "closebutton")
+        else if (property == PropertyId::CloseButton)
         {
             if (m_closeButton->isVisible())
             {
@@ -783,7 +817,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "maximizebutton")
+        else if (property == PropertyId::MaximizeButton)
         {
             if (m_maximizeButton->isVisible())
             {
@@ -793,7 +827,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "minimizebutton")
+        else if (property == PropertyId::MinimizeButton)
         {
             if (m_minimizeButton->isVisible())
             {
@@ -803,19 +837,19 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "titlebarcolor")
+        else if (property == PropertyId::TitleBarColor)
         {
             m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Container::rendererChanged(property);
 
@@ -828,7 +862,7 @@ namespace tgui
             m_titleText.setOpacity(m_opacityCached);
             m_spriteTitleBar.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Container::rendererChanged(property);
 
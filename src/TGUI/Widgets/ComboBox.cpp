@@ -25,8 +25,8 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Clipping.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
 #include <TGUI/SignalImpl.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -73,6 +73,7 @@ namespace tgui
         m_arrowBackgroundColorHoverCached{other.m_arrowBackgroundColorHoverCached}
     {
         initListBox();
+        connectItemProvider();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +98,11 @@ namespace tgui
         m_arrowBackgroundColorHoverCached{std::move(other.m_arrowBackgroundColorHoverCached)}
     {
         initListBox();
+
+        // The listener of the other combo box refers to that combo box, so replace it
+        std::swap(m_itemProviderListenerId, other.m_itemProviderListenerId);
+        disconnectItemProvider();
+        connectItemProvider();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +114,9 @@ namespace tgui
             ComboBox temp{other};
             Widget::operator=(other);
 
+            disconnectItemProvider();
+            temp.disconnectItemProvider();
+
             std::swap(onItemSelect,                      temp.onItemSelect);
             std::swap(m_nrOfItemsToDisplay,              temp.m_nrOfItemsToDisplay);
             std::swap(m_listBox,                         temp.m_listBox);
@@ -124,6 +133,8 @@ namespace tgui
             std::swap(m_arrowColorHoverCached,           temp.m_arrowColorHoverCached);
             std::swap(m_arrowBackgroundColorCached,      temp.m_arrowBackgroundColorCached);
             std::swap(m_arrowBackgroundColorHoverCached, temp.m_arrowBackgroundColorHoverCached);
+
+            connectItemProvider();
         }
 
         return *this;
@@ -135,6 +146,8 @@ namespace tgui
     {
         if (this != &other)
         {
+            disconnectItemProvider();
+
             Widget::operator=(std::move(other));
             onItemSelect                      = std::move(other.onItemSelect);
             m_nrOfItemsToDisplay              = std::move(other.m_nrOfItemsToDisplay);
@@ -152,6 +165,10 @@ namespace tgui
             m_arrowColorHoverCached           = std::move(other.m_arrowColorHoverCached);
             m_arrowBackgroundColorCached      = std::move(other.m_arrowBackgroundColorCached);
             m_arrowBackgroundColorHoverCached = std::move(other.m_arrowBackgroundColorHoverCached);
+
+            std::swap(m_itemProviderListenerId, other.m_itemProviderListenerId);
+            disconnectItemProvider();
+            connectItemProvider();
         }
 
         return *this;
@@ -159,6 +176,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    ComboBox::~ComboBox()
+    {
+        disconnectItemProvider();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ComboBox::Ptr ComboBox::create()
     {
         return std::make_shared<ComboBox>();
@@ -258,6 +282,8 @@ namespace tgui
 
     bool ComboBox::addItem(const sf::String& item, const sf::String& id)
     {
+        invalidate();
+
         const bool ret = m_listBox->addItem(item, id);
         updateListBoxHeight();
         return ret;
@@ -267,6 +293,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItem(const sf::String& itemName)
     {
+        invalidate();
+
         const bool ret = m_listBox->setSelectedItem(itemName);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -276,6 +304,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemById(const sf::String& id)
     {
+        invalidate();
+
         const bool ret = m_listBox->setSelectedItemById(id);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -285,6 +315,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -294,6 +326,8 @@ namespace tgui
 
     void ComboBox::deselectItem()
     {
+        invalidate();
+
         m_text.setString("");
         m_listBox->deselectItem();
     }
@@ -302,6 +336,8 @@ namespace tgui
 
     bool ComboBox::removeItem(const sf::String& itemName)
     {
+        invalidate();
+
         // Implemented like removeItemByIndex instead of like removeItemById because m_listBox->getItems() may be slow
 
         const bool ret = m_listBox->removeItem(itemName);
@@ -319,6 +355,8 @@ namespace tgui
 
     bool ComboBox::removeItemById(const sf::String& id)
     {
+        invalidate();
+
         const auto& ids = m_listBox->getItemIds();
         for (std::size_t i = 0; i < ids.size(); ++i)
         {
@@ -333,6 +371,8 @@ namespace tgui
 
     bool ComboBox::removeItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
@@ -348,8 +388,10 @@ namespace tgui
 
     void ComboBox::removeAllItems()
     {
-        m_text.setString("");
+        invalidate();
+
         m_listBox->removeAllItems();
+        m_text.setString(m_listBox->getSelectedItem());
 
         updateListBoxHeight();
     }
@@ -386,6 +428,8 @@ namespace tgui
 
     bool ComboBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -395,6 +439,8 @@ namespace tgui
 
     bool ComboBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -404,6 +450,8 @@ namespace tgui
 
     bool ComboBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -425,6 +473,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::setItemProvider(ItemProvider::Ptr provider)
+    {
+        invalidate();
+
+        disconnectItemProvider();
+        m_listBox->setItemProvider(std::move(provider));
+        connectItemProvider();
+
+        m_text.setString(m_listBox->getSelectedItem());
+        updateListBoxHeight();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemProvider::Ptr ComboBox::getItemProvider() const
+    {
+        return m_listBox->getItemProvider();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
         m_listBox->setMaximumItems(maximumItems);
@@ -441,6 +510,8 @@ namespace tgui
 
     void ComboBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
     }
@@ -566,68 +637,68 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::rendererChanged(const std::string& property)
+    void ComboBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (property == PropertyId::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_text.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyle)
         {
             m_text.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturearrow")
+        else if (property == PropertyId::TextureArrow)
         {
             m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
             setSize(m_size);
         }
-        else if (property == "texturearrowhover")
+        else if (property == PropertyId::TextureArrowHover)
         {
             m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
         }
-        else if (property == "listbox")
+        else if (property == PropertyId::ListBox)
         {
             m_listBox->setRenderer(getSharedRenderer()->getListBox());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolor")
+        else if (property == PropertyId::ArrowBackgroundColor)
         {
             m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolorhover")
+        else if (property == PropertyId::ArrowBackgroundColorHover)
         {
             m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == PropertyId::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == PropertyId::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -637,7 +708,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
@@ -833,6 +904,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::connectItemProvider()
+    {
+        const auto provider = m_listBox->getItemProvider();
+        if (provider)
+        {
+            // The list box was connected first, so it has already handled the change when this function is called
+            m_itemProviderListenerId = provider->connect([this](ItemProvider::Change, std::size_t, std::size_t){
+                invalidate();
+                m_text.setString(m_listBox->getSelectedItem());
+                updateListBoxHeight();
+            });
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::disconnectItemProvider()
+    {
+        if (m_listBox && m_itemProviderListenerId)
+        {
+            const auto provider = m_listBox->getItemProvider();
+            if (provider)
+                provider->disconnect(m_itemProviderListenerId);
+        }
+
+        m_itemProviderListenerId = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -874,17 +975,20 @@ namespace tgui
             else
                 drawRectangleShape(target, states, {arrowSize, arrowSize}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
-            arrow.setPoint(0, {arrowSize / 5, arrowSize / 5});
-            arrow.setPoint(1, {arrowSize / 2, arrowSize * 4/5});
-            arrow.setPoint(2, {arrowSize * 4/5, arrowSize / 5});
+            sf::Vertex arrow[3];
+            sf::Color arrowColor;
+            arrow[0].position = {arrowSize / 5, arrowSize / 5};
+            arrow[1].position = {arrowSize / 2, arrowSize * 4/5};
+            arrow[2].position = {arrowSize * 4/5, arrowSize / 5};
 
             if (m_mouseHover && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(m_arrowColorHoverCached);
+                arrowColor = m_arrowColorHoverCached;
             else
-                arrow.setFillColor(m_arrowColorCached);
+                arrowColor = m_arrowColorCached;
 
-            target.draw(arrow, states);
+            for (auto& vertex : arrow)
+                vertex.color = arrowColor;
+            DrawBatch::addVertices(target, states, arrow, 3, sf::PrimitiveType::Triangles);
         }
 
         // Draw the selected item
@@ -146,6 +146,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Check if the text is auto sized
         if (m_textSize == 0)
         {
@@ -241,6 +243,8 @@ namespace tgui
 
     void EditBox::setDefaultText(const sf::String& text)
     {
+        invalidate();
+
         m_defaultText.setString(text);
     }
 
@@ -255,6 +259,8 @@ namespace tgui
 
     void EditBox::selectText(std::size_t start, std::size_t length)
     {
+        invalidate();
+
         m_selStart = start;
         m_selEnd = std::min(m_text.getSize(), start + length);
         updateSelection();
@@ -271,6 +277,8 @@ namespace tgui
 
     void EditBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_textSize = size;
 
@@ -289,6 +297,8 @@ namespace tgui
 
     void EditBox::setPasswordCharacter(char passwordChar)
     {
+        invalidate();
+
         // Change the password character
         m_passwordChar = passwordChar;
 
@@ -307,6 +317,8 @@ namespace tgui
 
     void EditBox::setMaximumCharacters(unsigned int maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_maxChars = maxChars;
 
@@ -341,6 +353,8 @@ namespace tgui
 
     void EditBox::setAlignment(Alignment alignment)
     {
+        invalidate();
+
         m_textAlignment = alignment;
         setText(m_text);
     }
@@ -396,6 +410,8 @@ namespace tgui
 
     void EditBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -410,6 +426,8 @@ namespace tgui
 
     void EditBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
+        invalidate();
+
         // The caret position has to stay inside the string
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
@@ -452,6 +470,9 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+
+            // Let the caret blink
+            scheduleUpdates();
         }
         else // Unfocusing
         {
@@ -521,6 +542,7 @@ namespace tgui
 
             // If the next click comes soon enough then it will be a double click
             m_possibleDoubleClick = true;
+            scheduleUpdates();
         }
 
         // Set the mouse down flag
@@ -954,14 +976,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBox::rendererChanged(const std::string& property)
+    void EditBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (property == PropertyId::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
@@ -970,40 +992,40 @@ namespace tgui
 
             m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if (property == "caretwidth")
+        else if (property == PropertyId::CaretWidth)
         {
             m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
             m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if ((property == "textcolor") || (property == "textcolordisabled") || (property == "textcolorfocused"))
+        else if ((property == PropertyId::TextColor) || (property == PropertyId::TextColorDisabled) || (property == PropertyId::TextColorFocused))
         {
             updateTextColor();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == "defaulttextcolor")
+        else if (property == PropertyId::DefaultTextColor)
         {
             m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
         }
-        else if (property == "texture")
+        else if (property == PropertyId::Texture)
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == "texturehover")
+        else if (property == PropertyId::TextureHover)
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == "texturedisabled")
+        else if (property == PropertyId::TextureDisabled)
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == "texturefocused")
+        else if (property == PropertyId::TextureFocused)
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyle)
         {
             const TextStyle style = getSharedRenderer()->getTextStyle();
             m_textBeforeSelection.setStyle(style);
@@ -1011,59 +1033,59 @@ namespace tgui
             m_textSelection.setStyle(style);
             m_textFull.setStyle(style);
         }
-        else if (property == "defaulttextstyle")
+        else if (property == PropertyId::DefaultTextStyle)
         {
             m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == PropertyId::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == PropertyId::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == PropertyId::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == PropertyId::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorfocused")
+        else if (property == PropertyId::BackgroundColorFocused)
         {
             m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
         }
-        else if (property == "caretcolor")
+        else if (property == PropertyId::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == "caretcolorhover")
+        else if (property == PropertyId::CaretColorHover)
         {
             m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
         }
-        else if (property == "caretcolorfocused")
+        else if (property == PropertyId::CaretColorFocused)
         {
             m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (property == PropertyId::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -1077,7 +1099,7 @@ namespace tgui
             m_spriteDisabled.setOpacity(m_opacityCached);
             m_spriteFocused.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
@@ -1246,9 +1268,9 @@ namespace tgui
                 continue;
             }
             else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
+                charWidth = m_fontCached.getAdvance(' ', textSize, bold) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+                charWidth = m_fontCached.getAdvance(curChar, textSize, bold);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, textSize);
             if (width + charWidth < posX)
@@ -1453,6 +1475,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1461,6 +1485,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool EditBox::isUpdateNeeded() const
+    {
+        return Widget::isUpdateNeeded() || m_focused || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time EditBox::getTimeUntilNextUpdate() const
+    {
+        // The caret blinks every half second, which is also when a possible double click expires
+        sf::Time time = Widget::getTimeUntilNextUpdate();
+        if (m_focused || m_possibleDoubleClick)
+            time = std::min(time, std::max(sf::Time::Zero, sf::milliseconds(500) - m_animationTimeElapsed));
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
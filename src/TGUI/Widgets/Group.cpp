@@ -143,9 +143,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Group::rendererChanged(const std::string& property)
+    void Group::rendererChanged(PropertyId property)
     {
-        if (property == "padding")
+        if (property == PropertyId::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
@@ -24,7 +24,8 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
-#include <SFML/Graphics/CircleShape.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/PrimitiveBuilder.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -103,6 +104,7 @@ namespace tgui
         Widget::setSize(size);
 
         m_bordersCached.updateParentSize(getSize());
+        m_verticesNeedUpdate = true;
 
         if (m_spriteBackground.isSet() && m_spriteForeground.isSet())
         {
@@ -116,6 +118,8 @@ namespace tgui
 
     void Knob::setStartRotation(float startRotation)
     {
+        invalidate();
+
         while (startRotation >= 360)
             startRotation -= 360;
         while (startRotation < 0)
@@ -138,6 +142,8 @@ namespace tgui
 
     void Knob::setEndRotation(float endRotation)
     {
+        invalidate();
+
         while (endRotation >= 360)
             endRotation -= 360;
         while (endRotation < 0)
@@ -160,6 +166,8 @@ namespace tgui
 
     void Knob::setMinimum(int minimum)
     {
+        invalidate();
+
         if (m_minimum != minimum)
         {
             // Set the new minimum
@@ -189,6 +197,8 @@ namespace tgui
 
     void Knob::setMaximum(int maximum)
     {
+        invalidate();
+
         if (m_maximum != maximum)
         {
             // Set the new maximum
@@ -221,6 +231,8 @@ namespace tgui
 
     void Knob::setValue(int value)
     {
+        invalidate();
+
         if (m_value != value)
         {
             // Set the new value
@@ -250,6 +262,8 @@ namespace tgui
 
     void Knob::setClockwiseTurning(bool clockwise)
     {
+        invalidate();
+
         m_clockwiseTurning = clockwise;
 
         // The knob might have to point in a different direction even though it has the same value
@@ -321,6 +335,8 @@ namespace tgui
         // Check if the mouse button is down
         if (m_mouseDown)
         {
+            m_verticesNeedUpdate = true;
+
             // Find out the direction that the knob should now point
             if (compareFloats(pos.x, centerPosition.x))
             {
@@ -427,6 +443,8 @@ namespace tgui
 
     void Knob::recalculateRotation()
     {
+        m_verticesNeedUpdate = true;
+
         // Calculate the difference in degrees between the start and end rotation
         float allowedAngle = 0;
         if (compareFloats(m_startRotation, m_endRotation))
@@ -471,40 +489,42 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Knob::rendererChanged(const std::string& property)
+    void Knob::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        m_verticesNeedUpdate = true;
+
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
             setSize(m_size);
         }
-        else if (property == "textureforeground")
+        else if (property == PropertyId::TextureForeground)
         {
             m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
             setSize(m_size);
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "thumbcolor")
+        else if (property == PropertyId::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "imagerotation")
+        else if (property == PropertyId::ImageRotation)
         {
             m_imageRotationCached = getSharedRenderer()->getImageRotation();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -560,34 +580,51 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Knob::updateVertices() const
+    {
+        m_vertices.clear();
+
+        const float size = std::min(getInnerSize().x, getInnerSize().y);
+        const float radius = size / 2;
+        const Vector2f center = {radius, radius};
+
+        const float borderThickness = std::min({m_bordersCached.getLeft(), m_bordersCached.getTop(), m_bordersCached.getRight(), m_bordersCached.getBottom()});
+        if (borderThickness > 0)
+            PrimitiveBuilder::addRing(m_vertices, center, radius, radius + borderThickness, Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
+
+        m_backgroundVerticesStart = m_vertices.size();
+        PrimitiveBuilder::addCircle(m_vertices, center, radius, Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+
+        m_thumbVerticesStart = m_vertices.size();
+        PrimitiveBuilder::addCircle(m_vertices,
+                                    {radius + (std::cos(m_angle / 180 * pi) * radius * 3/5), radius + (-std::sin(m_angle / 180 * pi) * radius * 3/5)},
+                                    size / 10.0f, Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
+
+        m_verticesNeedUpdate = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Knob::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
 
-        const float size = std::min(getInnerSize().x, getInnerSize().y);
+        if (m_verticesNeedUpdate)
+            updateVertices();
 
-        // Draw the borders
+        // The circles are positioned inside the borders
         const float borderThickness = std::min({m_bordersCached.getLeft(), m_bordersCached.getTop(), m_bordersCached.getRight(), m_bordersCached.getBottom()});
         if (borderThickness > 0)
-        {
             states.transform.translate({borderThickness, borderThickness});
 
-            sf::CircleShape bordersShape{size / 2};
-            bordersShape.setFillColor(Color::Transparent);
-            bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
-            bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
-        }
-
-        // Draw the background
+        // Draw the borders and the background
         if (m_spriteBackground.isSet())
-            m_spriteBackground.draw(target, states);
-        else
         {
-            sf::CircleShape background{size / 2};
-            background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            DrawBatch::addVertices(target, states, m_vertices.data(), m_backgroundVerticesStart, sf::PrimitiveType::Triangles);
+            m_spriteBackground.draw(target, states);
         }
+        else
+            DrawBatch::addVertices(target, states, m_vertices.data(), m_thumbVerticesStart, sf::PrimitiveType::Triangles);
 
         // Draw the foreground
         if (m_spriteForeground.isSet())
@@ -604,11 +641,8 @@ namespace tgui
         }
         else
         {
-            sf::CircleShape thumb{size / 10.0f};
-            thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
-            thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
-                               (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            DrawBatch::addVertices(target, states, m_vertices.data() + m_thumbVerticesStart,
+                                   m_vertices.size() - m_thumbVerticesStart, sf::PrimitiveType::Triangles);
         }
     }
 
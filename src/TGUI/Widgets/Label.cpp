@@ -116,6 +116,8 @@ namespace tgui
 
     void Label::setText(const sf::String& string)
     {
+        invalidate();
+
         m_string = string;
         rearrangeText();
     }
@@ -131,6 +133,8 @@ namespace tgui
 
     void Label::setTextSize(unsigned int size)
     {
+        invalidate();
+
         if (size != m_textSize)
         {
             m_textSize = size;
@@ -149,6 +153,8 @@ namespace tgui
 
     void Label::setHorizontalAlignment(HorizontalAlignment alignment)
     {
+        invalidate();
+
         m_horizontalAlignment = alignment;
         rearrangeText();
     }
@@ -164,6 +170,8 @@ namespace tgui
 
     void Label::setVerticalAlignment(VerticalAlignment alignment)
     {
+        invalidate();
+
         m_verticalAlignment = alignment;
         rearrangeText();
     }
@@ -179,6 +187,8 @@ namespace tgui
 
     void Label::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         if (m_autoSize != autoSize)
         {
             m_autoSize = autoSize;
@@ -197,6 +207,8 @@ namespace tgui
 
     void Label::setMaximumTextWidth(float maximumWidth)
     {
+        invalidate();
+
         if (m_maximumTextWidth != maximumWidth)
         {
             m_maximumTextWidth = maximumWidth;
@@ -264,6 +276,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdates();
             }
         }
     }
@@ -280,45 +293,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::rendererChanged(const std::string& property)
+    void Label::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             rearrangeText();
         }
-        else if (property == "padding")
+        else if (property == PropertyId::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
             rearrangeText();
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
             rearrangeText();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             for (auto& line : m_lines)
                 line.setColor(m_textColorCached);
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
             rearrangeText();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -414,6 +427,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Label::isUpdateNeeded() const
+    {
+        return Widget::isUpdateNeeded() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Label::getTimeUntilNextUpdate() const
+    {
+        sf::Time time = Widget::getTimeUntilNextUpdate();
+        if (m_possibleDoubleClick)
+            time = std::min(time, std::max(sf::Time::Zero, sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed));
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Label::rearrangeText()
     {
         m_lines.clear();
@@ -30,6 +30,20 @@
 
 namespace tgui
 {
+    namespace
+    {
+        std::string toUtf8(const sf::String& str)
+        {
+            const auto utf8 = str.toUtf8();
+            return std::string(utf8.begin(), utf8.end());
+        }
+
+        sf::String fromUtf8(const std::string& str)
+        {
+            return sf::String::fromUtf8(str.begin(), str.end());
+        }
+    }
+
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox()
@@ -49,6 +63,206 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::size_t ListBox::IdHash::operator()(const sf::String& id) const
+    {
+        // FNV-1a hash over the UTF-32 characters
+        std::size_t hash = 2166136261u;
+        const sf::Uint32* data = id.getData();
+        for (std::size_t i = 0; i < id.getSize(); ++i)
+        {
+            hash ^= data[i];
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBox::ListBox(const ListBox& other) :
+        Widget                              {other},
+        onItemSelect                        {other.onItemSelect},
+        onMousePress                        {other.onMousePress},
+        onMouseRelease                      {other.onMouseRelease},
+        onDoubleClick                       {other.onDoubleClick},
+        m_items                             {other.m_items},
+        m_itemIds                           {other.m_itemIds},
+        m_selectedItem                      {other.m_selectedItem},
+        m_hoveringItem                      {other.m_hoveringItem},
+        m_itemHeight                        {other.m_itemHeight},
+        m_requestedTextSize                 {other.m_requestedTextSize},
+        m_textSize                          {other.m_textSize},
+        m_maxItems                          {other.m_maxItems},
+        m_scroll                            {other.m_scroll},
+        m_possibleDoubleClick               {other.m_possibleDoubleClick},
+        m_autoScroll                        {other.m_autoScroll},
+        m_spriteBackground                  {other.m_spriteBackground},
+        m_bordersCached                     {other.m_bordersCached},
+        m_paddingCached                     {other.m_paddingCached},
+        m_borderColorCached                 {other.m_borderColorCached},
+        m_backgroundColorCached             {other.m_backgroundColorCached},
+        m_backgroundColorHoverCached        {other.m_backgroundColorHoverCached},
+        m_selectedBackgroundColorCached     {other.m_selectedBackgroundColorCached},
+        m_selectedBackgroundColorHoverCached{other.m_selectedBackgroundColorHoverCached},
+        m_textColorCached                   {other.m_textColorCached},
+        m_textColorHoverCached              {other.m_textColorHoverCached},
+        m_selectedTextColorCached           {other.m_selectedTextColorCached},
+        m_selectedTextColorHoverCached      {other.m_selectedTextColorHoverCached},
+        m_textStyleCached                   {other.m_textStyleCached},
+        m_selectedTextStyleCached           {other.m_selectedTextStyleCached}
+    {
+        // The listener of the other list box refers to that list box, so the copy needs its own
+        m_itemProvider = other.m_itemProvider;
+        connectItemProvider();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBox::ListBox(ListBox&& other) :
+        Widget                              {std::move(other)},
+        onItemSelect                        {std::move(other.onItemSelect)},
+        onMousePress                        {std::move(other.onMousePress)},
+        onMouseRelease                      {std::move(other.onMouseRelease)},
+        onDoubleClick                       {std::move(other.onDoubleClick)},
+        m_items                             {std::move(other.m_items)},
+        m_itemIds                           {std::move(other.m_itemIds)},
+        m_selectedItem                      {std::move(other.m_selectedItem)},
+        m_hoveringItem                      {std::move(other.m_hoveringItem)},
+        m_itemHeight                        {std::move(other.m_itemHeight)},
+        m_requestedTextSize                 {std::move(other.m_requestedTextSize)},
+        m_textSize                          {std::move(other.m_textSize)},
+        m_maxItems                          {std::move(other.m_maxItems)},
+        m_scroll                            {std::move(other.m_scroll)},
+        m_possibleDoubleClick               {std::move(other.m_possibleDoubleClick)},
+        m_autoScroll                        {std::move(other.m_autoScroll)},
+        m_spriteBackground                  {std::move(other.m_spriteBackground)},
+        m_bordersCached                     {std::move(other.m_bordersCached)},
+        m_paddingCached                     {std::move(other.m_paddingCached)},
+        m_borderColorCached                 {std::move(other.m_borderColorCached)},
+        m_backgroundColorCached             {std::move(other.m_backgroundColorCached)},
+        m_backgroundColorHoverCached        {std::move(other.m_backgroundColorHoverCached)},
+        m_selectedBackgroundColorCached     {std::move(other.m_selectedBackgroundColorCached)},
+        m_selectedBackgroundColorHoverCached{std::move(other.m_selectedBackgroundColorHoverCached)},
+        m_textColorCached                   {std::move(other.m_textColorCached)},
+        m_textColorHoverCached              {std::move(other.m_textColorHoverCached)},
+        m_selectedTextColorCached           {std::move(other.m_selectedTextColorCached)},
+        m_selectedTextColorHoverCached      {std::move(other.m_selectedTextColorHoverCached)},
+        m_textStyleCached                   {std::move(other.m_textStyleCached)},
+        m_selectedTextStyleCached           {std::move(other.m_selectedTextStyleCached)}
+    {
+        other.disconnectItemProvider();
+        m_itemProvider = std::move(other.m_itemProvider);
+        connectItemProvider();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBox& ListBox::operator= (const ListBox& other)
+    {
+        if (this != &other)
+        {
+            ListBox temp{other};
+            Widget::operator=(other);
+
+            std::swap(onItemSelect,                         temp.onItemSelect);
+            std::swap(onMousePress,                         temp.onMousePress);
+            std::swap(onMouseRelease,                       temp.onMouseRelease);
+            std::swap(onDoubleClick,                        temp.onDoubleClick);
+            std::swap(m_items,                              temp.m_items);
+            std::swap(m_itemIds,                            temp.m_itemIds);
+            std::swap(m_selectedItem,                       temp.m_selectedItem);
+            std::swap(m_hoveringItem,                       temp.m_hoveringItem);
+            std::swap(m_itemHeight,                         temp.m_itemHeight);
+            std::swap(m_requestedTextSize,                  temp.m_requestedTextSize);
+            std::swap(m_textSize,                           temp.m_textSize);
+            std::swap(m_maxItems,                           temp.m_maxItems);
+            std::swap(m_scroll,                             temp.m_scroll);
+            std::swap(m_possibleDoubleClick,                temp.m_possibleDoubleClick);
+            std::swap(m_autoScroll,                         temp.m_autoScroll);
+            std::swap(m_spriteBackground,                   temp.m_spriteBackground);
+            std::swap(m_bordersCached,                      temp.m_bordersCached);
+            std::swap(m_paddingCached,                      temp.m_paddingCached);
+            std::swap(m_borderColorCached,                  temp.m_borderColorCached);
+            std::swap(m_backgroundColorCached,              temp.m_backgroundColorCached);
+            std::swap(m_backgroundColorHoverCached,         temp.m_backgroundColorHoverCached);
+            std::swap(m_selectedBackgroundColorCached,      temp.m_selectedBackgroundColorCached);
+            std::swap(m_selectedBackgroundColorHoverCached, temp.m_selectedBackgroundColorHoverCached);
+            std::swap(m_textColorCached,                    temp.m_textColorCached);
+            std::swap(m_textColorHoverCached,               temp.m_textColorHoverCached);
+            std::swap(m_selectedTextColorCached,            temp.m_selectedTextColorCached);
+            std::swap(m_selectedTextColorHoverCached,       temp.m_selectedTextColorHoverCached);
+            std::swap(m_textStyleCached,                    temp.m_textStyleCached);
+            std::swap(m_selectedTextStyleCached,            temp.m_selectedTextStyleCached);
+
+            disconnectItemProvider();
+            m_itemProvider = other.m_itemProvider;
+            connectItemProvider();
+
+            m_idIndexValid = false;
+            m_visibleItemsNeedUpdate = true;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBox& ListBox::operator= (ListBox&& other)
+    {
+        if (this != &other)
+        {
+            Widget::operator=(std::move(other));
+            onItemSelect                         = std::move(other.onItemSelect);
+            onMousePress                         = std::move(other.onMousePress);
+            onMouseRelease                       = std::move(other.onMouseRelease);
+            onDoubleClick                        = std::move(other.onDoubleClick);
+            m_items                              = std::move(other.m_items);
+            m_itemIds                            = std::move(other.m_itemIds);
+            m_selectedItem                       = std::move(other.m_selectedItem);
+            m_hoveringItem                       = std::move(other.m_hoveringItem);
+            m_itemHeight                         = std::move(other.m_itemHeight);
+            m_requestedTextSize                  = std::move(other.m_requestedTextSize);
+            m_textSize                           = std::move(other.m_textSize);
+            m_maxItems                           = std::move(other.m_maxItems);
+            m_scroll                             = std::move(other.m_scroll);
+            m_possibleDoubleClick                = std::move(other.m_possibleDoubleClick);
+            m_autoScroll                         = std::move(other.m_autoScroll);
+            m_spriteBackground                   = std::move(other.m_spriteBackground);
+            m_bordersCached                      = std::move(other.m_bordersCached);
+            m_paddingCached                      = std::move(other.m_paddingCached);
+            m_borderColorCached                  = std::move(other.m_borderColorCached);
+            m_backgroundColorCached              = std::move(other.m_backgroundColorCached);
+            m_backgroundColorHoverCached         = std::move(other.m_backgroundColorHoverCached);
+            m_selectedBackgroundColorCached      = std::move(other.m_selectedBackgroundColorCached);
+            m_selectedBackgroundColorHoverCached = std::move(other.m_selectedBackgroundColorHoverCached);
+            m_textColorCached                    = std::move(other.m_textColorCached);
+            m_textColorHoverCached               = std::move(other.m_textColorHoverCached);
+            m_selectedTextColorCached            = std::move(other.m_selectedTextColorCached);
+            m_selectedTextColorHoverCached       = std::move(other.m_selectedTextColorHoverCached);
+            m_textStyleCached                    = std::move(other.m_textStyleCached);
+            m_selectedTextStyleCached            = std::move(other.m_selectedTextStyleCached);
+
+            disconnectItemProvider();
+            other.disconnectItemProvider();
+            m_itemProvider = std::move(other.m_itemProvider);
+            connectItemProvider();
+
+            m_idIndexValid = false;
+            m_visibleItemsNeedUpdate = true;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListBox::~ListBox()
+    {
+        disconnectItemProvider();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ListBox::Ptr ListBox::create()
     {
         return std::make_shared<ListBox>();
@@ -98,9 +312,6 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].getSize().y) / 2.0f)});
-
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
 
@@ -125,6 +336,12 @@ namespace tgui
 
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
+        invalidate();
+
+        // The items can only be changed in the item provider when there is one
+        if (m_itemProvider)
+            return false;
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
         {
@@ -134,18 +351,11 @@ namespace tgui
             if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
                 m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
 
-            // Create the new item
-            Text newItem;
-            newItem.setFont(m_fontCached);
-            newItem.setColor(m_textColorCached);
-            newItem.setOpacity(m_opacityCached);
-            newItem.setStyle(m_textStyleCached);
-            newItem.setCharacterSize(m_textSize);
-            newItem.setString(itemName);
-            newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-            // Add the new item to the list
-            m_items.push_back(std::move(newItem));
+            // Add the new item to the list. Its text object is only created once the item becomes visible.
+            if (m_idIndexValid)
+                m_idIndex.emplace(id, m_items.size());
+
+            m_items.push_back(toUtf8(itemName));
             m_itemIds.push_back(id);
             return true;
         }
@@ -157,11 +367,11 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return setSelectedItemByIndex(i);
-        }
+        invalidate();
+
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -172,11 +382,11 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return setSelectedItemByIndex(i);
-        }
+        invalidate();
+
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
@@ -187,7 +397,9 @@ namespace tgui
 
     bool ListBox::setSelectedItemByIndex(std::size_t index)
     {
-        if (index >= m_items.size())
+        invalidate();
+
+        if (index >= getItemCount())
         {
             deselectItem();
             return false;
@@ -208,6 +420,8 @@ namespace tgui
 
     void ListBox::deselectItem()
     {
+        invalidate();
+
         updateSelectedItem(-1);
     }
 
@@ -215,11 +429,14 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        invalidate();
+
+        if (m_itemProvider)
+            return false;
+
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -228,11 +445,14 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return removeItemByIndex(i);
-        }
+        invalidate();
+
+        if (m_itemProvider)
+            return false;
+
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return removeItemByIndex(static_cast<std::size_t>(index));
 
         return false;
     }
@@ -241,7 +461,9 @@ namespace tgui
 
     bool ListBox::removeItemByIndex(std::size_t index)
     {
-        if (index >= m_items.size())
+        invalidate();
+
+        if (m_itemProvider || (index >= m_items.size()))
             return false;
 
         // Keep it simple and forget hover when an item is removed
@@ -259,9 +481,10 @@ namespace tgui
         // Remove the item
         m_items.erase(m_items.begin() + index);
         m_itemIds.erase(m_itemIds.begin() + index);
+        m_idIndexValid = false;
+        m_visibleItemsNeedUpdate = true;
 
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
 
         return true;
     }
@@ -270,6 +493,11 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        invalidate();
+
+        if (m_itemProvider)
+            return;
+
         // Unselect any selected item
         updateSelectedItem(-1);
         updateHoveringItem(-1);
@@ -277,6 +505,8 @@ namespace tgui
         // Clear the list, remove all items
         m_items.clear();
         m_itemIds.clear();
+        m_idIndexValid = false;
+        m_visibleItemsNeedUpdate = true;
 
         m_scroll->setMaximum(0);
     }
@@ -285,11 +515,9 @@ namespace tgui
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
-        for (std::size_t i = 0; i < m_itemIds.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return m_items[i].getString();
-        }
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return getItemByIndex(static_cast<std::size_t>(index));
 
         return "";
     }
@@ -298,14 +526,14 @@ namespace tgui
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? getItemByIndex(static_cast<std::size_t>(m_selectedItem)) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItemId() const
     {
-        return (m_selectedItem >= 0) ? m_itemIds[m_selectedItem] : "";
+        return (m_selectedItem >= 0) ? getIdByIndex(static_cast<std::size_t>(m_selectedItem)) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -319,11 +547,14 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        invalidate();
+
+        if (m_itemProvider)
+            return false;
+
+        const int index = findItemIndex(originalValue);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -332,11 +563,14 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_itemIds[i] == id)
-                return changeItemByIndex(i, newValue);
-        }
+        invalidate();
+
+        if (m_itemProvider)
+            return false;
+
+        const int index = findItemIndexById(id);
+        if (index >= 0)
+            return changeItemByIndex(static_cast<std::size_t>(index), newValue);
 
         return false;
     }
@@ -345,10 +579,13 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
-        if (index >= m_items.size())
+        invalidate();
+
+        if (m_itemProvider || (index >= m_items.size()))
             return false;
 
-        m_items[index].setString(newValue);
+        m_items[index] = toUtf8(newValue);
+        updateVisibleItem(static_cast<int>(index));
         return true;
     }
 
@@ -356,16 +593,22 @@ namespace tgui
 
     std::size_t ListBox::getItemCount() const
     {
-        return m_items.size();
+        if (m_itemProvider)
+            return m_itemProvider->getItemCount();
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<sf::String> ListBox::getItems() const
     {
+        const std::size_t itemCount = getItemCount();
+
         std::vector<sf::String> items;
-        for (const auto& item : m_items)
-            items.push_back(item.getString());
+        items.reserve(itemCount);
+        for (std::size_t i = 0; i < itemCount; ++i)
+            items.push_back(getItemByIndex(i));
 
         return items;
     }
@@ -374,25 +617,88 @@ namespace tgui
 
     const std::vector<sf::String>& ListBox::getItemIds() const
     {
-        return m_itemIds;
+        if (!m_itemProvider)
+            return m_itemIds;
+
+        const std::size_t itemCount = m_itemProvider->getItemCount();
+        m_itemProviderIds.clear();
+        m_itemProviderIds.reserve(itemCount);
+        for (std::size_t i = 0; i < itemCount; ++i)
+            m_itemProviderIds.push_back(m_itemProvider->getItemId(i));
+
+        return m_itemProviderIds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ListBox::getItemByIndex(std::size_t index) const
+    {
+        if (index >= getItemCount())
+            return "";
+
+        if (m_itemProvider)
+            return m_itemProvider->getItem(index);
+        else
+            return fromUtf8(m_items[index]);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String ListBox::getIdByIndex(std::size_t index) const
+    {
+        if (index >= getItemCount())
+            return "";
+
+        if (m_itemProvider)
+            return m_itemProvider->getItemId(index);
+        else
+            return m_itemIds[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemProvider(ItemProvider::Ptr provider)
+    {
+        invalidate();
+
+        if (provider == m_itemProvider)
+            return;
+
+        removeAllItems();
+        updateSelectedItem(-1);
+        updateHoveringItem(-1);
+
+        disconnectItemProvider();
+        m_itemProvider = std::move(provider);
+        connectItemProvider();
+
+        m_idIndexValid = false;
+        m_visibleItemsNeedUpdate = true;
+        m_scroll->setMaximum(static_cast<unsigned int>(getItemCount() * m_itemHeight));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemProvider::Ptr ListBox::getItemProvider() const
+    {
+        return m_itemProvider;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
-        {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.setCharacterSize(m_textSize);
-        }
+
+        m_visibleItemsNeedUpdate = true;
 
         m_scroll->setScrollAmount(m_itemHeight);
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
+        m_scroll->setMaximum(static_cast<unsigned int>(getItemCount() * m_itemHeight));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,6 +712,8 @@ namespace tgui
 
     void ListBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
+
         m_requestedTextSize = textSize;
 
         if (textSize)
@@ -413,10 +721,7 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.setCharacterSize(m_textSize);
-
-        setPosition(m_position);
+        m_visibleItemsNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -430,6 +735,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidate();
+
         // Set the new limit
         m_maxItems = maximumItems;
 
@@ -439,9 +746,10 @@ namespace tgui
             // Remove the items that passed the limitation
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
             m_itemIds.erase(m_itemIds.begin() + m_maxItems, m_itemIds.end());
+            m_idIndexValid = false;
+            m_visibleItemsNeedUpdate = true;
 
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-            setPosition(m_position);
         }
     }
 
@@ -456,6 +764,8 @@ namespace tgui
 
     void ListBox::setAutoScroll(bool autoScroll)
     {
+        invalidate();
+
         m_autoScroll = autoScroll;
     }
 
@@ -470,14 +780,14 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
+        return findItemIndex(item) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const sf::String& id) const
     {
-        return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
+        return findItemIndexById(id) >= 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -513,13 +823,13 @@ namespace tgui
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
                 int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
+                if (hoveringItem < static_cast<int>(getItemCount()))
                     updateHoveringItem(hoveringItem);
                 else
                     updateHoveringItem(-1);
 
                 if (m_hoveringItem >= 0)
-                    onMousePress.emit(this, m_items[m_hoveringItem].getString(), m_itemIds[m_hoveringItem]);
+                    onMousePress.emit(this, getItemByIndex(m_hoveringItem), getIdByIndex(m_hoveringItem));
 
                 if (m_selectedItem != m_hoveringItem)
                 {
@@ -538,7 +848,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll->isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onMouseRelease.emit(this, getItemByIndex(m_selectedItem), getIdByIndex(m_selectedItem));
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -546,12 +856,13 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                    onDoubleClick.emit(this, getItemByIndex(m_selectedItem), getIdByIndex(m_selectedItem));
             }
             else // This is the first click
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdates();
             }
         }
 
@@ -585,7 +896,7 @@ namespace tgui
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
                 int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
+                if (hoveringItem < static_cast<int>(getItemCount()))
                     updateHoveringItem(hoveringItem);
                 else
                     updateHoveringItem(-1);
@@ -658,119 +969,99 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::rendererChanged(const std::string& property)
+    void ListBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (property == PropertyId::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "textcolorhover")
+        else if (property == PropertyId::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == PropertyId::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+            updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextstyle")
+        else if (property == PropertyId::SelectedTextStyle)
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
-
-            if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
+            updateVisibleItem(m_selectedItem);
         }
-        else if (property == "scrollbar")
+        else if (property == PropertyId::Scrollbar)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
             setSize(m_size);
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == PropertyId::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == PropertyId::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
             m_scroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.setOpacity(m_opacityCached);
+            m_visibleItemsNeedUpdate = true;
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
-            {
                 m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.setCharacterSize(m_textSize);
-            }
 
-            setPosition(m_position);
+            m_visibleItemsNeedUpdate = true;
         }
         else
             Widget::rendererChanged(property);
@@ -872,56 +1163,214 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    int ListBox::findItemIndexById(const sf::String& id) const
     {
-        if (m_selectedItem >= 0)
+        if (!m_idIndexValid)
         {
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorCached);
+            const std::size_t itemCount = getItemCount();
+            m_idIndex.clear();
+            m_idIndex.reserve(itemCount);
 
-            if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+            // When several items have the same id then the first one is found, just like when searching through the list
+            for (std::size_t i = 0; i < itemCount; ++i)
+                m_idIndex.emplace(getIdByIndex(i), i);
+
+            m_idIndexValid = true;
         }
 
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
+        const auto it = m_idIndex.find(id);
+        if (it != m_idIndex.end())
+            return static_cast<int>(it->second);
+        else
+            return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemIndex(const sf::String& item) const
+    {
+        if (m_itemProvider)
+        {
+            const std::size_t itemCount = m_itemProvider->getItemCount();
+            for (std::size_t i = 0; i < itemCount; ++i)
+            {
+                if (m_itemProvider->getItem(i) == item)
+                    return static_cast<int>(i);
+            }
+        }
+        else
         {
-            if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].setColor(m_textColorHoverCached);
+            const std::string utf8Item = toUtf8(item);
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+            {
+                if (m_items[i] == utf8Item)
+                    return static_cast<int>(i);
+            }
         }
+
+        return -1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateItemColorsAndStyle()
+    void ListBox::connectItemProvider()
     {
-        for (auto& item : m_items)
+        if (m_itemProvider)
         {
-            item.setColor(m_textColorCached);
-            item.setStyle(m_textStyleCached);
+            m_itemProviderListenerId = m_itemProvider->connect([this](ItemProvider::Change change, std::size_t first, std::size_t count){
+                itemProviderChanged(change, first, count);
+            });
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::disconnectItemProvider()
+    {
+        if (m_itemProvider && m_itemProviderListenerId)
+            m_itemProvider->disconnect(m_itemProviderListenerId);
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+        m_itemProviderListenerId = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateHoveringItem(int item)
+    void ListBox::itemProviderChanged(ItemProvider::Change change, std::size_t first, std::size_t count)
     {
-        if (m_hoveringItem != item)
+        invalidate();
+
+        m_idIndexValid = false;
+        m_visibleItemsNeedUpdate = true;
+
+        // Forget hover, the item below the mouse is no longer the same
+        m_hoveringItem = -1;
+
+        if (change == ItemProvider::Change::Inserted)
+        {
+            if ((m_selectedItem >= 0) && (static_cast<std::size_t>(m_selectedItem) >= first))
+                m_selectedItem += static_cast<int>(count);
+        }
+        else if (change == ItemProvider::Change::Removed)
         {
-            if (m_hoveringItem >= 0)
+            if ((m_selectedItem >= 0) && (static_cast<std::size_t>(m_selectedItem) >= first))
             {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
+                if (static_cast<std::size_t>(m_selectedItem) < first + count)
+                    updateSelectedItem(-1);
                 else
-                    m_items[m_hoveringItem].setColor(m_textColorCached);
+                    m_selectedItem -= static_cast<int>(count);
             }
+        }
+        else if (change == ItemProvider::Change::Reset)
+            updateSelectedItem(-1);
+
+        if (change != ItemProvider::Change::Changed)
+            m_scroll->setMaximum(static_cast<unsigned int>(getItemCount() * m_itemHeight));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItems(std::size_t firstItem, std::size_t lastItem) const
+    {
+        const std::size_t count = lastItem - firstItem;
+        if (m_visibleItemsNeedUpdate || (m_visibleItems.size() != count))
+        {
+            m_visibleItems.resize(count);
+            for (std::size_t i = 0; i < count; ++i)
+                initVisibleItem(m_visibleItems[i], firstItem + i);
+
+            m_firstVisibleItem = firstItem;
+            m_visibleItemsNeedUpdate = false;
+            return;
+        }
 
+        if (m_firstVisibleItem == firstItem)
+            return;
+
+        // When scrolling, the text objects of the items that remain visible are kept and the others are reused for the new items
+        if ((firstItem > m_firstVisibleItem) && (firstItem - m_firstVisibleItem < count))
+        {
+            const std::size_t shift = firstItem - m_firstVisibleItem;
+            std::rotate(m_visibleItems.begin(), m_visibleItems.begin() + shift, m_visibleItems.end());
+            for (std::size_t i = count - shift; i < count; ++i)
+                initVisibleItem(m_visibleItems[i], firstItem + i);
+        }
+        else if ((firstItem < m_firstVisibleItem) && (m_firstVisibleItem - firstItem < count))
+        {
+            const std::size_t shift = m_firstVisibleItem - firstItem;
+            std::rotate(m_visibleItems.begin(), m_visibleItems.end() - shift, m_visibleItems.end());
+            for (std::size_t i = 0; i < shift; ++i)
+                initVisibleItem(m_visibleItems[i], firstItem + i);
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; ++i)
+                initVisibleItem(m_visibleItems[i], firstItem + i);
+        }
+
+        m_firstVisibleItem = firstItem;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::initVisibleItem(Text& text, std::size_t index) const
+    {
+        const int item = static_cast<int>(index);
+
+        Color color = m_textColorCached;
+        if ((item == m_hoveringItem) && m_textColorHoverCached.isSet())
+            color = m_textColorHoverCached;
+
+        TextStyle style = m_textStyleCached;
+        if (item == m_selectedItem)
+        {
+            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
+                color = m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                color = m_selectedTextColorCached;
+
+            if (m_selectedTextStyleCached.isSet())
+                style = m_selectedTextStyleCached;
+        }
+
+        text.setFont(m_fontCached);
+        text.setColor(color);
+        text.setOpacity(m_opacityCached);
+        text.setStyle(style);
+        text.setCharacterSize(m_textSize);
+        text.setString(getItemByIndex(index));
+        text.setPosition({0, (index * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItem(int index)
+    {
+        if (m_visibleItemsNeedUpdate || (index < 0))
+            return;
+
+        const std::size_t item = static_cast<std::size_t>(index);
+        if ((item >= m_firstVisibleItem) && (item < m_firstVisibleItem + m_visibleItems.size()))
+            initVisibleItem(m_visibleItems[item - m_firstVisibleItem], item);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemColorsAndStyle()
+    {
+        m_visibleItemsNeedUpdate = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateHoveringItem(int item)
+    {
+        if (m_hoveringItem != item)
+        {
+            const int oldHoveringItem = m_hoveringItem;
             m_hoveringItem = item;
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+            updateVisibleItem(oldHoveringItem);
+            updateVisibleItem(m_hoveringItem);
         }
     }
 
@@ -931,23 +1380,16 @@ namespace tgui
     {
         if (m_selectedItem != item)
         {
-            if (m_selectedItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].setColor(m_textColorHoverCached);
-                else
-                    m_items[m_selectedItem].setColor(m_textColorCached);
+            const int oldSelectedItem = m_selectedItem;
+            m_selectedItem = item;
 
-                m_items[m_selectedItem].setStyle(m_textStyleCached);
-            }
+            updateVisibleItem(oldSelectedItem);
+            updateVisibleItem(m_selectedItem);
 
-            m_selectedItem = item;
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onItemSelect.emit(this, getItemByIndex(m_selectedItem), getIdByIndex(m_selectedItem));
             else
                 onItemSelect.emit(this, "", "");
-
-            updateSelectedAndHoveringItemColorsAndStyle();
         }
     }
 
@@ -966,6 +1408,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ListBox::isUpdateNeeded() const
+    {
+        return Widget::isUpdateNeeded() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time ListBox::getTimeUntilNextUpdate() const
+    {
+        sf::Time time = Widget::getTimeUntilNextUpdate();
+        if (m_possibleDoubleClick)
+            time = std::min(time, std::max(sf::Time::Zero, sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed));
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -994,7 +1454,8 @@ namespace tgui
 
             // Find out which items are visible
             std::size_t firstItem = 0;
-            std::size_t lastItem = m_items.size();
+            const std::size_t itemCount = getItemCount();
+            std::size_t lastItem = itemCount;
             if (m_scroll->getViewportSize() < m_scroll->getMaximum())
             {
                 firstItem = m_scroll->getValue() / m_itemHeight;
@@ -1029,10 +1490,11 @@ namespace tgui
                 states.transform.translate({0, -static_cast<float>(m_hoveringItem * m_itemHeight)});
             }
 
-            // Draw the items
+            // Draw the items, only the visible ones have a text object
+            updateVisibleItems(firstItem, std::min(lastItem, itemCount));
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+            for (const auto& item : m_visibleItems)
+                item.draw(target, states);
         }
 
         // Draw the scrollbar
@@ -24,9 +24,10 @@
 
 
 #include <TGUI/Widgets/MenuBar.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Container.hpp>
 #include <TGUI/Clipping.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -70,6 +71,17 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        std::size_t countMenuItemsImpl(const std::vector<aurora::CopiedPtr<MenuBar::Menu>>& menus)
+        {
+            std::size_t count = menus.size();
+            for (const auto& menu : menus)
+                count += countMenuItemsImpl(menu->menuItems);
+
+            return count;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void setTextSizeImpl(std::vector<aurora::CopiedPtr<MenuBar::Menu>>& menus, unsigned int textSize)
         {
             for (auto& menu : menus)
@@ -226,8 +238,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void MenuBar::invalidate()
+    {
+        Widget::invalidate();
+
+        if (!m_parent || (m_visibleMenu == -1))
+            return;
+
+        // The open menu is drawn outside the menu bar. Every submenu starts next to an item of its parent menu, so the menus can't
+        // extend further than the amount of items in the open menu together with all its submenus.
+        const Vector2f position = m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset();
+        const float menuHeight = getSize().y * countMenuItemsImpl(m_menus[m_visibleMenu]->menuItems);
+        if (m_invertedMenuDirection)
+        {
+            m_parent->invalidateRegion({position.x, position.y + getPosition().y - menuHeight,
+                                        std::max(m_parent->getInnerSize().x, getPosition().x + getSize().x), menuHeight + getSize().y});
+        }
+        else
+        {
+            m_parent->invalidateRegion({position.x, position.y + getPosition().y,
+                                        std::max(m_parent->getInnerSize().x, getPosition().x + getSize().x), menuHeight + getSize().y});
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::addMenu(const sf::String& text)
     {
+        invalidate();
+
         createMenu(m_menus, text);
     }
 
@@ -235,6 +274,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& text)
     {
+        invalidate();
+
         if (!m_menus.empty())
             return addMenuItem(m_menus.back()->text.getString(), text);
         else
@@ -245,6 +286,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        invalidate();
+
         return addMenuItem({menu, text}, false);
     }
 
@@ -252,6 +295,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const std::vector<sf::String>& hierarchy, bool createParents)
     {
+        invalidate();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -267,6 +312,8 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidate();
+
         m_menus.clear();
     }
 
@@ -274,6 +321,8 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        invalidate();
+
         for (std::size_t i = 0; i < m_menus.size(); ++i)
         {
             if (m_menus[i]->text.getString() != menu)
@@ -296,6 +345,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        invalidate();
+
         return removeMenuItem({menu, menuItem}, false);
     }
 
@@ -303,6 +354,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty)
     {
+        invalidate();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -313,6 +366,8 @@ namespace tgui
 
     bool MenuBar::setMenuEnabled(const sf::String& menu, bool enabled)
     {
+        invalidate();
+
         for (std::size_t i = 0; i < m_menus.size(); ++i)
         {
             if (m_menus[i]->text.getString() != menu)
@@ -346,6 +401,8 @@ namespace tgui
 
     bool MenuBar::setMenuItemEnabled(const sf::String& menuText, const sf::String& menuItemText, bool enabled)
     {
+        invalidate();
+
         return setMenuItemEnabled({menuText, menuItemText}, enabled);
     }
 
@@ -353,6 +410,8 @@ namespace tgui
 
     bool MenuBar::setMenuItemEnabled(const std::vector<sf::String>& hierarchy, bool enabled)
     {
+        invalidate();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -402,6 +461,8 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
         setTextSizeImpl(m_menus, size);
     }
@@ -417,6 +478,8 @@ namespace tgui
 
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
+        invalidate();
+
         m_minimumSubMenuWidth = minimumWidth;
     }
 
@@ -431,6 +494,8 @@ namespace tgui
 
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
+        invalidate();
+
         m_invertedMenuDirection = invertDirection;
     }
 
@@ -472,6 +537,8 @@ namespace tgui
 
     void MenuBar::closeMenu()
     {
+        invalidate();
+
         if (m_visibleMenu != -1)
             closeSubMenus(m_menus, m_visibleMenu);
     }
@@ -510,6 +577,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect MenuBar::getHitTestBounds() const
+    {
+        if (m_visibleMenu == -1)
+            return Widget::getHitTestBounds();
+
+        // The open menu and its submenus can be anywhere around the menu bar
+        const float maxValue = std::numeric_limits<float>::max() / 4;
+        return {-maxValue, -maxValue, 2 * maxValue, 2 * maxValue};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::leftMousePressed(Vector2f pos)
     {
         // Check if a menu should be opened or closed
@@ -712,54 +791,54 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::rendererChanged(const std::string& property)
+    void MenuBar::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
+        if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "textcolordisabled")
+        else if (property == PropertyId::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textureitembackground")
+        else if (property == PropertyId::TextureItemBackground)
         {
             m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
         }
-        else if (property == "textureselecteditembackground")
+        else if (property == PropertyId::TextureSelectedItemBackground)
         {
             m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == PropertyId::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "distancetoside")
+        else if (property == PropertyId::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
             updateTextOpacity(m_menus);
             m_spriteBackground.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
             updateTextFont(m_menus);
@@ -1279,19 +1358,22 @@ namespace tgui
                 states.transform.translate({menuWidth - 2*m_distanceToSideCached - arrowWidth, // 2x m_distanceToSideCached because we already translated once
                                             (menu->menuItems[j]->text.getSize().y - arrowHeight) / 2.f});
 
-                sf::ConvexShape arrow{3};
-                arrow.setPoint(0, {0, 0});
-                arrow.setPoint(1, {arrowWidth, arrowHeight / 2.f});
-                arrow.setPoint(2, {0, arrowHeight});
+                sf::Vertex arrow[3];
+                sf::Color arrowColor;
+                arrow[0].position = {0, 0};
+                arrow[1].position = {arrowWidth, arrowHeight / 2.f};
+                arrow[2].position = {0, arrowHeight};
 
                 if ((!m_enabled || !menu->menuItems[j]->enabled) && m_textColorDisabledCached.isSet())
-                    arrow.setFillColor(Color::calcColorOpacity(m_textColorDisabledCached, m_opacityCached));
+                    arrowColor = Color::calcColorOpacity(m_textColorDisabledCached, m_opacityCached);
                 else if ((menu->selectedMenuItem == static_cast<int>(j)) && m_selectedTextColorCached.isSet())
-                    arrow.setFillColor(Color::calcColorOpacity(m_selectedTextColorCached, m_opacityCached));
+                    arrowColor = Color::calcColorOpacity(m_selectedTextColorCached, m_opacityCached);
                 else
-                    arrow.setFillColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
+                    arrowColor = Color::calcColorOpacity(m_textColorCached, m_opacityCached);
 
-                target.draw(arrow, states);
+                for (auto& vertex : arrow)
+                    vertex.color = arrowColor;
+                DrawBatch::addVertices(target, states, arrow, 3, sf::PrimitiveType::Triangles);
                 states.transform = textTransform;
             }
 
@@ -303,19 +303,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBox::rendererChanged(const std::string& property)
+    void MessageBox::rendererChanged(PropertyId property)
     {
-        if (property == "textcolor")
+        if (property == PropertyId::TextColor)
         {
             m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "button")
+        else if (property == PropertyId::Button)
         {
             const auto& renderer = getSharedRenderer()->getButton();
             for (auto& button : m_buttons)
                 button->setRenderer(renderer);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             ChildWindow::rendererChanged(property);
 
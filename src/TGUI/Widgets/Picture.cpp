@@ -159,6 +159,7 @@ namespace tgui
             {
                 m_animationTimeElapsed = {};
                 m_possibleDoubleClick = true;
+                scheduleUpdates();
             }
         }
     }
@@ -175,9 +176,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Picture::rendererChanged(const std::string& property)
+    void Picture::rendererChanged(PropertyId property)
     {
-        if (property == "texture")
+        if (property == PropertyId::Texture)
         {
             const auto& texture = getSharedRenderer()->getTexture();
 
@@ -186,7 +187,7 @@ namespace tgui
 
             m_sprite.setTexture(texture);
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
             m_sprite.setOpacity(m_opacityCached);
@@ -232,6 +233,24 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Picture::isUpdateNeeded() const
+    {
+        return Widget::isUpdateNeeded() || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Picture::getTimeUntilNextUpdate() const
+    {
+        sf::Time time = Widget::getTimeUntilNextUpdate();
+        if (m_possibleDoubleClick)
+            time = std::min(time, std::max(sf::Time::Zero, sf::milliseconds(getDoubleClickTime()) - m_animationTimeElapsed));
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Picture::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -113,6 +113,8 @@ namespace tgui
 
     void ProgressBar::setMinimum(unsigned int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_minimum = minimum;
 
@@ -139,6 +141,8 @@ namespace tgui
 
     void ProgressBar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         m_maximum = maximum;
 
@@ -165,6 +169,8 @@ namespace tgui
 
     void ProgressBar::setValue(unsigned int value)
     {
+        invalidate();
+
         // When the value is below the minimum or above the maximum then adjust it
         if (value < m_minimum)
             value = m_minimum;
@@ -196,6 +202,8 @@ namespace tgui
 
     unsigned int ProgressBar::incrementValue()
     {
+        invalidate();
+
         // When the value is still below the maximum then adjust it
         if (m_value < m_maximum)
             setValue(m_value + 1);
@@ -208,6 +216,8 @@ namespace tgui
 
     void ProgressBar::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_textBack.setString(text);
         m_textFront.setString(text);
@@ -247,6 +257,8 @@ namespace tgui
 
     void ProgressBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_textSize = size;
         setText(getText());
@@ -263,6 +275,8 @@ namespace tgui
 
     void ProgressBar::setFillDirection(FillDirection direction)
     {
+        invalidate();
+
         m_fillDirection = direction;
         recalculateFillSize();
     }
@@ -301,14 +315,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ProgressBar::rendererChanged(const std::string& property)
+    void ProgressBar::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if ((property == "textcolor") || (property == "textcolorfilled"))
+        else if ((property == PropertyId::TextColor) || (property == PropertyId::TextColorFilled))
         {
             m_textBack.setColor(getSharedRenderer()->getTextColor());
 
@@ -317,33 +331,33 @@ namespace tgui
             else
                 m_textFront.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturefill")
+        else if (property == PropertyId::TextureFill)
         {
             m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
             recalculateFillSize();
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyle)
         {
             m_textBack.setStyle(getSharedRenderer()->getTextStyle());
             m_textFront.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "fillcolor")
+        else if (property == PropertyId::FillColor)
         {
             m_fillColorCached = getSharedRenderer()->getFillColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -353,7 +367,7 @@ namespace tgui
             m_textBack.setOpacity(m_opacityCached);
             m_textFront.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
@@ -555,7 +569,7 @@ namespace tgui
         }
 
         // Draw the text
-        if (m_textBack.getString() != "")
+        if (!m_textBack.getString().isEmpty())
         {
             Vector2f textTranslation = (getInnerSize() - m_textBack.getSize()) / 2.f;
 
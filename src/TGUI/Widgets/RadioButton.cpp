@@ -24,8 +24,9 @@
 
 
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/PrimitiveBuilder.hpp>
 #include <TGUI/Container.hpp>
-#include <SFML/Graphics/CircleShape.hpp>
 
 namespace tgui
 {
@@ -128,6 +129,8 @@ namespace tgui
 
     void RadioButton::setChecked(bool checked)
     {
+        invalidate();
+
         if (m_checked == checked)
             return;
 
@@ -157,6 +160,8 @@ namespace tgui
 
     void RadioButton::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_text.setString(text);
 
@@ -178,6 +183,8 @@ namespace tgui
 
     void RadioButton::setTextSize(unsigned int size)
     {
+        invalidate();
+
         m_textSize = size;
         setText(getText());
     }
@@ -285,20 +292,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::rendererChanged(const std::string& property)
+    void RadioButton::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             updateTextureSizes();
         }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordisabled")
-              || (property == "textcolorchecked") || (property == "textcolorcheckedhover") || (property == "textcolorcheckeddisabled"))
+        else if ((property == PropertyId::TextColor) || (property == PropertyId::TextColorHover) || (property == PropertyId::TextColorDisabled)
+              || (property == PropertyId::TextColorChecked) || (property == PropertyId::TextColorCheckedHover) || (property == PropertyId::TextColorCheckedDisabled))
         {
             updateTextColor();
         }
-        else if (property == "textstyle")
+        else if (property == PropertyId::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
 
@@ -307,7 +314,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textstylechecked")
+        else if (property == PropertyId::TextStyleChecked)
         {
             m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
@@ -316,113 +323,113 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textureunchecked")
+        else if (property == PropertyId::TextureUnchecked)
         {
             m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
             updateTextureSizes();
         }
-        else if (property == "texturechecked")
+        else if (property == PropertyId::TextureChecked)
         {
             m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
             updateTextureSizes();
         }
-        else if (property == "textureuncheckedhover")
+        else if (property == PropertyId::TextureUncheckedHover)
         {
             m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
         }
-        else if (property == "texturecheckedhover")
+        else if (property == PropertyId::TextureCheckedHover)
         {
             m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
         }
-        else if (property == "textureuncheckeddisabled")
+        else if (property == PropertyId::TextureUncheckedDisabled)
         {
             m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
         }
-        else if (property == "texturecheckeddisabled")
+        else if (property == PropertyId::TextureCheckedDisabled)
         {
             m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
         }
-        else if (property == "textureuncheckedfocused")
+        else if (property == PropertyId::TextureUncheckedFocused)
         {
             m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
         }
-        else if (property == "texturecheckedfocused")
+        else if (property == PropertyId::TextureCheckedFocused)
         {
             m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
         }
-        else if (property == "checkcolor")
+        else if (property == PropertyId::CheckColor)
         {
             m_checkColorCached = getSharedRenderer()->getCheckColor();
         }
-        else if (property == "checkcolorhover")
+        else if (property == PropertyId::CheckColorHover)
         {
             m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
         }
-        else if (property == "checkcolordisabled")
+        else if (property == PropertyId::CheckColorDisabled)
         {
             m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == PropertyId::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == PropertyId::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == PropertyId::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "bordercolorchecked")
+        else if (property == PropertyId::BorderColorChecked)
         {
             m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
         }
-        else if (property == "bordercolorcheckedhover")
+        else if (property == PropertyId::BorderColorCheckedHover)
         {
             m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
         }
-        else if (property == "bordercolorcheckeddisabled")
+        else if (property == PropertyId::BorderColorCheckedDisabled)
         {
             m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
         }
-        else if (property == "bordercolorcheckedfocused")
+        else if (property == PropertyId::BorderColorCheckedFocused)
         {
             m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == PropertyId::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorchecked")
+        else if (property == PropertyId::BackgroundColorChecked)
         {
             m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
         }
-        else if (property == "backgroundcolorcheckedhover")
+        else if (property == PropertyId::BackgroundColorCheckedHover)
         {
             m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
         }
-        else if (property == "backgroundcolorcheckeddisabled")
+        else if (property == PropertyId::BackgroundColorCheckedDisabled)
         {
             m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
         }
-        else if (property == "textdistanceratio")
+        else if (property == PropertyId::TextDistanceRatio)
         {
             m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -437,7 +444,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
@@ -647,21 +654,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    void RadioButton::invalidate()
     {
-        states.transform.translate(getPosition());
+        m_verticesNeedUpdate = true;
+        ClickableWidget::invalidate();
+    }
 
-        // Draw the borders
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::updateVertices() const
+    {
+        m_vertices.clear();
+
+        // The borders lie inside the circle that fills the entire size
         const float innerRadius = std::min(getInnerSize().x, getInnerSize().y) / 2;
         if (m_bordersCached != Borders{0})
         {
-            sf::CircleShape circle{innerRadius + m_bordersCached.getLeft()};
-            circle.setOutlineThickness(-m_bordersCached.getLeft());
-            circle.setFillColor(Color::Transparent);
-            circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            const float outerRadius = innerRadius + m_bordersCached.getLeft();
+            PrimitiveBuilder::addRing(m_vertices, {outerRadius, outerRadius}, innerRadius, outerRadius,
+                                      Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
         }
 
+        // The background and check are positioned relative to the inside of the borders
+        m_boxVerticesStart = m_vertices.size();
+        PrimitiveBuilder::addCircle(m_vertices, {innerRadius, innerRadius}, innerRadius, Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
+        if (m_checked)
+            PrimitiveBuilder::addCircle(m_vertices, {innerRadius, innerRadius}, innerRadius * 0.4f, Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
+
+        m_verticesNeedUpdate = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RadioButton::draw(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        states.transform.translate(getPosition());
+
+        if (m_verticesNeedUpdate)
+            updateVertices();
+
+        // Draw the borders
+        DrawBatch::addVertices(target, states, m_vertices.data(), m_boxVerticesStart, sf::PrimitiveType::Triangles);
+
         // Draw the box
         states.transform.translate(m_bordersCached.getOffset());
         if (m_spriteUnchecked.isSet() && m_spriteChecked.isSet())
@@ -689,20 +723,10 @@ namespace tgui
                     m_spriteUnchecked.draw(target, states);
             }
         }
-        else // There are no images
+        else // There are no images, draw the background and the check
         {
-            sf::CircleShape circle{innerRadius};
-            circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
-
-            // Draw the check if the radio button is checked
-            if (m_checked)
-            {
-                sf::CircleShape checkShape{innerRadius * 0.4f};
-                checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
-                checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
-            }
+            DrawBatch::addVertices(target, states, m_vertices.data() + m_boxVerticesStart,
+                                   m_vertices.size() - m_boxVerticesStart, sf::PrimitiveType::Triangles);
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
 
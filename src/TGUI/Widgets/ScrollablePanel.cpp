@@ -268,6 +268,8 @@ namespace tgui
 
     void ScrollablePanel::setContentSize(Vector2f size)
     {
+        invalidate();
+
         m_contentSize = size;
 
         disconnectAllChildWidgets();
@@ -307,6 +309,8 @@ namespace tgui
 
     void ScrollablePanel::setScrollbarWidth(float width)
     {
+        invalidate();
+
         m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
         m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
         updateScrollbars();
@@ -323,6 +327,8 @@ namespace tgui
 
     void ScrollablePanel::setVerticalScrollbarPolicy(ScrollbarPolicy policy)
     {
+        invalidate();
+
         m_verticalScrollbarPolicy = policy;
 
         if (policy == ScrollbarPolicy::Always)
@@ -354,6 +360,8 @@ namespace tgui
 
     void ScrollablePanel::setHorizontalScrollbarPolicy(ScrollbarPolicy policy)
     {
+        invalidate();
+
         m_horizontalScrollbarPolicy = policy;
 
         if (policy == ScrollbarPolicy::Always)
@@ -388,9 +396,15 @@ namespace tgui
         m_mouseDown = true;
 
         if (m_verticalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar->leftMousePressed(pos - getPosition());
+            invalidate();
+        }
         else if (m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar->leftMousePressed(pos - getPosition());
+            invalidate();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMousePressed({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -403,9 +417,15 @@ namespace tgui
     void ScrollablePanel::leftMouseReleased(Vector2f pos)
     {
         if (m_verticalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar->leftMouseReleased(pos - getPosition());
+            invalidate();
+        }
         else if (m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar->leftMouseReleased(pos - getPosition());
+            invalidate();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMouseReleased({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -421,10 +441,12 @@ namespace tgui
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->mouseOnWidget(pos - getPosition()))
         {
             m_verticalScrollbar->mouseMoved(pos - getPosition());
+            invalidate();
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->mouseOnWidget(pos - getPosition()))
         {
             m_horizontalScrollbar->mouseMoved(pos - getPosition());
+            invalidate();
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
@@ -462,11 +484,13 @@ namespace tgui
         {
             m_horizontalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
             mouseMoved(pos);
+            invalidate();
         }
         else if (m_verticalScrollbar->isShown())
         {
             m_verticalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
             mouseMoved(pos);
+            invalidate();
         }
 
         return true; // We swallowed the event
@@ -485,6 +509,9 @@ namespace tgui
 
     void ScrollablePanel::mouseNoLongerDown()
     {
+        if (m_verticalScrollbar->isMouseDown() || m_horizontalScrollbar->isMouseDown())
+            invalidate();
+
         Panel::mouseNoLongerDown();
         m_verticalScrollbar->mouseNoLongerDown();
         m_horizontalScrollbar->mouseNoLongerDown();
@@ -569,14 +596,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::rendererChanged(const std::string& property)
+    void ScrollablePanel::rendererChanged(PropertyId property)
     {
-        if (property == "scrollbar")
+        if (property == PropertyId::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
@@ -24,7 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
+#include <TGUI/DrawBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -104,6 +104,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_maximum = maximum;
@@ -131,6 +133,8 @@ namespace tgui
 
     void Scrollbar::setValue(unsigned int value)
     {
+        invalidate();
+
         // When the value is above the maximum then adjust it
         if (m_maximum < m_viewportSize)
             value = 0;
@@ -159,6 +163,8 @@ namespace tgui
 
     void Scrollbar::setViewportSize(unsigned int viewportSize)
     {
+        invalidate();
+
         // Set the new value
         m_viewportSize = viewportSize;
 
@@ -197,6 +203,8 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidate();
+
         m_autoHide = autoHide;
     }
 
@@ -743,9 +751,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Scrollbar::rendererChanged(const std::string& property)
+    void Scrollbar::rendererChanged(PropertyId property)
     {
-        if (property == "texturetrack")
+        if (property == PropertyId::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
             if (m_sizeSet)
@@ -760,70 +768,70 @@ namespace tgui
                 m_sizeSet = false;
             }
         }
-        else if (property == "texturetrackhover")
+        else if (property == PropertyId::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (property == PropertyId::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
             updateSize();
         }
-        else if (property == "texturethumbhover")
+        else if (property == PropertyId::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "texturearrowup")
+        else if (property == PropertyId::TextureArrowUp)
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
             updateSize();
         }
-        else if (property == "texturearrowuphover")
+        else if (property == PropertyId::TextureArrowUpHover)
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == "texturearrowdown")
+        else if (property == PropertyId::TextureArrowDown)
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
             updateSize();
         }
-        else if (property == "texturearrowdownhover")
+        else if (property == PropertyId::TextureArrowDownHover)
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == "trackcolor")
+        else if (property == PropertyId::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == "trackcolorhover")
+        else if (property == PropertyId::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == "thumbcolor")
+        else if (property == PropertyId::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "thumbcolorhover")
+        else if (property == PropertyId::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == "arrowbackgroundcolor")
+        else if (property == PropertyId::ArrowBackgroundColor)
         {
             m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolorhover")
+        else if (property == PropertyId::ArrowBackgroundColorHover)
         {
             m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == PropertyId::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == PropertyId::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -918,26 +926,29 @@ namespace tgui
             else
                 drawRectangleShape(target, states, {m_arrowUp.width, m_arrowUp.height}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
+            sf::Vertex arrow[3];
+            sf::Color arrowColor;
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowUp) && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
             if (m_verticalScroll)
             {
-                arrow.setPoint(0, {m_arrowUp.width / 5, m_arrowUp.height * 4/5});
-                arrow.setPoint(1, {m_arrowUp.width / 2, m_arrowUp.height / 5});
-                arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
+                arrow[0].position = {m_arrowUp.width / 5, m_arrowUp.height * 4/5};
+                arrow[1].position = {m_arrowUp.width / 2, m_arrowUp.height / 5};
+                arrow[2].position = {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5};
             }
             else
             {
-                arrow.setPoint(0, {m_arrowUp.width * 4/5, m_arrowUp.height / 5});
-                arrow.setPoint(1, {m_arrowUp.width / 5, m_arrowUp.height / 2});
-                arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
+                arrow[0].position = {m_arrowUp.width * 4/5, m_arrowUp.height / 5};
+                arrow[1].position = {m_arrowUp.width / 5, m_arrowUp.height / 2};
+                arrow[2].position = {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5};
             }
 
-            target.draw(arrow, states);
+            for (auto& vertex : arrow)
+                vertex.color = arrowColor;
+            DrawBatch::addVertices(target, states, arrow, 3, sf::PrimitiveType::Triangles);
         }
 
         // Draw the track
@@ -992,26 +1003,29 @@ namespace tgui
             else
                 drawRectangleShape(target, states, {m_arrowDown.width, m_arrowDown.height}, m_arrowBackgroundColorCached);
 
-            sf::ConvexShape arrow{3};
+            sf::Vertex arrow[3];
+            sf::Color arrowColor;
             if (m_mouseHover && (m_mouseHoverOverPart == Scrollbar::Part::ArrowDown) && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
             if (m_verticalScroll)
             {
-                arrow.setPoint(0, {m_arrowDown.width / 5, m_arrowDown.height / 5});
-                arrow.setPoint(1, {m_arrowDown.width / 2, m_arrowDown.height * 4/5});
-                arrow.setPoint(2, {m_arrowDown.width * 4/5, m_arrowDown.height / 5});
+                arrow[0].position = {m_arrowDown.width / 5, m_arrowDown.height / 5};
+                arrow[1].position = {m_arrowDown.width / 2, m_arrowDown.height * 4/5};
+                arrow[2].position = {m_arrowDown.width * 4/5, m_arrowDown.height / 5};
             }
             else // Spin button lies horizontal
             {
-                arrow.setPoint(0, {m_arrowDown.width / 5, m_arrowDown.height / 5});
-                arrow.setPoint(1, {m_arrowDown.width * 4/5, m_arrowDown.height / 2});
-                arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
+                arrow[0].position = {m_arrowDown.width / 5, m_arrowDown.height / 5};
+                arrow[1].position = {m_arrowDown.width * 4/5, m_arrowDown.height / 2};
+                arrow[2].position = {m_arrowDown.width / 5, m_arrowDown.height * 4/5};
             }
 
-            target.draw(arrow, states);
+            for (auto& vertex : arrow)
+                vertex.color = arrowColor;
+            DrawBatch::addVertices(target, states, arrow, 3, sf::PrimitiveType::Triangles);
         }
     }
 
@@ -23,8 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
-#include <SFML/Graphics/ConvexShape.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -313,55 +312,55 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SpinButton::rendererChanged(const std::string& property)
+    void SpinButton::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "borderbetweenarrows")
+        else if (property == PropertyId::BorderBetweenArrows)
         {
             m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
             setSize(m_size);
         }
-        else if (property == "texturearrowup")
+        else if (property == PropertyId::TextureArrowUp)
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
         }
-        else if (property == "texturearrowuphover")
+        else if (property == PropertyId::TextureArrowUpHover)
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == "texturearrowdown")
+        else if (property == PropertyId::TextureArrowDown)
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
         }
-        else if (property == "texturearrowdownhover")
+        else if (property == PropertyId::TextureArrowDownHover)
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == PropertyId::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == PropertyId::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -439,38 +438,40 @@ namespace tgui
         }
         else
         {
-            sf::ConvexShape arrow{3};
-            sf::RectangleShape arrowBack;
+            sf::Vertex arrow[3];
+            sf::Color arrowColor;
+            Vector2f arrowBackSize;
 
             if (m_verticalScroll)
             {
-                arrowBack.setSize(arrowSize);
+                arrowBackSize = arrowSize;
 
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y * 4/5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 2, arrowBack.getSize().y / 5});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y * 4/5});
+                arrow[0].position = {arrowBackSize.x / 5, arrowBackSize.y * 4/5};
+                arrow[1].position = {arrowBackSize.x / 2, arrowBackSize.y / 5};
+                arrow[2].position = {arrowBackSize.x * 4/5, arrowBackSize.y * 4/5};
             }
             else // Spin button lies horizontal
             {
-                arrowBack.setSize({arrowSize.y, arrowSize.x});
+                arrowBackSize = {arrowSize.y, arrowSize.x};
 
-                arrow.setPoint(0, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 2});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y * 4/5});
+                arrow[0].position = {arrowBackSize.x * 4/5, arrowBackSize.y / 5};
+                arrow[1].position = {arrowBackSize.x / 5, arrowBackSize.y / 2};
+                arrow[2].position = {arrowBackSize.x * 4/5, arrowBackSize.y * 4/5};
             }
 
             if (m_mouseHover && m_mouseHoverOnTopArrow && m_backgroundColorHoverCached.isSet())
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorHoverCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorHoverCached);
             else
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorCached);
 
             if (m_mouseHover && m_mouseHoverOnTopArrow && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            for (auto& vertex : arrow)
+                vertex.color = arrowColor;
+            DrawBatch::addVertices(target, states, arrow, 3, sf::PrimitiveType::Triangles);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -505,38 +506,40 @@ namespace tgui
         }
         else // There are no images
         {
-            sf::ConvexShape arrow{3};
-            sf::RectangleShape arrowBack;
+            sf::Vertex arrow[3];
+            sf::Color arrowColor;
+            Vector2f arrowBackSize;
 
             if (m_verticalScroll)
             {
-                arrowBack.setSize(arrowSize);
+                arrowBackSize = arrowSize;
 
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x / 2, arrowBack.getSize().y * 4/5});
-                arrow.setPoint(2, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 5});
+                arrow[0].position = {arrowBackSize.x / 5, arrowBackSize.y / 5};
+                arrow[1].position = {arrowBackSize.x / 2, arrowBackSize.y * 4/5};
+                arrow[2].position = {arrowBackSize.x * 4/5, arrowBackSize.y / 5};
             }
             else // Spin button lies horizontal
             {
-                arrowBack.setSize({arrowSize.y, arrowSize.x});
+                arrowBackSize = {arrowSize.y, arrowSize.x};
 
-                arrow.setPoint(0, {arrowBack.getSize().x / 5, arrowBack.getSize().y / 5});
-                arrow.setPoint(1, {arrowBack.getSize().x * 4/5, arrowBack.getSize().y / 2});
-                arrow.setPoint(2, {arrowBack.getSize().x / 5, arrowBack.getSize().y * 4/5});
+                arrow[0].position = {arrowBackSize.x / 5, arrowBackSize.y / 5};
+                arrow[1].position = {arrowBackSize.x * 4/5, arrowBackSize.y / 2};
+                arrow[2].position = {arrowBackSize.x / 5, arrowBackSize.y * 4/5};
             }
 
             if (m_mouseHover && !m_mouseHoverOnTopArrow && m_backgroundColorHoverCached.isSet())
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorHoverCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorHoverCached);
             else
-                arrowBack.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
+                drawRectangleShape(target, states, arrowBackSize, m_backgroundColorCached);
 
             if (m_mouseHover && !m_mouseHoverOnTopArrow && m_arrowColorHoverCached.isSet())
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorHoverCached, m_opacityCached);
             else
-                arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
+                arrowColor = Color::calcColorOpacity(m_arrowColorCached, m_opacityCached);
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            for (auto& vertex : arrow)
+                vertex.color = arrowColor;
+            DrawBatch::addVertices(target, states, arrow, 3, sf::PrimitiveType::Triangles);
         }
     }
 
@@ -120,6 +120,8 @@ namespace tgui
 
     void Tabs::setAutoSize(bool autoSize)
     {
+        invalidate();
+
         if (m_autoSize != autoSize)
         {
             m_autoSize = autoSize;
@@ -138,6 +140,8 @@ namespace tgui
 
     std::size_t Tabs::add(const sf::String& text, bool selectTab)
     {
+        invalidate();
+
         // Use the insert function to put the tab in the right place
         insert(m_tabs.size(), text, selectTab);
 
@@ -149,6 +153,8 @@ namespace tgui
 
     void Tabs::insert(std::size_t index, const sf::String& text, bool selectTab)
     {
+        invalidate();
+
         // If the index is too high then just insert at the end
         if (index > m_tabs.size())
             index = m_tabs.size();
@@ -192,6 +198,8 @@ namespace tgui
 
     bool Tabs::changeText(std::size_t index, const sf::String& text)
     {
+        invalidate();
+
         if (index >= m_tabs.size())
             return false;
 
@@ -204,6 +212,8 @@ namespace tgui
 
     bool Tabs::select(const sf::String& text)
     {
+        invalidate();
+
         for (unsigned int i = 0; i < m_tabs.size(); ++i)
         {
             if (m_tabs[i].text.getString() == text)
@@ -218,6 +228,8 @@ namespace tgui
 
     bool Tabs::select(std::size_t index)
     {
+        invalidate();
+
         // Don't select a tab that is already selected
         if (m_selectedTab == static_cast<int>(index))
             return true;
@@ -245,6 +257,8 @@ namespace tgui
 
     void Tabs::deselect()
     {
+        invalidate();
+
         if (m_selectedTab >= 0)
         {
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
@@ -256,6 +270,8 @@ namespace tgui
 
     bool Tabs::remove(const sf::String& text)
     {
+        invalidate();
+
         for (unsigned int i = 0; i < m_tabs.size(); ++i)
         {
             if (m_tabs[i].text.getString() == text)
@@ -269,6 +285,8 @@ namespace tgui
 
     bool Tabs::remove(std::size_t index)
     {
+        invalidate();
+
         // The index can't be too high
         if (index > m_tabs.size() - 1)
             return false;
@@ -291,6 +309,8 @@ namespace tgui
 
     void Tabs::removeAll()
     {
+        invalidate();
+
         m_tabs.clear();
         m_selectedTab = -1;
         m_hoveringTab = -1;
@@ -319,6 +339,8 @@ namespace tgui
 
     void Tabs::setTabVisible(std::size_t index, bool visible)
     {
+        invalidate();
+
         if (index >= m_tabs.size())
             return;
 
@@ -340,6 +362,8 @@ namespace tgui
 
     void Tabs::setTabEnabled(std::size_t index, bool enabled)
     {
+        invalidate();
+
         if (index >= m_tabs.size())
             return;
 
@@ -361,6 +385,8 @@ namespace tgui
 
     void Tabs::setTextSize(unsigned int size)
     {
+        invalidate();
+
         if ((size == 0) || (m_requestedTextSize != size))
         {
             m_requestedTextSize = size;
@@ -388,6 +414,8 @@ namespace tgui
 
     void Tabs::setTabHeight(float height)
     {
+        invalidate();
+
         Widget::setSize({getSizeLayout().x, height});
         m_bordersCached.updateParentSize(getSize());
 
@@ -400,6 +428,8 @@ namespace tgui
 
     void Tabs::setMaximumTabWidth(float maximumWidth)
     {
+        invalidate();
+
         m_maximumTabWidth = maximumWidth;
 
         recalculateTabsWidth();
@@ -416,6 +446,8 @@ namespace tgui
 
     void Tabs::setMinimumTabWidth(float minimumWidth)
     {
+        invalidate();
+
         m_minimumTabWidth = minimumWidth;
 
         recalculateTabsWidth();
@@ -563,88 +595,91 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Tabs::rendererChanged(const std::string& property)
+    void Tabs::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        // The textures or opacity of the tab sprites may change
+        m_spriteDrawnTabSource = -1;
+
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             recalculateTabsWidth();
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors();
         }
-        else if (property == "textcolorhover")
+        else if (property == PropertyId::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateTextColors();
         }
-        else if (property == "textcolordisabled")
+        else if (property == PropertyId::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == PropertyId::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateTextColors();
         }
-        else if (property == "texturetab")
+        else if (property == PropertyId::TextureTab)
         {
             m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
         }
-        else if (property == "texturetabhover")
+        else if (property == PropertyId::TextureTabHover)
         {
             m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
         }
-        else if (property == "textureselectedtab")
+        else if (property == PropertyId::TextureSelectedTab)
         {
             m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
         }
-        else if (property == "textureselectedtabhover")
+        else if (property == PropertyId::TextureSelectedTabHover)
         {
             m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
         }
-        else if (property == "texturedisabledtab")
+        else if (property == PropertyId::TextureDisabledTab)
         {
             m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
         }
-        else if (property == "distancetoside")
+        else if (property == PropertyId::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             recalculateTabsWidth();
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == PropertyId::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == PropertyId::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == PropertyId::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == PropertyId::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -657,7 +692,7 @@ namespace tgui
             for (auto& tab : m_tabs)
                 tab.text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
@@ -825,23 +860,33 @@ namespace tgui
             // Draw the background of the tab
             if (m_spriteTab.isSet() && m_spriteSelectedTab.isSet())
             {
-                Sprite spriteTab;
+                const Sprite* const sprites[] = {&m_spriteTab, &m_spriteTabHover, &m_spriteSelectedTab, &m_spriteSelectedTabHover, &m_spriteDisabledTab};
+
+                int source;
                 if ((!m_enabled || !m_tabs[i].enabled) && m_spriteDisabledTab.isSet())
-                    spriteTab = m_spriteDisabledTab;
+                    source = 4;
                 else if (m_selectedTab == static_cast<int>(i))
                 {
                     if ((m_hoveringTab == static_cast<int>(i)) && m_spriteSelectedTabHover.isSet())
-                        spriteTab = m_spriteSelectedTabHover;
+                        source = 3;
                     else
-                        spriteTab = m_spriteSelectedTab;
+                        source = 2;
                 }
                 else if ((m_hoveringTab == static_cast<int>(i)) && m_spriteTabHover.isSet())
-                    spriteTab = m_spriteTabHover;
+                    source = 1;
                 else
-                    spriteTab = m_spriteTab;
+                    source = 0;
+
+                if (m_spriteDrawnTabSource != source)
+                {
+                    m_spriteDrawnTab = *sprites[source];
+                    m_spriteDrawnTabSource = source;
+                }
+
+                if (m_spriteDrawnTab.getSize() != Vector2f{m_tabs[i].width, usableHeight})
+                    m_spriteDrawnTab.setSize({m_tabs[i].width, usableHeight});
 
-                spriteTab.setSize({m_tabs[i].width, usableHeight});
-                spriteTab.draw(target, states);
+                m_spriteDrawnTab.draw(target, states);
             }
             else // No texture was loaded
             {
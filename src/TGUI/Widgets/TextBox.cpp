@@ -28,12 +28,36 @@
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Returns the amount of slots that an element of a binary indexed tree covers
+        std::size_t lowestBit(std::size_t index)
+        {
+            return index & (~index + 1);
+        }
+
+        // Replaces a range of elements while only moving the elements behind it when the amount of elements changes
+        template <typename T>
+        void replaceElements(std::vector<T>& elements, std::size_t pos, std::size_t count, std::vector<T>& replacement)
+        {
+            const std::size_t commonCount = std::min(count, replacement.size());
+            std::move(replacement.begin(), replacement.begin() + commonCount, elements.begin() + pos);
+
+            if (replacement.size() > count)
+                elements.insert(elements.begin() + pos + commonCount, std::make_move_iterator(replacement.begin() + commonCount), std::make_move_iterator(replacement.end()));
+            else
+                elements.erase(elements.begin() + pos + commonCount, elements.begin() + pos + count);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     TextBox::TextBox()
@@ -130,12 +154,15 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.getSize() > m_maxChars))
             m_text = text.substring(0, m_maxChars);
         else
             m_text = text;
 
+        m_rewrapAllLines = true;
         rearrangeText(false);
     }
 
@@ -143,7 +170,26 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        invalidate();
+
+        // Remove all the excess characters when a character limit is set
+        const std::size_t oldSize = m_text.getSize();
+        if ((m_maxChars > 0) && (oldSize + text.getSize() > m_maxChars))
+        {
+            if (oldSize >= m_maxChars)
+            {
+                rearrangeText(false);
+                return;
+            }
+
+            m_text += text.substring(0, m_maxChars - oldSize);
+        }
+        else
+            m_text += text;
+
+        // Only the last paragraph has to be word wrapped again
+        textChanged(oldSize, oldSize, m_text.getSize());
+        rearrangeText(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -168,6 +214,8 @@ namespace tgui
 
     void TextBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Store the new text size
         m_textSize = size;
         if (m_textSize < 1)
@@ -185,6 +233,7 @@ namespace tgui
 
         m_verticalScroll->setScrollAmount(m_lineHeight);
 
+        m_rewrapAllLines = true;
         rearrangeText(true);
     }
 
@@ -199,6 +248,8 @@ namespace tgui
 
     void TextBox::setMaximumCharacters(std::size_t maxChars)
     {
+        invalidate();
+
         // Set the new character limit ( 0 to disable the limit )
         m_maxChars = maxChars;
 
@@ -206,6 +257,7 @@ namespace tgui
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
         {
             // Remove all the excess characters
+            textChanged(m_maxChars, m_text.getSize(), m_maxChars);
             m_text.erase(m_maxChars, sf::String::InvalidPos);
             rearrangeText(false);
         }
@@ -222,6 +274,8 @@ namespace tgui
 
     void TextBox::setVerticalScrollbarPresent(bool present)
     {
+        invalidate();
+
         if (present)
         {
             m_verticalScroll->setVisible(true);
@@ -245,29 +299,18 @@ namespace tgui
 
     void TextBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
+        invalidate();
+
         // The caret position has to stay inside the string
         if (charactersBeforeCaret > m_text.getSize())
             charactersBeforeCaret = m_text.getSize();
 
         // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
+        if (!m_paragraphs.empty())
         {
-            if (count + m_lines[i].getSize() < charactersBeforeCaret)
-            {
-                count += m_lines[i].getSize();
-                if ((count < m_text.getSize()) && (m_text[count] == '\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
-
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
+            m_selStart = findLinePosition(charactersBeforeCaret);
+            m_selEnd = m_selStart;
+            updateSelectionTexts();
         }
     }
 
@@ -282,6 +325,8 @@ namespace tgui
 
     void TextBox::setReadOnly(bool readOnly)
     {
+        invalidate();
+
         m_readOnly = readOnly;
     }
 
@@ -307,6 +352,9 @@ namespace tgui
         {
             m_caretVisible = true;
             m_animationTimeElapsed = {};
+
+            // Let the caret blink
+            scheduleUpdates();
         }
         else // Unfocusing
         {
@@ -413,6 +461,7 @@ namespace tgui
 
                 // If the next click comes soon enough then it will be a double click
                 m_possibleDoubleClick = true;
+                scheduleUpdates();
             }
 
             // Update the texts
@@ -805,6 +854,7 @@ namespace tgui
                         m_selStart = m_selEnd;
 
                         m_text.erase(pos - 1, 1);
+                        textChanged(pos - 1, pos, pos - 1);
                         rearrangeText(true);
                     }
                 }
@@ -827,7 +877,13 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
+                    const std::size_t pos = findTextSelectionPositions().second;
+                    if (pos < m_text.getSize())
+                    {
+                        m_text.erase(pos, 1);
+                        textChanged(pos, pos + 1, pos);
+                    }
+
                     rearrangeText(true);
                 }
                 else // You did select some characters, so remove them
@@ -887,8 +943,10 @@ namespace tgui
                     {
                         deleteSelectedCharacters();
 
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
+                        const std::size_t pos = findTextSelectionPositions().first;
+                        m_text.insert(pos, clipboardContents);
                         m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
+                        textChanged(pos, pos, pos + clipboardContents.getSize());
 
                         m_selStart.x += clipboardContents.getSize();
                         m_selEnd = m_selStart;
@@ -929,6 +987,7 @@ namespace tgui
 
             m_text.insert(caretPosition, key);
             m_lines[m_selEnd.y].insert(m_selEnd.x, key);
+            textChanged(caretPosition, caretPosition, caretPosition + 1);
 
             // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
             if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
@@ -962,6 +1021,7 @@ namespace tgui
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
 
+                m_rewrapAllLines = true;
                 rearrangeText(true);
             }
         }
@@ -1029,9 +1089,9 @@ namespace tgui
             //    return sf::Vector2f<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = m_fontCached.getAdvance(' ', getTextSize(), false) * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = m_fontCached.getAdvance(curChar, getTextSize(), false);
 
             const float kerning = m_fontCached.getKerning(prevChar, curChar, getTextSize());
             if (width + charWidth + kerning <= position.x)
@@ -1055,16 +1115,18 @@ namespace tgui
 
     std::pair<std::size_t, std::size_t> TextBox::findTextSelectionPositions() const
     {
-        // This function is used to count the amount of characters spread over several lines
+        // This function is used to count the amount of characters spread over several lines.
+        // Only the lines of the paragraph itself have to be counted, the paragraphs above it are found in the paragraph index.
         auto findIndex = [this](std::size_t line)
         {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
+            if (m_paragraphs.empty())
+                return std::size_t{0};
+
+            const ParagraphPosition paragraph = findParagraphContainingLine(line);
+
+            std::size_t counter = paragraph.textStart;
+            for (std::size_t i = paragraph.firstLine; i < line; ++i)
                 counter += m_lines[i].getSize();
-                if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
-                    counter += 1;
-            }
 
             return counter;
         };
@@ -1083,11 +1145,13 @@ namespace tgui
             if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
             {
                 m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
+                textChanged(textSelectionPositions.second, textSelectionPositions.first, textSelectionPositions.second);
                 m_selStart = m_selEnd;
             }
             else
             {
                 m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
+                textChanged(textSelectionPositions.first, textSelectionPositions.second, textSelectionPositions.first);
                 m_selEnd = m_selStart;
             }
 
@@ -1119,66 +1183,60 @@ namespace tgui
             textSelectionPositions = findTextSelectionPositions();
 
         // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
-
-        // Split the string in multiple lines
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        if (m_rewrapAllLines || m_paragraphs.empty() || (maxLineWidth != m_wrappedLineWidth))
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
-
-            searchPosStart = newLinePos + 1;
+            m_lines.clear();
+            m_paragraphs.clear();
+            wrapParagraphs(0, m_text.getSize(), maxLineWidth, m_lines, m_paragraphs);
+            rebuildParagraphIndex();
         }
-
-        // Check if we should try to keep our selection
-        if (keepSelection)
+        else if (m_changedTextStart != sf::String::InvalidPos)
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
+            // Find the paragraphs that contained the changed characters before the text was changed
+            const ParagraphPosition first = findParagraphContainingCharacter(m_changedTextStart);
+            const ParagraphPosition last = findParagraphContainingCharacter(m_changedTextOldEnd);
+            const std::size_t oldParagraphCount = last.index + 1 - first.index;
+            const std::size_t oldRegionEnd = last.textStart + m_paragraphs[last.index].length;
+            const std::size_t oldLineCount = last.firstLine + m_paragraphs[last.index].lineCount - first.firstLine;
 
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].getSize();
+            // The characters behind the changed part were only moved, so the region ends at the same paragraph as before
+            const std::size_t newRegionEnd = oldRegionEnd + m_changedTextNewEnd - m_changedTextOldEnd;
 
-                if (!newSelStartFound && (index >= textSelectionPositions.first))
-                {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.first), i);
+            std::vector<sf::String> lines;
+            std::vector<Paragraph> paragraphs;
+            wrapParagraphs(first.textStart, newRegionEnd, maxLineWidth, lines, paragraphs);
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+            replaceElements(m_lines, first.firstLine, oldLineCount, lines);
 
-                if (!newSelEndFound && (index >= textSelectionPositions.second))
+            // The index only has to be rebuilt when paragraphs were added or removed
+            if (paragraphs.size() == oldParagraphCount)
+            {
+                for (std::size_t i = 0; i < paragraphs.size(); ++i)
                 {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.second), i);
-
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
+                    const Paragraph oldParagraph = m_paragraphs[first.index + i];
+                    m_paragraphs[first.index + i] = paragraphs[i];
+                    updateParagraphIndex(first.index + i, oldParagraph);
                 }
-
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
             }
+            else
+            {
+                replaceElements(m_paragraphs, first.index, oldParagraphCount, paragraphs);
+                rebuildParagraphIndex();
+            }
+        }
 
+        m_wrappedLineWidth = maxLineWidth;
+        m_rewrapAllLines = false;
+        m_changedTextStart = sf::String::InvalidPos;
+
+        // Check if we should try to keep our selection
+        if (keepSelection)
+        {
             // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
+            if ((textSelectionPositions.first <= m_text.getSize()) && (textSelectionPositions.second <= m_text.getSize()))
             {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
+                m_selStart = findLinePosition(textSelectionPositions.first);
+                m_selEnd = findLinePosition(textSelectionPositions.second);
             }
             else // The text has changed too much, the selection can't be kept
             {
@@ -1211,73 +1269,172 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::updateSelectionTexts()
+    void TextBox::textChanged(std::size_t start, std::size_t oldEnd, std::size_t newEnd)
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
+        if (m_changedTextStart == sf::String::InvalidPos)
         {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
-
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection1.setString("");
-            m_textSelection2.setString("");
-            m_textAfterSelection1.setString("");
-            m_textAfterSelection2.setString("");
+            m_changedTextStart = start;
+            m_changedTextOldEnd = oldEnd;
+            m_changedTextNewEnd = newEnd;
         }
-        else // Some text is selected
+        else // The text was already changed before the lines were updated, merge both changes into a single one
         {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
+            const std::size_t end = std::max(m_changedTextNewEnd, oldEnd);
+            m_changedTextStart = std::min(m_changedTextStart, start);
+            m_changedTextOldEnd = end + m_changedTextOldEnd - m_changedTextNewEnd;
+            m_changedTextNewEnd = end + newEnd - oldEnd;
+        }
+    }
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
+    void TextBox::rebuildParagraphIndex()
+    {
+        m_paragraphIndex.assign(m_paragraphs.size() + 1, {});
+        for (std::size_t i = 0; i < m_paragraphs.size(); ++i)
+        {
+            m_paragraphIndex[i + 1].length = m_paragraphs[i].length + 1;
+            m_paragraphIndex[i + 1].lineCount = m_paragraphs[i].lineCount;
+        }
 
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
+        for (std::size_t i = 1; i < m_paragraphIndex.size(); ++i)
+        {
+            const std::size_t parent = i + lowestBit(i);
+            if (parent < m_paragraphIndex.size())
+            {
+                m_paragraphIndex[parent].length += m_paragraphIndex[i].length;
+                m_paragraphIndex[parent].lineCount += m_paragraphIndex[i].lineCount;
             }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
+        }
+    }
 
-            // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateParagraphIndex(std::size_t paragraphIndex, const Paragraph& oldParagraph)
+    {
+        // The differences may be negative, but unsigned arithmetic still gives the correct sums
+        const std::size_t lengthDiff = m_paragraphs[paragraphIndex].length - oldParagraph.length;
+        const std::size_t lineCountDiff = m_paragraphs[paragraphIndex].lineCount - oldParagraph.lineCount;
+        for (std::size_t i = paragraphIndex + 1; i < m_paragraphIndex.size(); i += lowestBit(i))
+        {
+            m_paragraphIndex[i].length += lengthDiff;
+            m_paragraphIndex[i].lineCount += lineCountDiff;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBox::ParagraphPosition TextBox::findParagraphContainingCharacter(std::size_t textPos) const
+    {
+        return findParagraph(&Paragraph::length, textPos);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBox::ParagraphPosition TextBox::findParagraphContainingLine(std::size_t lineIndex) const
+    {
+        return findParagraph(&Paragraph::lineCount, lineIndex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextBox::ParagraphPosition TextBox::findParagraph(std::size_t Paragraph::*member, std::size_t value) const
+    {
+        ParagraphPosition position;
+        if (m_paragraphIndex.size() <= 1)
+            return position;
+
+        std::size_t step = 1;
+        while (step * 2 < m_paragraphIndex.size())
+            step *= 2;
+
+        for (; step > 0; step /= 2)
+        {
+            const std::size_t slot = position.index + step;
+            if ((slot < m_paragraphIndex.size()) && (m_paragraphIndex[slot].*member <= value))
             {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
-                m_textSelection2.setString("");
+                position.index = slot;
+                position.textStart += m_paragraphIndex[slot].length;
+                position.firstLine += m_paragraphIndex[slot].lineCount;
+                value -= m_paragraphIndex[slot].*member;
             }
-            else
-            {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+        }
+
+        // Positions behind the text belong to the last paragraph
+        if (position.index == m_paragraphs.size())
+        {
+            --position.index;
+            position.textStart -= m_paragraphs.back().length + 1;
+            position.firstLine -= m_paragraphs.back().lineCount;
+        }
 
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
+        return position;
+    }
 
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                m_textSelection2.setString(string);
-            }
+    sf::Vector2<std::size_t> TextBox::findLinePosition(std::size_t textPos) const
+    {
+        const ParagraphPosition paragraph = findParagraphContainingCharacter(textPos);
 
-            // Set the text after the selection
+        // A position at the end of a line is placed on that line instead of at the start of the next one
+        std::size_t lineStart = paragraph.textStart;
+        std::size_t line = paragraph.firstLine;
+        const std::size_t lastLine = paragraph.firstLine + m_paragraphs[paragraph.index].lineCount - 1;
+        while ((line < lastLine) && (lineStart + m_lines[line].getSize() < textPos))
+        {
+            lineStart += m_lines[line].getSize();
+            ++line;
+        }
+
+        return {textPos - lineStart, line};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::wrapParagraphs(std::size_t start, std::size_t end, float maxLineWidth,
+                                 std::vector<sf::String>& lines, std::vector<Paragraph>& paragraphs) const
+    {
+        while (true)
+        {
+            std::size_t paragraphEnd = m_text.find('\n', start);
+            if ((paragraphEnd == sf::String::InvalidPos) || (paragraphEnd > end))
+                paragraphEnd = end;
+
+            const sf::String string = Text::wordWrap(maxLineWidth, m_text.substring(start, paragraphEnd - start), m_fontCached, m_textSize, false, false);
+
+            // Split the string in multiple lines
+            Paragraph paragraph;
+            paragraph.length = paragraphEnd - start;
+
+            std::size_t searchPosStart = 0;
+            std::size_t newLinePos = 0;
+            while (newLinePos != sf::String::InvalidPos)
             {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+                newLinePos = string.find('\n', searchPosStart);
 
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
+                if (newLinePos != sf::String::InvalidPos)
+                    lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
+                else
+                    lines.push_back(string.substring(searchPosStart));
 
-                m_textAfterSelection2.setString(string);
+                paragraph.lineCount++;
+                searchPosStart = newLinePos + 1;
             }
+
+            paragraphs.push_back(paragraph);
+
+            if (paragraphEnd == end)
+                break;
+
+            start = paragraphEnd + 1;
         }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateSelectionTexts()
+    {
         // Check if the caret is located above or below the view
         if (isVerticalScrollbarPresent())
         {
@@ -1295,6 +1452,112 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::updateVisibleTexts()
+    {
+        m_visibleTextsTopLine = m_topLine;
+        m_visibleTextsLineCount = m_visibleLines;
+        m_visibleTextsOutdated = false;
+
+        m_selectionRects.clear();
+        if (m_lines.empty() || !m_fontCached)
+            return;
+
+        // Only the visible lines are placed in the texts, including the line below them which may be partially visible
+        const std::size_t firstLine = std::min(m_topLine, m_lines.size() - 1);
+        const std::size_t lastLine = std::min(m_topLine + m_visibleLines, m_lines.size() - 1);
+
+        const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        sf::Text tempText{"", *m_fontCached.getFont(), getTextSize()};
+
+        // Returns the horizontal position at which the given character is drawn
+        auto findCharacterX = [&](sf::Vector2<std::size_t> pos)
+        {
+            const sf::String& line = m_lines[pos.y];
+            tempText.setString(line.substring(0, pos.x));
+
+            float kerning = 0;
+            if ((pos.x > 0) && (pos.x < line.getSize()))
+                kerning = m_fontCached.getKerning(line[pos.x-1], line[pos.x], m_textSize);
+
+            return textOffset + tempText.findCharacterPos(pos.x).x + kerning;
+        };
+
+        // Puts the characters between the two positions that are visible in the text object
+        auto setVisibleText = [&](Text& text, sf::Vector2<std::size_t> from, sf::Vector2<std::size_t> to)
+        {
+            if ((to.y < firstLine) || (from.y > lastLine))
+            {
+                text.setString("");
+                return;
+            }
+
+            if (from.y < firstLine)
+                from = {0, firstLine};
+            if (to.y > lastLine)
+                to = {m_lines[lastLine].getSize(), lastLine};
+
+            sf::String string = m_lines[from.y].substring(from.x, (from.y == to.y) ? (to.x - from.x) : sf::String::InvalidPos);
+            for (std::size_t i = from.y + 1; i <= to.y; ++i)
+            {
+                string += '\n';
+                string += m_lines[i].substring(0, (i == to.y) ? to.x : sf::String::InvalidPos);
+            }
+
+            text.setString(string);
+            text.setPosition({findCharacterX(from), static_cast<float>(from.y * m_lineHeight)});
+        };
+
+        // If there is no selection then just put the whole text in m_textBeforeSelection
+        if (m_selStart == m_selEnd)
+        {
+            setVisibleText(m_textBeforeSelection, {0, 0}, {m_lines.back().getSize(), m_lines.size() - 1});
+            m_textSelection1.setString("");
+            m_textSelection2.setString("");
+            m_textAfterSelection1.setString("");
+            m_textAfterSelection2.setString("");
+        }
+        else // Some text is selected
+        {
+            auto selectionStart = m_selStart;
+            auto selectionEnd = m_selEnd;
+
+            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+                std::swap(selectionStart, selectionEnd);
+
+            // Set the text before the selection
+            setVisibleText(m_textBeforeSelection, {0, 0}, selectionStart);
+
+            // Set the selected text
+            if (selectionStart.y == selectionEnd.y)
+            {
+                setVisibleText(m_textSelection1, selectionStart, selectionEnd);
+                m_textSelection2.setString("");
+            }
+            else
+            {
+                setVisibleText(m_textSelection1, selectionStart, {m_lines[selectionStart.y].getSize(), selectionStart.y});
+                setVisibleText(m_textSelection2, {0, selectionStart.y + 1}, selectionEnd);
+            }
+
+            // Set the text after the selection
+            setVisibleText(m_textAfterSelection1, selectionEnd, {m_lines[selectionEnd.y].getSize(), selectionEnd.y});
+            if (selectionEnd.y + 1 < m_lines.size())
+                setVisibleText(m_textAfterSelection2, {0, selectionEnd.y + 1}, {m_lines.back().getSize(), m_lines.size() - 1});
+            else
+                m_textAfterSelection2.setString("");
+
+            // Recalculate the selection rectangles on the visible lines
+            for (std::size_t i = std::max(selectionStart.y, firstLine); i <= std::min(selectionEnd.y, lastLine); ++i)
+            {
+                const float left = (i == selectionStart.y) ? findCharacterX(selectionStart) : 0;
+                const float right = (i == selectionEnd.y) ? findCharacterX(selectionEnd) : findCharacterX({m_lines[i].getSize(), i}) + textOffset;
+                m_selectionRects.push_back({left, static_cast<float>(i * m_lineHeight), right - left, static_cast<float>(m_lineHeight)});
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f TextBox::getInnerSize() const
     {
         return {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
@@ -1315,6 +1578,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1323,6 +1588,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::isUpdateNeeded() const
+    {
+        return Widget::isUpdateNeeded() || m_focused || m_possibleDoubleClick;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time TextBox::getTimeUntilNextUpdate() const
+    {
+        // The caret blinks every half second, which is also when a possible double click expires
+        sf::Time time = Widget::getTimeUntilNextUpdate();
+        if (m_focused || m_possibleDoubleClick)
+            time = std::min(time, std::max(sf::Time::Zero, sf::milliseconds(500) - m_animationTimeElapsed));
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::recalculatePositions()
     {
         if (!m_fontCached)
@@ -1342,87 +1626,8 @@ namespace tgui
             m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
         }
 
-        // Calculate the position of the text objects
-        m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
-            float kerningSelectionStart = 0;
-            if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
-                kerningSelectionStart = m_fontCached.getKerning(m_lines[selectionStart.y][selectionStart.x-1], m_lines[selectionStart.y][selectionStart.x], m_textSize);
-
-            float kerningSelectionEnd = 0;
-            if ((selectionEnd.x > 0) && (selectionEnd.x < m_lines[selectionEnd.y].getSize()))
-                kerningSelectionEnd = m_fontCached.getKerning(m_lines[selectionEnd.y][selectionEnd.x-1], m_lines[selectionEnd.y][selectionEnd.x], m_textSize);
-
-            if (selectionStart.x > 0)
-            {
-                m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-            }
-            else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
-
-            m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
-
-            if (!m_textSelection2.getString().isEmpty() || (selectionEnd.x == 0))
-            {
-                m_textAfterSelection1.setPosition({textOffset + m_textSelection2.findCharacterPos(m_textSelection2.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection2.getPosition().y + ((selectionEnd.y - selectionStart.y - 1) * m_lineHeight)});
-            }
-            else
-                m_textAfterSelection1.setPosition({m_textSelection1.getPosition().x + m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x + kerningSelectionEnd,
-                                                   m_textSelection1.getPosition().y});
-
-            m_textAfterSelection2.setPosition({textOffset, static_cast<float>((selectionEnd.y + 1) * m_lineHeight)});
-
-            // Recalculate the selection rectangles
-            {
-                m_selectionRects.push_back({m_textSelection1.getPosition().x, static_cast<float>(selectionStart.y * m_lineHeight), 0, static_cast<float>(m_lineHeight)});
-
-                if (!m_lines[selectionStart.y].isEmpty())
-                {
-                    m_selectionRects.back().width = m_textSelection1.findCharacterPos(m_textSelection1.getString().getSize()).x;
-
-                    // There is kerning when the selection is on just this line
-                    if (selectionStart.y == selectionEnd.y)
-                        m_selectionRects.back().width += kerningSelectionEnd;
-                }
-
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                {
-                    m_selectionRects.back().width += textOffset;
-                    m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(i * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-
-                    if (!m_lines[i].isEmpty())
-                    {
-                        tempText.setString(m_lines[i]);
-                        m_selectionRects.back().width += tempText.findCharacterPos(tempText.getString().getSize()).x;
-                    }
-                }
-
-                if (selectionStart.y != selectionEnd.y)
-                {
-                    m_selectionRects.back().width += textOffset;
-
-                    if (m_textSelection2.getString() != "")
-                    {
-                        tempText.setString(m_lines[selectionEnd.y].substring(0, selectionEnd.x));
-                        m_selectionRects.push_back({m_textSelection2.getPosition().x - textOffset, static_cast<float>(selectionEnd.y * m_lineHeight),
-                                                    textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerningSelectionEnd, static_cast<float>(m_lineHeight)});
-                    }
-                    else
-                        m_selectionRects.push_back({0, static_cast<float>(selectionEnd.y * m_lineHeight), textOffset, static_cast<float>(m_lineHeight)});
-                }
-            }
-        }
-
+        // The texts have to be updated, even when the same lines remain visible
+        m_visibleTextsOutdated = true;
         recalculateVisibleLines();
     }
 
@@ -1448,6 +1653,10 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
         }
+
+        // Only the visible lines are stored in the texts, so they have to be updated when other lines become visible
+        if (m_visibleTextsOutdated || (m_topLine != m_visibleTextsTopLine) || (m_visibleLines != m_visibleTextsLineCount))
+            updateVisibleTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1462,64 +1671,64 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::rendererChanged(const std::string& property)
+    void TextBox::rendererChanged(PropertyId property)
     {
-        if (property == "borders")
+        if (property == PropertyId::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             setSize(m_size);
         }
-        else if (property == "padding")
+        else if (property == PropertyId::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             setSize(m_size);
         }
-        else if (property == "textcolor")
+        else if (property == PropertyId::TextColor)
         {
             m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "selectedtextcolor")
+        else if (property == PropertyId::SelectedTextColor)
         {
             m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
             m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == "texturebackground")
+        else if (property == PropertyId::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (property == PropertyId::Scrollbar)
         {
             m_verticalScroll->setRenderer(getSharedRenderer()->getScrollbar());
         }
-        else if (property == "scrollbarwidth")
+        else if (property == PropertyId::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScroll->getDefaultWidth();
             m_verticalScroll->setSize({width, m_verticalScroll->getSize().y});
             setSize(m_size);
         }
-        else if (property == "backgroundcolor")
+        else if (property == PropertyId::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (property == PropertyId::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if (property == "bordercolor")
+        else if (property == PropertyId::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "caretcolor")
+        else if (property == PropertyId::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == "caretwidth")
+        else if (property == PropertyId::CaretWidth)
         {
             m_caretWidthCached = getSharedRenderer()->getCaretWidth();
         }
-        else if (property == "opacity")
+        else if (property == PropertyId::Opacity)
         {
             Widget::rendererChanged(property);
 
@@ -1531,7 +1740,7 @@ namespace tgui
             m_textSelection1.setOpacity(m_opacityCached);
             m_textSelection2.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == PropertyId::Font)
         {
             Widget::rendererChanged(property);
 
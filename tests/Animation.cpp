@@ -199,4 +199,43 @@ TEST_CASE("[Animation]") {
 
         // TODO: Add tests for simultaneous animations (tests for both same type and different types)
     }
+
+    SECTION("Easing") {
+        widget->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300), tgui::AnimationEasing::EaseIn);
+        widget->update(sf::milliseconds(150));
+        REQUIRE(tgui::compareFloats(widget->getInheritedOpacity(), 0.9f * 0.125f));
+        widget->update(sf::milliseconds(150));
+        REQUIRE(widget->getInheritedOpacity() == 0.9f);
+
+        widget->showWithEffect(tgui::ShowAnimationType::SlideFromLeft, sf::milliseconds(300), tgui::AnimationEasing::EaseOut);
+        widget->update(sf::milliseconds(150));
+        REQUIRE(compareVector2f(widget->getPosition(), {-120.f + (150.f * 0.875f), 15}));
+    }
+
+    SECTION("Only animating widgets are updated") {
+        REQUIRE(!widget->isUpdateNeeded());
+        REQUIRE(!parent->isUpdateNeeded());
+
+        widget->showWithEffect(tgui::ShowAnimationType::SlideFromLeft, sf::milliseconds(300));
+        REQUIRE(widget->isUpdateNeeded());
+        REQUIRE(parent->isUpdateNeeded());
+
+        // Updating the parent advances the animation of the child
+        parent->update(sf::milliseconds(100));
+        REQUIRE(compareVector2f(widget->getPosition(), {-120.f+((120.f+30.f)/3.f), 15}));
+
+        // The parent stops updating once the animation is over
+        parent->update(sf::milliseconds(200));
+        REQUIRE(widget->getPosition() == sf::Vector2f(30, 15));
+        REQUIRE(!parent->isUpdateNeeded());
+
+        // A parent that is added later still finds out about the animation
+        tgui::Panel::Ptr grandParent = tgui::Panel::create();
+        widget->hideWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        grandParent->add(parent);
+        REQUIRE(grandParent->isUpdateNeeded());
+        grandParent->update(sf::milliseconds(300));
+        REQUIRE(!widget->isVisible());
+        REQUIRE(!grandParent->isUpdateNeeded());
+    }
 }
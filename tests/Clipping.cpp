@@ -28,6 +28,48 @@
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Widgets/Label.hpp>
 #include <TGUI/Widgets/HorizontalLayout.hpp>
+#include <TGUI/Widgets/ScrollablePanel.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+
+namespace
+{
+    // Widget that draws a large rectangle directly on the render target instead of going through DrawBatch
+    class DirectlyDrawnWidget : public tgui::Widget
+    {
+    public:
+        bool mouseOnWidget(tgui::Vector2f) const override
+        {
+            return false;
+        }
+
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+        {
+            states.transform.translate(getPosition());
+
+            sf::RectangleShape shape{{200, 200}};
+            shape.setFillColor(sf::Color::Red);
+            target.draw(shape, states);
+        }
+
+        tgui::Widget::Ptr clone() const override
+        {
+            return std::make_shared<DirectlyDrawnWidget>(*this);
+        }
+    };
+
+    // Widget that remembers the view of the render target every time it is drawn
+    class ViewRecordingWidget : public DirectlyDrawnWidget
+    {
+    public:
+        void draw(sf::RenderTarget& target, sf::RenderStates states) const override
+        {
+            views.push_back(target.getView());
+            DirectlyDrawnWidget::draw(target, states);
+        }
+
+        mutable std::vector<sf::View> views;
+    };
+}
 
 TEST_CASE("[Clipping]")
 {
@@ -120,4 +162,141 @@ TEST_CASE("[Clipping]")
 
         TEST_DRAW("Clipping_NestedLayers.png")
     }
+
+    SECTION("Clip rect stack")
+    {
+        sf::RenderTexture target;
+        target.create(100, 100);
+        tgui::Clipping::setGuiView(sf::View{{0, 0, 100, 100}});
+        REQUIRE(!tgui::Clipping::isActive());
+        REQUIRE(tgui::Clipping::getClipRect() == tgui::FloatRect(0, 0, 100, 100));
+
+        sf::RenderStates states;
+        states.transform.translate({10, 20});
+        {
+            tgui::Clipping clipping{target, states, {0, 0}, {50, 50}};
+            REQUIRE(tgui::Clipping::isActive());
+            REQUIRE(tgui::Clipping::getClipRect() == tgui::FloatRect(10, 20, 50, 50));
+
+            {
+                tgui::Clipping nestedClipping{target, states, {30, -10}, {50, 50}};
+                REQUIRE(tgui::Clipping::getClipRect() == tgui::FloatRect(40, 20, 20, 40));
+                REQUIRE(tgui::Clipping::isRectVisible({50, 50, 5, 5}));
+                REQUIRE(!tgui::Clipping::isRectVisible({20, 30, 10, 10}));
+            }
+
+            {
+                tgui::Clipping outsideClipping{target, states, {60, 0}, {10, 10}};
+                REQUIRE(tgui::Clipping::getClipRect().width == 0);
+                REQUIRE(!tgui::Clipping::isRectVisible({0, 0, 100, 100}));
+            }
+
+            REQUIRE(tgui::Clipping::getClipRect() == tgui::FloatRect(10, 20, 50, 50));
+        }
+
+        REQUIRE(!tgui::Clipping::isActive());
+    }
+
+    SECTION("Drawn directly on target")
+    {
+        auto panel = tgui::Panel::create({20, 20});
+        panel->setPosition({10, 10});
+        TEST_DRAW_INIT(50, 50, panel)
+
+        auto widget = std::make_shared<DirectlyDrawnWidget>();
+        widget->setPosition({-5, -5});
+        widget->setSize({10, 10});
+        panel->add(widget);
+
+        const auto checkClipped = [&]{
+            target.clear(sf::Color::Blue);
+            gui.draw();
+            target.display();
+
+            const sf::Image image = target.getTexture().copyToImage();
+            REQUIRE(image.getPixel(20, 20) == sf::Color::Red);
+            REQUIRE(image.getPixel(5, 5) == sf::Color::Blue);
+            REQUIRE(image.getPixel(35, 35) == sf::Color::Blue);
+            REQUIRE(image.getPixel(40, 20) == sf::Color::Blue);
+        };
+
+        checkClipped();
+
+        gui.setDrawBatchingEnabled(true);
+        checkClipped();
+    }
+
+    SECTION("View is not changed")
+    {
+        auto outerPanel = tgui::ScrollablePanel::create({80, 80});
+        outerPanel->setPosition({5, 5});
+        outerPanel->setContentSize({200, 200});
+        TEST_DRAW_INIT(100, 100, outerPanel)
+
+        auto innerPanel = tgui::ScrollablePanel::create({60, 60});
+        innerPanel->setPosition({5, 5});
+        innerPanel->setContentSize({150, 150});
+        outerPanel->add(innerPanel);
+
+        auto widget = std::make_shared<ViewRecordingWidget>();
+        widget->setPosition({5, 5});
+        widget->setSize({10, 10});
+        innerPanel->add(widget);
+
+        // The nested clipping areas are applied with the scissor rectangle, the widget is drawn with the view of the gui
+        const auto checkViews = [&]{
+            widget->views.clear();
+            target.clear(sf::Color::Blue);
+            gui.draw();
+            target.display();
+
+            REQUIRE(widget->views.size() == 1);
+            REQUIRE(widget->views[0].getCenter() == gui.getView().getCenter());
+            REQUIRE(widget->views[0].getSize() == gui.getView().getSize());
+            REQUIRE(widget->views[0].getViewport() == gui.getView().getViewport());
+            REQUIRE(target.getView().getCenter() == target.getDefaultView().getCenter());
+
+            const sf::Image image = target.getTexture().copyToImage();
+            REQUIRE(image.getPixel(20, 20) == sf::Color::Red);
+            REQUIRE(image.getPixel(75, 20) != sf::Color::Red);
+            REQUIRE(image.getPixel(20, 75) != sf::Color::Red);
+            REQUIRE(image.getPixel(95, 95) == sf::Color::Blue);
+        };
+
+        checkViews();
+
+        gui.setDrawBatchingEnabled(true);
+        checkViews();
+    }
+
+    SECTION("Batched")
+    {
+        auto panel = tgui::Panel::create({75, 25});
+        panel->setPosition({10, 5});
+        panel->getRenderer()->setBackgroundColor(sf::Color::Yellow);
+        TEST_DRAW_INIT(100, 40, panel)
+
+        auto label = tgui::Label::create("Hello World");
+        label->setTextSize(20);
+        label->setPosition({-20, -10});
+        panel->add(label);
+
+        auto hiddenPanel = tgui::Panel::create({20, 20});
+        hiddenPanel->setPosition({100, 0});
+        hiddenPanel->getRenderer()->setBackgroundColor(sf::Color::Red);
+        panel->add(hiddenPanel);
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("Clipping_Unbatched.png");
+
+        gui.setDrawBatchingEnabled(true);
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("Clipping_Batched.png");
+
+        compareImageFiles("Clipping_Batched.png", "Clipping_Unbatched.png");
+    }
 }
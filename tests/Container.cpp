@@ -130,6 +130,96 @@ TEST_CASE("[Container]")
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
         }
+
+        SECTION("renaming")
+        {
+            REQUIRE(container->get("w5") == widget5);
+
+            // Renaming a widget inside a child container is noticed by the parent
+            widget2->setWidgetName(widget5, "renamed");
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("renamed") == widget5);
+
+            // Adding a widget to a child container that was found before is noticed as well
+            auto widget6 = tgui::Label::create();
+            widget2->add(widget6, "w6");
+            REQUIRE(container->get("w6") == widget6);
+        }
+
+        SECTION("nested containers")
+        {
+            REQUIRE(container->get("w4") == widget4);
+
+            // Widgets in a container that is added later can be found immediately
+            auto panel = tgui::Panel::create();
+            auto widget6 = tgui::Label::create();
+            auto widget7 = tgui::Label::create();
+            panel->add(widget6, "w6");
+            panel->add(widget7, "w4");
+            REQUIRE(panel->get("w6") == widget6);
+            widget2->add(panel, "panel");
+            REQUIRE(container->get("w6") == widget6);
+            REQUIRE(widget2->get("w6") == widget6);
+            REQUIRE(panel->get("w6") == widget6);
+
+            // The widget found first is returned when names are used more than once
+            REQUIRE(container->get("w4") == widget4);
+            REQUIRE(widget2->get("w4") == widget4);
+            REQUIRE(panel->get("w4") == widget7);
+
+            // Widgets in other containers aren't returned
+            REQUIRE(panel->get("w1") == nullptr);
+            REQUIRE(panel->get("w5") == nullptr);
+
+            // Renaming a container keeps the widgets inside it
+            widget2->setWidgetName(panel, "renamed");
+            REQUIRE(container->get("renamed") == panel);
+            REQUIRE(container->get("panel") == nullptr);
+            REQUIRE(container->get("w6") == widget6);
+
+            // All widgets inside a container are gone after removing it
+            widget2->remove(panel);
+            REQUIRE(container->get("w6") == nullptr);
+            REQUIRE(container->get("renamed") == nullptr);
+            REQUIRE(container->get("w4") == widget4);
+            REQUIRE(panel->get("w6") == widget6);
+
+            // Removing all widgets from a child container removes them from the parent as well
+            widget2->removeAllWidgets();
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("w2") == widget2);
+        }
+
+        SECTION("path")
+        {
+            REQUIRE(container->get("w2.w4") == widget4);
+            REQUIRE(container->get("w2.w1") == nullptr);
+            REQUIRE(container->get("w1.w4") == nullptr); // w1 is not a container
+            REQUIRE(container->get("w2.") == nullptr);
+
+            // A widget whose name contains a dot is still found by its exact name
+            auto widget6 = tgui::Label::create();
+            container->add(widget6, "w2.w4");
+            REQUIRE(container->get("w2.w4") == widget6);
+        }
+
+        SECTION("moved container")
+        {
+            auto panel = tgui::Panel::create();
+            auto widget6 = tgui::Label::create();
+            panel->add(widget6, "w6");
+            REQUIRE(panel->get("w6") == widget6);
+
+            // The widgets can no longer be found in the container that they were moved from
+            tgui::Panel movedPanel{std::move(*panel)};
+            REQUIRE(panel->get("w6") == nullptr);
+            REQUIRE(movedPanel.get("w6") == widget6);
+
+            *panel = std::move(movedPanel);
+            REQUIRE(movedPanel.get("w6") == nullptr);
+            REQUIRE(panel->get("w6") == widget6);
+        }
     }
 
     SECTION("remove")
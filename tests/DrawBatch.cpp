@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Button.hpp>
+
+TEST_CASE("[DrawBatch]")
+{
+    SECTION("Disabled by default")
+    {
+        sf::RenderTexture target;
+        target.create(50, 50);
+        tgui::Gui gui{target};
+        REQUIRE(!gui.isDrawBatchingEnabled());
+        REQUIRE(!tgui::DrawBatch::isActive());
+
+        gui.setDrawBatchingEnabled(true);
+        REQUIRE(gui.isDrawBatchingEnabled());
+        gui.setDrawBatchingEnabled(false);
+        REQUIRE(!gui.isDrawBatchingEnabled());
+    }
+
+    SECTION("Statistics")
+    {
+        auto background = tgui::Panel::create({400, 300});
+        background->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        TEST_DRAW_INIT(400, 300, background)
+
+        for (unsigned int i = 0; i < 10; ++i)
+        {
+            auto panel = tgui::Panel::create({30, 30});
+            panel->setPosition({10.f + (i * 35.f), 10});
+            panel->getRenderer()->setBackgroundColor(sf::Color::Red);
+            panel->getRenderer()->setBorders({2});
+            gui.add(panel);
+        }
+
+        target.clear();
+        gui.draw();
+        const tgui::DrawBatch::Statistics unbatched = gui.getDrawStatistics();
+        REQUIRE(unbatched.drawCalls > 0);
+        REQUIRE(unbatched.vertices > 0);
+
+        gui.setDrawBatchingEnabled(true);
+        target.clear();
+        gui.draw();
+        const tgui::DrawBatch::Statistics batched = gui.getDrawStatistics();
+        REQUIRE(batched.drawCalls > 0);
+        REQUIRE(batched.drawCalls < unbatched.drawCalls);
+        REQUIRE(!tgui::DrawBatch::isActive());
+    }
+
+    SECTION("Lines and points")
+    {
+        sf::RenderTexture target;
+        target.create(50, 50);
+
+        const sf::Vertex point{{10.5f, 10.5f}, sf::Color::Red};
+        const sf::Vertex line[] = {{{0, 20.5f}, sf::Color::Green}, {{50, 20.5f}, sf::Color::Green}};
+
+        const auto drawPrimitives = [&]{
+            target.clear(sf::Color::Black);
+            tgui::DrawBatch::resetStatistics();
+            tgui::DrawBatch::addVertices(target, {}, &point, 1, sf::PrimitiveType::Points);
+            tgui::DrawBatch::addVertices(target, {}, line, 2, sf::PrimitiveType::Lines);
+            tgui::DrawBatch::addVertices(target, {}, line, 2, sf::PrimitiveType::LineStrip);
+            REQUIRE(tgui::DrawBatch::getStatistics().drawCalls == 3);
+            REQUIRE(tgui::DrawBatch::getStatistics().vertices == 5);
+            target.display();
+
+            const sf::Image image = target.getTexture().copyToImage();
+            REQUIRE(image.getPixel(10, 10) == sf::Color::Red);
+            REQUIRE(image.getPixel(25, 20) == sf::Color::Green);
+            REQUIRE(image.getPixel(25, 30) == sf::Color::Black);
+        };
+
+        drawPrimitives();
+
+        tgui::DrawBatch::begin(target);
+        drawPrimitives();
+        tgui::DrawBatch::end();
+    }
+
+    SECTION("Same result as unbatched")
+    {
+        auto background = tgui::Panel::create({800, 600});
+        background->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        TEST_DRAW_INIT(120, 60, background)
+
+        auto button = tgui::Button::create("Batched");
+        button->setPosition({10, 10});
+        button->setSize({100, 40});
+        gui.add(button);
+
+        auto overlappingPanel = tgui::Panel::create({30, 30});
+        overlappingPanel->setPosition({80, 20});
+        overlappingPanel->getRenderer()->setBackgroundColor({255, 0, 0, 150});
+        gui.add(overlappingPanel);
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("DrawBatch_Unbatched.png");
+
+        gui.setDrawBatchingEnabled(true);
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("DrawBatch_Batched.png");
+
+        compareImageFiles("DrawBatch_Batched.png", "DrawBatch_Unbatched.png");
+    }
+}
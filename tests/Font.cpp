@@ -35,4 +35,29 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    SECTION("Cached metrics")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        const std::shared_ptr<sf::Font> sfFont = font.getFont();
+
+        for (const std::uint32_t codePoint : {U'a', U'W', U'\u00E9', U'\u0416', U'\u4E2D'})
+        {
+            REQUIRE(font.getAdvance(codePoint, 20, false) == sfFont->getGlyph(codePoint, 20, false).advance);
+            REQUIRE(font.getAdvance(codePoint, 20, true) == sfFont->getGlyph(codePoint, 20, true).advance);
+            REQUIRE(font.getAdvance(codePoint, 20, false) == sfFont->getGlyph(codePoint, 20, false).advance);
+        }
+
+        REQUIRE(font.getKerning('A', 'V', 30) == sfFont->getKerning('A', 'V', 30));
+        REQUIRE(font.getKerning('A', 'V', 30) == sfFont->getKerning('A', 'V', 30));
+        REQUIRE(font.getKerning(U'\u0416', 'A', 30) == sfFont->getKerning(U'\u0416', 'A', 30));
+        REQUIRE(font.getLineSpacing(15) == sfFont->getLineSpacing(15));
+        REQUIRE(font.getLineSpacing(25) == sfFont->getLineSpacing(25));
+
+        // Other Font objects using the same sf::Font share the values
+        REQUIRE(tgui::Font(sfFont).getAdvance('a', 20, false) == font.getAdvance('a', 20, false));
+
+        REQUIRE(tgui::Font().getAdvance('a', 20, false) == 0);
+        REQUIRE(tgui::Font().getKerning('A', 'V', 20) == 0);
+    }
 }
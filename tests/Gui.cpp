@@ -0,0 +1,248 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Widgets/MenuBar.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+#include <TGUI/TextureManager.hpp>
+
+TEST_CASE("[Gui]")
+{
+    SECTION("Redraw needed")
+    {
+        auto button = tgui::Button::create("Button");
+        button->setPosition({10, 10});
+        TEST_DRAW_INIT(200, 100, button)
+
+        auto label = tgui::Label::create("Label");
+        label->setPosition({10, 50});
+        gui.add(label);
+
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+
+        gui.draw();
+        REQUIRE(!gui.wasRedrawNeeded());
+
+        button->setPosition({20, 10});
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+
+        gui.draw();
+        REQUIRE(!gui.wasRedrawNeeded());
+
+        label->setText("Changed");
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+
+        label->getRenderer()->setTextColor(sf::Color::Red);
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove.x = 25;
+        event.mouseMove.y = 15;
+        gui.handleEvent(event);
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+
+        gui.draw();
+        REQUIRE(!gui.wasRedrawNeeded());
+
+        // Changing a widget that isn't visible doesn't require a redraw
+        label->setVisible(false);
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+        label->setText("Hidden");
+        gui.draw();
+        REQUIRE(!gui.wasRedrawNeeded());
+
+        gui.remove(label);
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+    }
+
+    SECTION("Time until next update")
+    {
+        auto editBox = tgui::EditBox::create();
+        TEST_DRAW_INIT(200, 100, editBox)
+
+        gui.draw();
+        REQUIRE(!gui.isRedrawNeeded());
+        REQUIRE(!gui.updateTime());
+
+        const sf::Time nothingScheduled = sf::microseconds(std::numeric_limits<sf::Int64>::max());
+        REQUIRE(gui.getTimeUntilNextUpdate() == nothingScheduled);
+
+        // The caret of a focused edit box blinks every half second
+        editBox->setFocused(true);
+        REQUIRE(gui.isRedrawNeeded());
+        REQUIRE(gui.getTimeUntilNextUpdate() > sf::Time::Zero);
+        REQUIRE(gui.getTimeUntilNextUpdate() <= sf::milliseconds(500));
+
+        gui.draw();
+        gui.updateTime(sf::milliseconds(400));
+        REQUIRE(gui.getTimeUntilNextUpdate() <= sf::milliseconds(100));
+        REQUIRE(!gui.isRedrawNeeded());
+
+        gui.updateTime(sf::milliseconds(100));
+        REQUIRE(gui.isRedrawNeeded());
+
+        // Animations have to be updated every frame
+        auto button = tgui::Button::create("Button");
+        gui.add(button);
+        button->showWithEffect(tgui::ShowAnimationType::Fade, sf::milliseconds(300));
+        REQUIRE(gui.getTimeUntilNextUpdate() == sf::Time::Zero);
+
+        gui.updateTime(sf::milliseconds(300));
+        editBox->setFocused(false);
+        gui.updateTime(sf::milliseconds(1));
+        REQUIRE(gui.getTimeUntilNextUpdate() == nothingScheduled);
+    }
+
+    SECTION("Async texture loading")
+    {
+        tgui::TextureManager::setAsyncLoadingEnabled(true);
+        auto picture = tgui::Picture::create("resources/Texture6.png");
+        tgui::TextureManager::setAsyncLoadingEnabled(false);
+        picture->setSize({50, 50});
+        TEST_DRAW_INIT(200, 100, picture)
+
+        REQUIRE(gui.getTextureUploadBudget() == sf::milliseconds(4));
+        gui.setTextureUploadBudget(sf::milliseconds(1));
+        REQUIRE(gui.getTextureUploadBudget() == sf::milliseconds(1));
+
+        // The gui has to check again soon while the image is being decoded, even when the window isn't focused
+        sf::Event event;
+        event.type = sf::Event::LostFocus;
+        gui.handleEvent(event);
+        REQUIRE(tgui::TextureManager::getPendingAsyncLoads() == 1);
+        REQUIRE(gui.getTimeUntilNextUpdate() <= sf::milliseconds(10));
+
+        // The gui uploads the image once it has been decoded
+        for (unsigned int i = 0; (i < 5000) && (tgui::TextureManager::getPendingAsyncLoads() > 0); ++i)
+        {
+            if (tgui::TextureManager::isAsyncLoadReady())
+                REQUIRE(gui.getTimeUntilNextUpdate() == sf::Time::Zero);
+
+            gui.updateTime();
+            sf::sleep(sf::milliseconds(1));
+        }
+
+        REQUIRE(tgui::TextureManager::getPendingAsyncLoads() == 0);
+        REQUIRE(gui.getTimeUntilNextUpdate() == sf::microseconds(std::numeric_limits<sf::Int64>::max()));
+        REQUIRE(picture->getRenderer()->getTexture().getImageSize() != sf::Vector2f(0, 0));
+    }
+
+    SECTION("Frame caching")
+    {
+        auto background = tgui::Panel::create({200, 100});
+        background->getRenderer()->setBackgroundColor({0, 0, 255, 100});
+        TEST_DRAW_INIT(200, 100, background)
+
+        REQUIRE(!gui.isFrameCachingEnabled());
+        gui.setFrameCachingEnabled(true);
+        REQUIRE(gui.isFrameCachingEnabled());
+
+        auto button = tgui::Button::create("Cached");
+        button->setPosition({10, 10});
+        gui.add(button);
+
+        auto label = tgui::Label::create("Label");
+        label->setPosition({10, 50});
+        gui.add(label);
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+
+        // Nothing changed, so the cached frame is drawn without looking at the widgets
+        target.clear({25, 130, 10});
+        gui.draw();
+        REQUIRE(!gui.wasRedrawNeeded());
+        REQUIRE(gui.getDrawStatistics().drawCalls == 1);
+
+        // Only the area of the label is redrawn in the cached frame
+        label->setText("Changed");
+        button->setPosition({100, 10});
+        target.clear({25, 130, 10});
+        gui.draw();
+        REQUIRE(gui.wasRedrawNeeded());
+        target.display();
+        target.getTexture().copyToImage().saveToFile("Gui_FrameCaching_Cached.png");
+
+        gui.setFrameCachingEnabled(false);
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        target.getTexture().copyToImage().saveToFile("Gui_FrameCaching_Uncached.png");
+
+        compareImageFiles("Gui_FrameCaching_Cached.png", "Gui_FrameCaching_Uncached.png");
+
+        SECTION("Open menu")
+        {
+            // The label lies below the open menu but not below the menu bar
+            label->setPosition({5, 30});
+            auto menuBar = tgui::MenuBar::create();
+            menuBar->setSize({200, 20});
+            menuBar->addMenu("File");
+            menuBar->addMenuItem("Load");
+            menuBar->addMenuItem("Save");
+            menuBar->addMenuItem("Exit");
+            gui.add(menuBar);
+
+            sf::Event event;
+            event.type = sf::Event::MouseButtonPressed;
+            event.mouseButton.button = sf::Mouse::Left;
+            event.mouseButton.x = 10;
+            event.mouseButton.y = 10;
+            gui.handleEvent(event);
+
+            gui.setFrameCachingEnabled(true);
+            target.clear({25, 130, 10});
+            gui.draw();
+
+            // Only the area of the label is redrawn, the menu bar has to be drawn again on top of it
+            label->setText("Label below menu");
+            target.clear({25, 130, 10});
+            gui.draw();
+            target.display();
+            target.getTexture().copyToImage().saveToFile("Gui_FrameCaching_OpenMenu_Cached.png");
+
+            gui.setFrameCachingEnabled(false);
+            target.clear({25, 130, 10});
+            gui.draw();
+            target.display();
+            target.getTexture().copyToImage().saveToFile("Gui_FrameCaching_OpenMenu_Uncached.png");
+
+            compareImageFiles("Gui_FrameCaching_OpenMenu_Cached.png", "Gui_FrameCaching_OpenMenu_Uncached.png");
+        }
+    }
+}
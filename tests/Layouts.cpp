@@ -360,6 +360,50 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Deferred updates")
+    {
+        auto widget1 = std::make_shared<tgui::ClickableWidget>();
+        auto widget2 = std::make_shared<tgui::ClickableWidget>();
+        auto widget3 = std::make_shared<tgui::ClickableWidget>();
+        widget1->setSize(50, 20);
+        widget2->setSize(bindWidth(widget1), 20);
+        widget3->setSize(bindWidth(widget1) + bindWidth(widget2), 20);
+        REQUIRE(widget3->getSize() == sf::Vector2f(100, 20));
+
+        unsigned int sizeChangedCount = 0;
+        widget3->connect("SizeChanged", [&]{ sizeChangedCount++; });
+
+        REQUIRE(!Layout::areUpdatesDeferred());
+        Layout::setUpdatesDeferred(true);
+        REQUIRE(Layout::areUpdatesDeferred());
+
+        widget1->setSize(100, 20);
+        REQUIRE(widget2->getSize() == sf::Vector2f(50, 20));
+        REQUIRE(widget3->getSize() == sf::Vector2f(100, 20));
+
+        // Widget3 is only resized once, after widget2 got its new size
+        Layout::flushDeferredUpdates();
+        REQUIRE(widget2->getSize() == sf::Vector2f(100, 20));
+        REQUIRE(widget3->getSize() == sf::Vector2f(200, 20));
+        REQUIRE(sizeChangedCount == 1);
+
+        SECTION("Cycle")
+        {
+            std::streambuf *oldbuf = sf::err().rdbuf(0);
+            widget1->setSize(bindWidth(widget3), 20);
+            Layout::flushDeferredUpdates();
+            sf::err().rdbuf(oldbuf);
+
+            widget1->setSize(10, 20);
+        }
+
+        Layout::setUpdatesDeferred(false);
+        REQUIRE(!Layout::areUpdatesDeferred());
+
+        widget1->setSize(30, 20);
+        REQUIRE(widget3->getSize() == sf::Vector2f(60, 20));
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -198,6 +198,100 @@ TEST_CASE("[DataIO]")
             std::stringstream input("{ Property = ; ");
             REQUIRE_THROWS_AS(tgui::DataIO::parse(input), tgui::Exception);
         }
+
+        SECTION("Parsing from memory")
+        {
+            const std::string input = "Child {\n    Property = [a, \"b\"];\n}\n";
+            auto rootNode = tgui::DataIO::parse(input.data(), input.size());
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->name == "Child");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->listNode);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->valueList.size() == 2);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->valueList[1] == "\"b\"");
+        }
+
+        SECTION("Binary format")
+        {
+            const std::string input = "Prop = 1;\nChild.\"Name\" {\n    Property = [a, \"b\"];\n    Nested { Property = Value; }\n}\n";
+            const std::string binary = tgui::DataIO::convertToBinary(input);
+
+            auto rootNode = tgui::DataIO::parseBinary(binary.data(), binary.size());
+            REQUIRE(rootNode->propertyValuePairs["prop"]->value == "1");
+            REQUIRE(rootNode->children.size() == 1);
+            REQUIRE(rootNode->children[0]->parent == rootNode.get());
+            REQUIRE(rootNode->children[0]->name == "Child.\"Name\"");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->listNode);
+            REQUIRE(rootNode->children[0]->propertyValuePairs["property"]->valueList.size() == 2);
+            REQUIRE(rootNode->children[0]->children.size() == 1);
+            REQUIRE(rootNode->children[0]->children[0]->propertyValuePairs["property"]->value == "Value");
+            REQUIRE(rootNode->propertyValuePairs["prop"]->parsedValue.getType() == tgui::ObjectConverter::Type::None);
+            REQUIRE(rootNode->children[0]->children[0]->propertyValuePairs["property"]->parsedValue.getType() == tgui::ObjectConverter::Type::None);
+
+            // Truncated or unrelated data is rejected
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(binary.data(), binary.size() - 1), tgui::Exception);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(input.data(), input.size()), tgui::Exception);
+
+            // Nodes that are nested too deep are rejected
+            const auto createNestedNodes = [](unsigned int depth){
+                std::string text;
+                for (unsigned int i = 0; i < depth; ++i)
+                    text += "Child {\n";
+                for (unsigned int i = 0; i < depth; ++i)
+                    text += "}\n";
+                return tgui::DataIO::convertToBinary(text);
+            };
+
+            const std::string nestedBinary = createNestedNodes(256);
+            REQUIRE_NOTHROW(tgui::DataIO::parseBinary(nestedBinary.data(), nestedBinary.size()));
+
+            const std::string tooDeepBinary = createNestedNodes(257);
+            REQUIRE_THROWS_AS(tgui::DataIO::parseBinary(tooDeepBinary.data(), tooDeepBinary.size()), tgui::Exception);
+        }
+
+        SECTION("Binary format with parsed values")
+        {
+            const std::string input = "Position = (10, \"&.height / 2\");\nSize = (20, 30);\nTextSize = 13;\n"
+                                      "Renderer { TextColor = rgba(10, 20, 30, 40); Borders = (1, 2, 3, 4); Padding = (10%, 2); Opacity = 0.5; }\n";
+            const std::string binary = tgui::DataIO::convertToBinary(input);
+            auto rootNode = tgui::DataIO::parseBinary(binary.data(), binary.size());
+
+            // The strings are still available
+            REQUIRE(rootNode->propertyValuePairs["textsize"]->value == "13");
+            REQUIRE(rootNode->children[0]->propertyValuePairs["textcolor"]->value == "rgba(10, 20, 30, 40)");
+
+            REQUIRE(rootNode->propertyValuePairs["position"]->parsedLayout != nullptr);
+            REQUIRE(rootNode->propertyValuePairs["position"]->parsedLayout->x.toString() == tgui::Layout{10}.toString());
+            REQUIRE(rootNode->propertyValuePairs["position"]->parsedLayout->y.toString() == tgui::Layout{"&.height / 2"}.toString());
+            REQUIRE(rootNode->propertyValuePairs["size"]->parsedLayout != nullptr);
+            REQUIRE(rootNode->propertyValuePairs["size"]->parsedLayout->getValue() == sf::Vector2f(20, 30));
+            REQUIRE(rootNode->propertyValuePairs["textsize"]->parsedLayout == nullptr);
+            REQUIRE(rootNode->propertyValuePairs["textsize"]->parsedValue.getType() == tgui::ObjectConverter::Type::Number);
+            REQUIRE(rootNode->propertyValuePairs["textsize"]->parsedValue.getNumber() == 13);
+
+            auto& rendererNode = rootNode->children[0];
+            REQUIRE(rendererNode->propertyValuePairs["textcolor"]->parsedValue.getType() == tgui::ObjectConverter::Type::Color);
+            REQUIRE(rendererNode->propertyValuePairs["textcolor"]->parsedValue.getColor() == tgui::Color(10, 20, 30, 40));
+            REQUIRE(rendererNode->propertyValuePairs["borders"]->parsedValue.getType() == tgui::ObjectConverter::Type::Outline);
+            REQUIRE(rendererNode->propertyValuePairs["borders"]->parsedValue.getOutline() == tgui::Outline(1, 2, 3, 4));
+            REQUIRE(rendererNode->propertyValuePairs["opacity"]->parsedValue.getNumber() == 0.5f);
+
+            // Relative outlines are only stored as strings
+            REQUIRE(rendererNode->propertyValuePairs["padding"]->parsedValue.getType() == tgui::ObjectConverter::Type::None);
+        }
+
+        SECTION("Line number in error message")
+        {
+            const std::string input = "Child {\n    Property = Value;\n    Property = ;\n}\n";
+            try
+            {
+                tgui::DataIO::parse(input.data(), input.size());
+                REQUIRE(false);
+            }
+            catch (const tgui::Exception& e)
+            {
+                REQUIRE(std::string(e.what()).find("line 3") != std::string::npos);
+            }
+        }
     }
 
     SECTION("correct input")
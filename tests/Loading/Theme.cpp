@@ -148,6 +148,63 @@ TEST_CASE("[Theme]")
         }
     }
 
+    SECTION("Batched changes")
+    {
+        tgui::Theme theme;
+
+        auto label1 = tgui::Label::create();
+        label1->setRenderer(theme.getRenderer("label"));
+        auto label2 = tgui::Label::create();
+        label2->setRenderer(theme.getRenderer("label"));
+
+        unsigned int changeCount = 0;
+        theme.getRenderer("label")->observers[nullptr] = [&](const std::string&){ changeCount++; };
+
+        theme.beginBatch();
+        theme.beginBatch();
+        tgui::LabelRenderer(theme.getRenderer("label")).setTextColor(sf::Color::Red);
+        tgui::LabelRenderer(theme.getRenderer("label")).setTextColor(sf::Color::Green);
+        tgui::LabelRenderer(theme.getRenderer("label")).setBackgroundColor(sf::Color::Blue);
+        theme.commitBatch();
+        REQUIRE(changeCount == 0);
+        REQUIRE(label1->getSharedRenderer()->getTextColor() == sf::Color::Green);
+
+        // The observers are only called once per changed property when the outermost batch ends
+        theme.commitBatch();
+        REQUIRE(changeCount == 2);
+        REQUIRE(label2->getSharedRenderer()->getTextColor() == sf::Color::Green);
+        REQUIRE(label2->getSharedRenderer()->getBackgroundColor() == sf::Color::Blue);
+
+        tgui::LabelRenderer(theme.getRenderer("label")).setTextColor(sf::Color::Yellow);
+        REQUIRE(changeCount == 3);
+
+        theme.getRenderer("label")->observers.erase(nullptr);
+    }
+
+    SECTION("Destroyed during batch")
+    {
+        std::shared_ptr<tgui::RendererData> buttonRenderer;
+        std::shared_ptr<tgui::RendererData> labelRenderer;
+        unsigned int changeCount = 0;
+
+        REQUIRE_NOTHROW([&]{
+            tgui::Theme theme;
+            buttonRenderer = theme.getRenderer("button");
+            labelRenderer = theme.getRenderer("label");
+            buttonRenderer->observers[nullptr] = [](const std::string&){ throw tgui::Exception{"Observer failed"}; };
+            labelRenderer->observers[nullptr] = [&](const std::string&){ changeCount++; };
+
+            theme.beginBatch();
+            tgui::LabelRenderer(buttonRenderer).setTextColor(sf::Color::Red);
+            tgui::LabelRenderer(labelRenderer).setTextColor(sf::Color::Red);
+        }());
+
+        // The changes are still committed to the renderers after the one whose observer threw
+        REQUIRE(changeCount == 1);
+        REQUIRE(buttonRenderer->batchDepth == 0);
+        REQUIRE(labelRenderer->batchDepth == 0);
+    }
+
     SECTION("setThemeLoader")
     {
         struct CustomThemeLoader : public tgui::BaseThemeLoader
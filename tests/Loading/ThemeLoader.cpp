@@ -24,6 +24,8 @@
 
 #include "Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/Renderers/WidgetRenderer.hpp>
+#include <TGUI/TextureManager.hpp>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -110,6 +112,50 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["listbox"] == "{\nbackgroundcolor = Cyan;\n\nScrollbar {\n    trackcolor = Black;\n}\n}");
     }
 
+    SECTION("load renderer with nested sections")
+    {
+        auto rendererData = loader->loadRenderer("resources/ThemeNested.txt", "ComboBox4");
+        REQUIRE(rendererData->propertyValuePairs.size() == 1);
+        REQUIRE(rendererData->propertyValuePairs["listbox"].getType() == tgui::ObjectConverter::Type::RendererData);
+
+        auto listBoxData = rendererData->propertyValuePairs["listbox"].getRenderer();
+        REQUIRE(listBoxData->propertyValuePairs.size() == 2);
+        REQUIRE(listBoxData->propertyValuePairs["backgroundcolor"].getString() == "Magenta");
+        REQUIRE(listBoxData->propertyValuePairs["scrollbar"].getType() == tgui::ObjectConverter::Type::RendererData);
+
+        auto scrollbarData = listBoxData->propertyValuePairs["scrollbar"].getRenderer();
+        REQUIRE(scrollbarData->propertyValuePairs.size() == 2);
+        REQUIRE(scrollbarData->propertyValuePairs["thumbcolor"].getString() == "Green");
+        REQUIRE(scrollbarData->propertyValuePairs["trackcolor"].getString() == "Red");
+
+        // Every call creates new renderers, so that changing one doesn't affect the others
+        REQUIRE(loader->loadRenderer("resources/ThemeNested.txt", "ComboBox4")->propertyValuePairs["listbox"].getRenderer() != listBoxData);
+
+        REQUIRE_THROWS_AS(loader->loadRenderer("resources/ThemeNested.txt", "NonexistentClassName"), tgui::Exception);
+        REQUIRE(loader->loadRenderer("", "ListBox1")->propertyValuePairs.empty());
+    }
+
+    SECTION("preload images")
+    {
+        REQUIRE(!tgui::DefaultThemeLoader::isImagePreloadingEnabled());
+        tgui::DefaultThemeLoader::setImagePreloadingEnabled(true);
+        REQUIRE(tgui::DefaultThemeLoader::isImagePreloadingEnabled());
+
+        loader->preload("resources/Black.txt");
+
+        const auto timings = tgui::DefaultThemeLoader::getLoadTimings("resources/Black.txt");
+        REQUIRE(timings.images == 1);
+        REQUIRE(timings.parseTime > sf::Time::Zero);
+
+        // The texture takes the image that was decoded in the background
+        const auto statistics = tgui::TextureManager::getStatistics();
+        tgui::Texture texture{"resources/Black.png", {0, 0, 10, 10}};
+        REQUIRE(tgui::TextureManager::getStatistics().misses == statistics.misses + 1);
+
+        tgui::DefaultThemeLoader::setImagePreloadingEnabled(false);
+        REQUIRE(tgui::DefaultThemeLoader::getLoadTimings("resources/nonexistent.txt").parseTime == sf::Time::Zero);
+    }
+
     SECTION("cache")
     {
         REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
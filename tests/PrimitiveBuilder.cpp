@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/PrimitiveBuilder.hpp>
+
+TEST_CASE("[PrimitiveBuilder]")
+{
+    std::vector<sf::Vertex> vertices;
+
+    SECTION("Rectangle")
+    {
+        tgui::PrimitiveBuilder::addRectangle(vertices, {10, 20}, {30, 40}, sf::Color::Red);
+        REQUIRE(vertices.size() == 6);
+        REQUIRE(vertices[0].position == sf::Vector2f(10, 20));
+        REQUIRE(vertices[5].position == sf::Vector2f(40, 60));
+        REQUIRE(vertices[3].color == sf::Color::Red);
+
+        // Empty rectangles don't add any vertices
+        tgui::PrimitiveBuilder::addRectangle(vertices, {0, 0}, {0, 10}, sf::Color::Red);
+        REQUIRE(vertices.size() == 6);
+    }
+
+    SECTION("Borders")
+    {
+        tgui::PrimitiveBuilder::addBorders(vertices, {0, 0}, {100, 50}, {1, 2, 3, 4}, sf::Color::Blue);
+        REQUIRE(vertices.size() == 24);
+
+        // When the borders fill the entire size then only a single rectangle is added
+        vertices.clear();
+        tgui::PrimitiveBuilder::addBorders(vertices, {0, 0}, {3, 50}, {2}, sf::Color::Blue);
+        REQUIRE(vertices.size() == 6);
+    }
+
+    SECTION("Triangle")
+    {
+        tgui::PrimitiveBuilder::addTriangle(vertices, {0, 0}, {10, 0}, {5, 10}, sf::Color::Green);
+        REQUIRE(vertices.size() == 3);
+        REQUIRE(vertices[2].position == sf::Vector2f(5, 10));
+    }
+
+    SECTION("Circle")
+    {
+        tgui::PrimitiveBuilder::addCircle(vertices, {50, 50}, 10, sf::Color::White, 30);
+        REQUIRE(vertices.size() == 30 * 3);
+
+        // The first triangle starts at the top of the circle
+        REQUIRE(vertices[0].position == sf::Vector2f(50, 50));
+        REQUIRE(vertices[1].position.x == Approx(50));
+        REQUIRE(vertices[1].position.y == Approx(40));
+    }
+
+    SECTION("Ring")
+    {
+        tgui::PrimitiveBuilder::addRing(vertices, {0, 0}, 8, 10, sf::Color::White, 20);
+        REQUIRE(vertices.size() == 20 * 6);
+
+        // The inner radius has to be smaller than the outer radius
+        vertices.clear();
+        tgui::PrimitiveBuilder::addRing(vertices, {0, 0}, 10, 10, sf::Color::White);
+        REQUIRE(vertices.empty());
+    }
+
+    SECTION("Arc")
+    {
+        tgui::PrimitiveBuilder::addArc(vertices, {0, 0}, 0, 10, 0, 90, sf::Color::White, 40);
+        REQUIRE(vertices.size() == 10 * 3);
+
+        // The arc may cross the 0 degree angle
+        vertices.clear();
+        tgui::PrimitiveBuilder::addArc(vertices, {0, 0}, 5, 10, 315, 45, sf::Color::White, 40);
+        REQUIRE(vertices.size() == 10 * 6);
+    }
+}
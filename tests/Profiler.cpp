@@ -0,0 +1,100 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/Profiler.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <sstream>
+
+TEST_CASE("[Profiler]")
+{
+    SECTION("Enabled")
+    {
+        REQUIRE(!tgui::Profiler::isEnabled());
+
+        tgui::Profiler::setEnabled(true);
+        REQUIRE(tgui::Profiler::isEnabled() == tgui::Profiler::isAvailable());
+
+        tgui::Profiler::setEnabled(false);
+        REQUIRE(!tgui::Profiler::isEnabled());
+    }
+
+    SECTION("Category names")
+    {
+        REQUIRE(std::string(tgui::Profiler::getCategoryName(tgui::Profiler::Category::Draw)) == "draw");
+        REQUIRE(std::string(tgui::Profiler::getCategoryName(tgui::Profiler::Category::Event)) == "event");
+        REQUIRE(std::string(tgui::Profiler::getCategoryName(tgui::Profiler::Category::Layout)) == "layout");
+    }
+
+    if (tgui::Profiler::isAvailable())
+    {
+        SECTION("Frame statistics")
+        {
+            sf::RenderTexture target;
+            target.create(200, 100);
+            tgui::Gui gui{target};
+
+            auto panel = tgui::Panel::create({150, 80});
+            gui.add(panel, "Background");
+            panel->add(tgui::Button::create("Ok"), "OkButton");
+
+            tgui::Profiler::setEnabled(true);
+            tgui::Profiler::addAllocation();
+            gui.draw();
+
+            const tgui::Profiler::FrameStatistics& frame = tgui::Profiler::getLastFrame();
+            REQUIRE(frame.frame == 0);
+            REQUIRE(frame.drawCalls == gui.getDrawStatistics().drawCalls);
+            REQUIRE(frame.clippingScopes > 0);
+            REQUIRE(frame.allocations >= 1);
+
+            const auto findScope = [&](const std::string& label) {
+                return std::find_if(frame.scopes.begin(), frame.scopes.end(), [&](const tgui::Profiler::ScopeStatistics& scope){
+                    return (scope.category == tgui::Profiler::Category::Draw) && (scope.label == label);
+                });
+            };
+
+            const auto panelScope = findScope("Panel \"Background\"");
+            const auto buttonScope = findScope("Button \"OkButton\"");
+            REQUIRE(panelScope != frame.scopes.end());
+            REQUIRE(buttonScope != frame.scopes.end());
+            REQUIRE(buttonScope->calls == 1);
+            REQUIRE(panelScope->time >= buttonScope->time);
+
+            gui.draw();
+            REQUIRE(tgui::Profiler::getLastFrame().frame == 1);
+
+            std::stringstream trace;
+            tgui::Profiler::writeTrace(trace);
+            REQUIRE(trace.str().find("\"traceEvents\"") != std::string::npos);
+            REQUIRE(trace.str().find("\"name\":\"Button \\\"OkButton\\\"\",\"cat\":\"draw\",\"ph\":\"X\"") != std::string::npos);
+            REQUIRE(trace.str().find("\"ph\":\"C\"") != std::string::npos);
+
+            tgui::Profiler::setEnabled(false);
+            gui.draw();
+            REQUIRE(tgui::Profiler::getLastFrame().frame == 1);
+        }
+    }
+}
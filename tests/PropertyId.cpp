@@ -0,0 +1,66 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#include "Tests.hpp"
+#include <TGUI/PropertyId.hpp>
+#include <unordered_set>
+
+TEST_CASE("[PropertyId]")
+{
+    SECTION("Built-in properties")
+    {
+        REQUIRE(tgui::PropertyId(tgui::PropertyId::BackgroundColor).getName() == "backgroundcolor");
+        REQUIRE(tgui::PropertyId(tgui::PropertyId::TransparentTexture).getName() == "transparenttexture");
+        REQUIRE(tgui::PropertyId(tgui::PropertyId::Font).getIndex() < tgui::PropertyId::BuiltinCount);
+
+        REQUIRE(tgui::PropertyId("opacity") == tgui::PropertyId::Opacity);
+        REQUIRE(tgui::PropertyId(std::string{"textcolor"}) == tgui::PropertyId::TextColor);
+        REQUIRE(tgui::PropertyId("textcolor") != tgui::PropertyId::TextColorHover);
+    }
+
+    SECTION("Interning")
+    {
+        const tgui::PropertyId id1{"CustomProperty"};
+        const tgui::PropertyId id2{std::string{"Custom"} + "Property"};
+        REQUIRE(id1 == id2);
+        REQUIRE(id1.getIndex() >= tgui::PropertyId::BuiltinCount);
+
+        // Names are stored as given
+        REQUIRE(id1.getName() == "CustomProperty");
+        REQUIRE(tgui::PropertyId("customproperty") != id1);
+
+        const std::string& name = id1;
+        REQUIRE(&name == &id2.getName());
+    }
+
+    SECTION("Hashing")
+    {
+        std::unordered_set<tgui::PropertyId> ids;
+        ids.insert(tgui::PropertyId::Borders);
+        ids.insert("borders");
+        ids.insert("unknownproperty");
+        REQUIRE(ids.size() == 2);
+        REQUIRE(ids.count(tgui::PropertyId::Borders) == 1);
+        REQUIRE(ids.count(tgui::PropertyId::Padding) == 0);
+    }
+}
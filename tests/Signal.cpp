@@ -141,4 +141,50 @@ TEST_CASE("[Signal]")
         widget->setSize(400, 100);
         REQUIRE(i == 4);
     }
+
+    SECTION("Connecting and disconnecting while emitting")
+    {
+        unsigned int i = 0;
+        unsigned int j = 0;
+
+        unsigned int id = 0;
+        id = widget->connect("PositionChanged", [&](){ i++; widget->disconnect(id); });
+        widget->connect("PositionChanged", [&](){ widget->connect("PositionChanged", [&](){ j++; }); });
+        widget->setPosition(10, 10);
+        REQUIRE(i == 1);
+        REQUIRE(j == 0); // Handlers connected while emitting are only called on the next emit
+
+        widget->setPosition(20, 20);
+        REQUIRE(i == 1);
+        REQUIRE(j == 1);
+
+        widget->disconnectAll("PositionChanged");
+        widget->connect("PositionChanged", [&](){ i++; widget->disconnectAll("PositionChanged"); });
+        widget->connect("PositionChanged", [&](){ i++; });
+        widget->setPosition(30, 30);
+        widget->setPosition(40, 40);
+        REQUIRE(i == 2);
+
+        // Recursively emitting the same signal still calls the handlers again
+        widget->connect("PositionChanged", [&](){ if (++i < 5) widget->setPosition(widget->getPosition().x + 1, 0); });
+        widget->setPosition(50, 50);
+        REQUIRE(i == 5);
+        REQUIRE(widget->getPosition() == sf::Vector2f(52, 0));
+    }
+
+    SECTION("Destroying the signal while emitting")
+    {
+        unsigned int i = 0;
+        auto signal = std::make_unique<tgui::Signal>("Test");
+        tgui::Signal* rawSignal = signal.get();
+        signal->connect([&, text=std::string("captured value")](){
+            signal = nullptr;
+            REQUIRE(text == "captured value"); // The handler itself is still alive
+            i++;
+        });
+        signal->connect([&](){ i++; });
+        REQUIRE(rawSignal->emit(widget.get()));
+        REQUIRE(signal == nullptr);
+        REQUIRE(i == 1);
+    }
 }
@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2018 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/SpatialIndex.hpp>
+#include <TGUI/Widgets/ClickableWidget.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[SpatialIndex]")
+{
+    SECTION("Query")
+    {
+        auto widget1 = tgui::Panel::create();
+        auto widget2 = tgui::Panel::create();
+        auto widget3 = tgui::Panel::create();
+
+        tgui::SpatialIndex index{10};
+        index.insert(widget1.get(), 0, {0, 0, 20, 20});
+        index.insert(widget2.get(), 1, {15, 15, 20, 20});
+        index.insert(widget3.get(), 2, {-1000, -1000, 5000, 5000}); // Covers too many cells to be stored in them
+        REQUIRE(index.getSize() == 3);
+        REQUIRE(index.contains(widget2.get()));
+
+        REQUIRE(index.query({5, 5}) == std::vector<tgui::Widget*>{widget3.get(), widget1.get()});
+        REQUIRE(index.query({17, 17}) == std::vector<tgui::Widget*>{widget3.get(), widget2.get(), widget1.get()});
+        REQUIRE(index.query({5000, 5000}).empty());
+
+        index.update(widget2.get(), {100, 100, 10, 10});
+        REQUIRE(index.query({17, 17}) == std::vector<tgui::Widget*>{widget3.get(), widget1.get()});
+        REQUIRE(index.query({105, 105}) == std::vector<tgui::Widget*>{widget3.get(), widget2.get()});
+
+        index.setOrder(widget1.get(), 3);
+        REQUIRE(index.query({5, 5}) == std::vector<tgui::Widget*>{widget1.get(), widget3.get()});
+
+        index.remove(widget3.get());
+        REQUIRE(!index.contains(widget3.get()));
+        REQUIRE(index.query({5, 5}) == std::vector<tgui::Widget*>{widget1.get()});
+
+        index.clear();
+        REQUIRE(index.getSize() == 0);
+        REQUIRE(index.query({5, 5}).empty());
+    }
+
+    SECTION("Container")
+    {
+        sf::RenderTexture target;
+        target.create(200, 200);
+        tgui::Gui gui{target};
+
+        REQUIRE(!gui.getContainer()->isSpatialIndexEnabled());
+        gui.getContainer()->setSpatialIndexEnabled(true);
+        REQUIRE(gui.getContainer()->isSpatialIndexEnabled());
+
+        int pressedWidget = -1;
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({15, 15});
+            widget->setPosition({(i % 10) * 20.f, (i / 10) * 20.f});
+            widget->connect("MousePressed", [&pressedWidget,i]{ pressedWidget = static_cast<int>(i); });
+            gui.add(widget);
+            widgets.push_back(widget);
+        }
+
+        auto pressAt = [&](int x, int y)
+            {
+                pressedWidget = -1;
+
+                sf::Event event;
+                event.type = sf::Event::MouseButtonPressed;
+                event.mouseButton = sf::Event::MouseButtonEvent();
+                event.mouseButton.button = sf::Mouse::Left;
+                event.mouseButton.x = x;
+                event.mouseButton.y = y;
+                gui.handleEvent(event);
+
+                event.type = sf::Event::MouseButtonReleased;
+                gui.handleEvent(event);
+                return pressedWidget;
+            };
+
+        REQUIRE(pressAt(5, 5) == 0);
+        REQUIRE(pressAt(25, 45) == 21);
+        REQUIRE(pressAt(17, 5) == -1);
+
+        widgets[0]->setPosition({20, 40});
+        REQUIRE(pressAt(5, 5) == -1);
+        REQUIRE(pressAt(25, 45) == 21);
+
+        widgets[0]->moveToFront();
+        REQUIRE(pressAt(25, 45) == 0);
+
+        widgets[0]->moveToBack();
+        REQUIRE(pressAt(25, 45) == 21);
+
+        widgets[21]->setVisible(false);
+        REQUIRE(pressAt(25, 45) == 0);
+
+        gui.remove(widgets[0]);
+        REQUIRE(pressAt(25, 45) == -1);
+
+        widgets[5]->setSize({100, 100});
+        REQUIRE(pressAt(150, 50) == 27);
+        REQUIRE(pressAt(158, 38) == 5);
+
+        gui.getContainer()->setSpatialIndexEnabled(false);
+        REQUIRE(pressAt(158, 38) == 5);
+    }
+}
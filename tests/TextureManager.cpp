@@ -52,4 +52,159 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    SECTION("Statistics")
+    {
+        tgui::TextureManager::resetStatistics();
+        const auto texturesBefore = tgui::TextureManager::getStatistics().textures;
+        const auto bytesBefore = tgui::TextureManager::getStatistics().bytesResident;
+
+        tgui::Texture texture3;
+        tgui::Texture texture4;
+        auto textureData3 = tgui::TextureManager::getTexture(texture3, "resources/image.png", {0, 0, 10, 10});
+        auto textureData4 = tgui::TextureManager::getTexture(texture4, "resources/image.png", {0, 0, 10, 10});
+        REQUIRE(textureData3 == textureData4);
+
+        auto stats = tgui::TextureManager::getStatistics();
+        REQUIRE(stats.hits == 1);
+        REQUIRE(stats.misses == 1);
+        REQUIRE(stats.textures == texturesBefore + 1);
+        REQUIRE(stats.bytesResident > bytesBefore);
+
+        tgui::TextureManager::removeTexture(textureData3);
+        tgui::TextureManager::removeTexture(textureData4);
+
+        stats = tgui::TextureManager::getStatistics();
+        REQUIRE(stats.textures == texturesBefore);
+        REQUIRE(stats.bytesResident == bytesBefore);
+
+        tgui::TextureManager::resetStatistics();
+        REQUIRE(tgui::TextureManager::getStatistics().hits == 0);
+        REQUIRE(tgui::TextureManager::getStatistics().misses == 0);
+    }
+
+    SECTION("Parts of the same image")
+    {
+        tgui::Texture texture3{"resources/image.png", {0, 0, 10, 10}};
+        tgui::Texture texture4{"resources/image.png", {10, 10, 10, 10}};
+        REQUIRE(texture3.getData() != texture4.getData());
+        REQUIRE(texture3.getData()->image == texture4.getData()->image);
+    }
+
+    SECTION("Preloading images")
+    {
+        tgui::TextureManager::resetStatistics();
+        const auto bytesBefore = tgui::TextureManager::getStatistics().bytesResident;
+
+        auto finished = tgui::TextureManager::preloadImages({"resources/Texture7.png", "resources/Texture8.png", "resources/Texture7.png"});
+        REQUIRE(finished.get() > sf::Time::Zero);
+
+        // Images that are still waiting to be used don't count as resident yet
+        REQUIRE(tgui::TextureManager::getStatistics().bytesResident == bytesBefore);
+
+        {
+            tgui::Texture texture7{"resources/Texture7.png"};
+            tgui::Texture texture8{"resources/Texture8.png"};
+            REQUIRE(texture7.getImageSize() != sf::Vector2f(0, 0));
+            REQUIRE(tgui::TextureManager::getStatistics().misses == 2);
+            REQUIRE(tgui::TextureManager::getStatistics().bytesResident > bytesBefore);
+
+            // Images that are already loaded are not decoded again
+            REQUIRE(tgui::TextureManager::preloadImages({"resources/Texture7.png"}).get() == sf::Time::Zero);
+        }
+
+        REQUIRE(tgui::TextureManager::getStatistics().bytesResident == bytesBefore);
+
+        // Images that are still waiting for a texture are not decoded again, until they are removed
+        REQUIRE(tgui::TextureManager::preloadImages({"resources/Texture7.png"}).get() > sf::Time::Zero);
+        REQUIRE(tgui::TextureManager::preloadImages({"resources/Texture7.png"}).get() == sf::Time::Zero);
+        tgui::TextureManager::removePreloadedImages({"resources/Texture7.png"});
+        REQUIRE(tgui::TextureManager::preloadImages({"resources/Texture7.png"}).get() > sf::Time::Zero);
+        tgui::TextureManager::removePreloadedImages({"resources/Texture7.png"});
+    }
+
+    SECTION("Async loading")
+    {
+        REQUIRE(!tgui::TextureManager::isAsyncLoadingEnabled());
+        tgui::TextureManager::setAsyncLoadingEnabled(true);
+        REQUIRE(tgui::TextureManager::isAsyncLoadingEnabled());
+
+        REQUIRE(tgui::TextureManager::getAsyncQueueCapacity() == 8);
+        tgui::TextureManager::setAsyncQueueCapacity(2);
+        REQUIRE(tgui::TextureManager::getAsyncQueueCapacity() == 2);
+
+        unsigned int finishedCount = 0;
+        const unsigned int id = tgui::TextureManager::onAsyncLoadFinished.connect([&]{ ++finishedCount; });
+
+        {
+            tgui::Texture texture7{"resources/Texture7.png"};
+            tgui::Texture texture8{"resources/Texture7.png", {0, 0, 10, 10}};
+            tgui::TextureManager::setAsyncLoadingEnabled(false);
+
+            // The data stays empty until the image is uploaded
+            REQUIRE(texture7.getData()->loading);
+            REQUIRE(texture8.getData()->loading);
+            REQUIRE(texture7.getImageSize() == sf::Vector2f(0, 0));
+            REQUIRE(tgui::TextureManager::getPendingAsyncLoads() == 1);
+
+            const auto finishedBefore = tgui::TextureManager::getFinishedAsyncLoadCount();
+            for (unsigned int i = 0; (i < 5000) && (tgui::TextureManager::getPendingAsyncLoads() > 0); ++i)
+            {
+                tgui::TextureManager::processAsyncLoads(sf::Time::Zero);
+                sf::sleep(sf::milliseconds(1));
+            }
+
+            REQUIRE(tgui::TextureManager::getPendingAsyncLoads() == 0);
+            REQUIRE(tgui::TextureManager::getFinishedAsyncLoadCount() == finishedBefore + 1);
+            REQUIRE(finishedCount == 1);
+
+            REQUIRE(!texture7.getData()->loading);
+            REQUIRE(texture7.getImageSize() != sf::Vector2f(0, 0));
+            REQUIRE(texture7.getMiddleRect() == sf::IntRect(0, 0, static_cast<int>(texture7.getImageSize().x), static_cast<int>(texture7.getImageSize().y)));
+            REQUIRE(texture8.getImageSize() == sf::Vector2f(10, 10));
+            REQUIRE(texture7.getData()->image == texture8.getData()->image);
+        }
+
+        tgui::TextureManager::onAsyncLoadFinished.disconnect(id);
+        tgui::TextureManager::setAsyncQueueCapacity(8);
+    }
+
+    SECTION("Texture atlas")
+    {
+        REQUIRE(!tgui::TextureManager::isAtlasEnabled());
+        tgui::TextureManager::setAtlasEnabled(true);
+        REQUIRE(tgui::TextureManager::isAtlasEnabled());
+
+        const auto pagesBefore = tgui::TextureManager::getStatistics().atlasPages;
+        const auto textureBytesBefore = tgui::TextureManager::getStatistics().textureBytes;
+        {
+            tgui::Texture texture5{"resources/image.png", {10, 10, 20, 20}};
+            tgui::Texture texture6{"resources/image.png", {0, 0, 30, 30}};
+            tgui::TextureManager::setAtlasEnabled(false);
+
+            REQUIRE(texture5.getData()->atlasPage != nullptr);
+            REQUIRE(texture5.getData()->atlasPage == texture6.getData()->atlasPage);
+            REQUIRE(texture5.getData()->atlasPosition != texture6.getData()->atlasPosition);
+            REQUIRE(texture5.getData()->texture.getSize() == sf::Vector2u(0, 0));
+            REQUIRE(texture5.getImageSize() == sf::Vector2f(20, 20));
+            REQUIRE(texture5.getMiddleRect() == sf::IntRect(0, 0, 20, 20));
+            REQUIRE(texture5.isTransparentPixel({5, 5}) == texture6.isTransparentPixel({15, 15}));
+            REQUIRE(!texture5.isSmooth());
+
+            auto stats = tgui::TextureManager::getStatistics();
+            REQUIRE(stats.atlasPages == pagesBefore + 1);
+            REQUIRE(stats.textureBytes > textureBytesBefore);
+            REQUIRE(stats.textureBytesWithoutAtlas > 0);
+
+            // Smoothing requires the texture to be taken out of the atlas
+            texture5.setSmooth(true);
+            REQUIRE(texture5.isSmooth());
+            REQUIRE(texture5.getData()->atlasPage == nullptr);
+            REQUIRE(texture5.getData()->texture.getSize() == sf::Vector2u(20, 20));
+            REQUIRE(texture6.getData()->atlasPage != nullptr);
+        }
+
+        REQUIRE(tgui::TextureManager::getStatistics().atlasPages == pagesBefore);
+        REQUIRE(tgui::TextureManager::getStatistics().textureBytes == textureBytesBefore);
+    }
 }
@@ -26,6 +26,7 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Widgets/Button.hpp>
 
 TEST_CASE("[Widget]")
 {
@@ -277,6 +278,74 @@ TEST_CASE("[Widget]")
             REQUIRE(clonedRenderer->propertyValuePairs["font"].getFont().getId() == "resources/DejaVuSans.ttf");
         }
 
+        SECTION("Only changed properties are updated when switching renderer")
+        {
+            // The widget would throw if it were told about this property
+            renderer->getData()->propertyValuePairs["nonexistentproperty"] = tgui::ObjectConverter{sf::String{"Text"}};
+
+            auto newRenderer = renderer->clone();
+            newRenderer->propertyValuePairs["opacity"] = tgui::ObjectConverter{0.7f};
+            REQUIRE_NOTHROW(widget->setRenderer(newRenderer));
+            REQUIRE(widget->getRenderer()->getOpacity() == 0.7f);
+
+            auto otherRenderer = widget->getRenderer()->clone();
+            otherRenderer->propertyValuePairs["nonexistentproperty"] = tgui::ObjectConverter{sf::String{"Other text"}};
+            REQUIRE_THROWS_AS(widget->setRenderer(otherRenderer), tgui::Exception);
+        }
+
+        SECTION("Renderer changes are passed as property ids")
+        {
+            struct IdButton : public tgui::Button
+            {
+                void rendererChanged(tgui::PropertyId property) override
+                {
+                    properties.push_back(property);
+                    tgui::Button::rendererChanged(property);
+                }
+                using tgui::Button::rendererChanged;
+
+                std::vector<tgui::PropertyId> properties;
+            };
+
+            struct StringButton : public tgui::Button
+            {
+                void rendererChanged(const std::string& property) override
+                {
+                    properties.push_back(property);
+                    if (property != "customproperty")
+                        tgui::Button::rendererChanged(property);
+                }
+                using tgui::Button::rendererChanged;
+
+                std::vector<std::string> properties;
+            };
+
+            IdButton idButton;
+            idButton.properties.clear();
+            idButton.getRenderer()->setTextColor(sf::Color::Red);
+            REQUIRE(idButton.properties.size() == 1);
+            REQUIRE(idButton.properties[0] == tgui::PropertyId::TextColor);
+
+            // Properties are passed in alphabetical order when switching renderer
+            idButton.properties.clear();
+            idButton.setRenderer(tgui::RendererData::create({{"textcolor", {sf::Color::Green}},
+                                                             {"bordercolor", {sf::Color::Blue}},
+                                                             {"backgroundcolor", {sf::Color::Yellow}}}));
+            REQUIRE(idButton.properties.size() >= 3);
+            REQUIRE(std::is_sorted(idButton.properties.begin(), idButton.properties.end(),
+                                   [](tgui::PropertyId left, tgui::PropertyId right){ return left.getName() < right.getName(); }));
+
+            // The version that takes a string is only called for properties that the widget doesn't handle itself
+            StringButton stringButton;
+            stringButton.properties.clear();
+            stringButton.getRenderer()->setTextColor(sf::Color::Red);
+            REQUIRE(stringButton.properties.empty());
+
+            REQUIRE_NOTHROW(stringButton.getRenderer()->setProperty("CustomProperty", "Text"));
+            REQUIRE(stringButton.properties.size() == 1);
+            REQUIRE(stringButton.properties[0] == "customproperty");
+        }
+
         // TODO: Other tests with the renderer class (e.g. sharing and copying a renderer when using multiple widgets)
     }
 
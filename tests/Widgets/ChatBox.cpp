@@ -126,6 +126,45 @@ TEST_CASE("[ChatBox]")
         }
     }
 
+    SECTION("Many lines")
+    {
+        chatBox->setSize(150, 100);
+        chatBox->setLineLimit(100);
+
+        SECTION("Oldest on top")
+        {
+            for (unsigned int i = 0; i < 1000; ++i)
+                chatBox->addLine("Line " + tgui::to_string(i) + " that is long enough to be word wrapped");
+
+            REQUIRE(chatBox->getLineAmount() == 100);
+            REQUIRE(chatBox->getLine(0) == "Line 900 that is long enough to be word wrapped");
+            REQUIRE(chatBox->getLine(99) == "Line 999 that is long enough to be word wrapped");
+        }
+
+        SECTION("Oldest at the bottom")
+        {
+            chatBox->setNewLinesBelowOthers(false);
+            for (unsigned int i = 0; i < 1000; ++i)
+                chatBox->addLine("Line " + tgui::to_string(i));
+
+            REQUIRE(chatBox->getLineAmount() == 100);
+            REQUIRE(chatBox->getLine(0) == "Line 999");
+            REQUIRE(chatBox->getLine(99) == "Line 900");
+        }
+
+        REQUIRE(chatBox->removeLine(50));
+        REQUIRE(chatBox->removeLine(98));
+        REQUIRE(chatBox->removeLine(0));
+        REQUIRE(chatBox->getLineAmount() == 97);
+
+        // Scrolling to the top wraps the lines that become visible
+        for (unsigned int i = 0; i < 500; ++i)
+            chatBox->mouseWheelScrolled(1, {10, 10});
+
+        chatBox->setSize(300, 100);
+        REQUIRE(chatBox->getLineAmount() == 97);
+    }
+
     SECTION("Text size")
     {
         chatBox->setTextSize(30);
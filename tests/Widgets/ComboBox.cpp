@@ -27,6 +27,25 @@
 #include <TGUI/Widgets/ComboBox.hpp>
 #include <TGUI/Widgets/Group.hpp>
 
+namespace
+{
+    class StringProvider : public tgui::ItemProvider
+    {
+    public:
+        std::size_t getItemCount() const override
+        {
+            return strings.size();
+        }
+
+        sf::String getItem(std::size_t index) const override
+        {
+            return strings[index];
+        }
+
+        std::vector<sf::String> strings;
+    };
+}
+
 TEST_CASE("[ComboBox]")
 {
     tgui::ComboBox::Ptr comboBox = tgui::ComboBox::create();
@@ -197,6 +216,42 @@ TEST_CASE("[ComboBox]")
         REQUIRE(comboBox->getSelectedItemIndex() == -1);
     }
 
+    SECTION("Item provider")
+    {
+        auto provider = std::make_shared<StringProvider>();
+        provider->strings = {"Item 1", "Item 2", "Item 3"};
+
+        comboBox->setItemProvider(provider);
+        REQUIRE(comboBox->getItemProvider() == provider);
+        REQUIRE(comboBox->getItemCount() == 3);
+        REQUIRE(comboBox->getItems() == provider->strings);
+        REQUIRE(!comboBox->addItem("Item 4"));
+
+        REQUIRE(comboBox->setSelectedItemByIndex(1));
+        REQUIRE(comboBox->getSelectedItem() == "Item 2");
+
+        provider->strings[1] = "Changed";
+        provider->itemsChanged(1, 1);
+        REQUIRE(comboBox->getSelectedItem() == "Changed");
+
+        // A copy has its own connection with the provider
+        auto comboBoxCopy = tgui::ComboBox::copy(comboBox);
+        provider->strings.erase(provider->strings.begin() + 1);
+        provider->itemsRemoved(1, 1);
+        REQUIRE(comboBox->getSelectedItemIndex() == -1);
+        REQUIRE(comboBoxCopy->getSelectedItemIndex() == -1);
+        REQUIRE(comboBoxCopy->getItemCount() == 2);
+
+        comboBoxCopy = nullptr;
+        provider->strings.push_back("Item 4");
+        provider->itemsInserted(2, 1);
+        REQUIRE(comboBox->getItemCount() == 3);
+
+        comboBox->setItemProvider(nullptr);
+        REQUIRE(comboBox->getItemCount() == 0);
+        REQUIRE(comboBox->addItem("Item 4"));
+    }
+
     SECTION("Contains")
     {
         REQUIRE(!comboBox->contains("Item 1"));
@@ -26,6 +26,32 @@
 #include <TGUI/Widgets/ListBox.hpp>
 #include <TGUI/Widgets/Group.hpp>
 
+namespace
+{
+    class NumberProvider : public tgui::ItemProvider
+    {
+    public:
+        std::size_t getItemCount() const override
+        {
+            return numbers.size();
+        }
+
+        sf::String getItem(std::size_t index) const override
+        {
+            ++requestedItems;
+            return "Item " + tgui::to_string(numbers[index]);
+        }
+
+        sf::String getItemId(std::size_t index) const override
+        {
+            return tgui::to_string(numbers[index]);
+        }
+
+        std::vector<int> numbers;
+        mutable std::size_t requestedItems = 0;
+    };
+}
+
 TEST_CASE("[ListBox]")
 {
     tgui::ListBox::Ptr listBox = tgui::ListBox::create();
@@ -229,6 +255,173 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getSelectedItemIndex() == -1);
     }
 
+    SECTION("Many items")
+    {
+        for (unsigned int i = 0; i < 10000; ++i)
+            listBox->addItem("Item " + tgui::to_string(i), tgui::to_string(i));
+
+        REQUIRE(listBox->getItemCount() == 10000);
+        REQUIRE(listBox->getItemById("9999") == "Item 9999");
+        REQUIRE(listBox->setSelectedItemById("5000"));
+        REQUIRE(listBox->getSelectedItemIndex() == 5000);
+
+        // Looking up ids still works after the indices of the items changed
+        REQUIRE(listBox->removeItemById("0"));
+        REQUIRE(listBox->getSelectedItemIndex() == 4999);
+        REQUIRE(!listBox->containsId("0"));
+        REQUIRE(listBox->getItemById("5000") == "Item 5000");
+        REQUIRE(listBox->setSelectedItemById("1"));
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+
+        // Items that are added after a lookup can be found as well
+        listBox->addItem("Extra", "extra");
+        REQUIRE(listBox->getItemById("extra") == "Extra");
+
+        listBox->removeAllItems();
+        REQUIRE(!listBox->containsId("1"));
+    }
+
+    SECTION("Duplicate ids")
+    {
+        listBox->addItem("Item 1", "id");
+        listBox->addItem("Item 2", "id");
+        listBox->addItem(L"\u20AC", "euro");
+
+        REQUIRE(listBox->getItemById("id") == "Item 1");
+        REQUIRE(listBox->removeItemById("id"));
+        REQUIRE(listBox->getItemById("id") == "Item 2");
+
+        REQUIRE(listBox->getItemById("euro") == L"\u20AC");
+        REQUIRE(listBox->contains(L"\u20AC"));
+    }
+
+    SECTION("Item provider")
+    {
+        listBox->addItem("Own item");
+
+        auto provider = std::make_shared<NumberProvider>();
+        for (int i = 0; i < 200000; ++i)
+            provider->numbers.push_back(i);
+
+        listBox->setItemProvider(provider);
+        REQUIRE(listBox->getItemProvider() == provider);
+        REQUIRE(listBox->getItemCount() == 200000);
+        REQUIRE(listBox->getItemByIndex(1234) == "Item 1234");
+        REQUIRE(listBox->getIdByIndex(1234) == "1234");
+        REQUIRE(listBox->getItemByIndex(200000) == "");
+        REQUIRE(listBox->getItemById("150000") == "Item 150000");
+        REQUIRE(listBox->contains("Item 5"));
+        REQUIRE(!listBox->contains("Own item"));
+
+        // The items can only be changed through the provider
+        REQUIRE(!listBox->addItem("New item"));
+        REQUIRE(!listBox->removeItemByIndex(0));
+        REQUIRE(!listBox->changeItemByIndex(0, "Changed"));
+        REQUIRE(listBox->getItemCount() == 200000);
+
+        // Only the visible items are requested when drawing
+        listBox->setSize(200, 100);
+        listBox->setItemHeight(20);
+        {
+            TEST_DRAW_INIT(200, 100, listBox)
+            provider->requestedItems = 0;
+            gui.draw();
+            REQUIRE(provider->requestedItems > 0);
+            REQUIRE(provider->requestedItems <= 6);
+            gui.remove(listBox);
+        }
+
+        REQUIRE(listBox->setSelectedItemByIndex(10));
+
+        // Inserting items in front of the selected item moves the selection
+        provider->numbers.insert(provider->numbers.begin(), {-2, -1});
+        provider->itemsInserted(0, 2);
+        REQUIRE(listBox->getItemCount() == 200002);
+        REQUIRE(listBox->getSelectedItemIndex() == 12);
+        REQUIRE(listBox->getSelectedItem() == "Item 10");
+
+        // Ids are found at their new position
+        REQUIRE(listBox->setSelectedItemById("-1"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+        REQUIRE(listBox->setSelectedItemById("10"));
+        REQUIRE(listBox->getSelectedItemIndex() == 12);
+
+        // Changing the text is visible immediately
+        provider->numbers[12] = 42;
+        provider->itemsChanged(12, 1);
+        REQUIRE(listBox->getSelectedItem() == "Item 42");
+
+        // Removing items in front of the selected item moves the selection
+        provider->numbers.erase(provider->numbers.begin(), provider->numbers.begin() + 2);
+        provider->itemsRemoved(0, 2);
+        REQUIRE(listBox->getSelectedItemIndex() == 10);
+
+        // Removing the selected item deselects it
+        unsigned int itemSelectedCount = 0;
+        listBox->connect("ItemSelected", [&]{ ++itemSelectedCount; });
+        provider->numbers.erase(provider->numbers.begin() + 5, provider->numbers.begin() + 15);
+        provider->itemsRemoved(5, 10);
+        REQUIRE(listBox->getSelectedItemIndex() == -1);
+        REQUIRE(itemSelectedCount == 1);
+
+        // A copy of the list box keeps following the provider
+        REQUIRE(listBox->setSelectedItemByIndex(100));
+        auto listBoxCopy = tgui::ListBox::copy(listBox);
+        provider->numbers.insert(provider->numbers.begin(), 7);
+        provider->itemsInserted(0, 1);
+        REQUIRE(listBox->getSelectedItemIndex() == 101);
+        REQUIRE(listBoxCopy->getSelectedItemIndex() == 101);
+
+        provider->numbers.clear();
+        provider->itemsReset();
+        REQUIRE(listBox->getItemCount() == 0);
+        REQUIRE(listBox->getSelectedItemIndex() == -1);
+        REQUIRE(listBoxCopy->getSelectedItemIndex() == -1);
+
+        listBoxCopy = nullptr;
+        listBox->setItemProvider(nullptr);
+        REQUIRE(listBox->getItemProvider() == nullptr);
+        REQUIRE(listBox->getItemCount() == 0);
+        REQUIRE(listBox->addItem("Own item"));
+    }
+
+    SECTION("Item provider changed while notifying")
+    {
+        auto provider = std::make_shared<NumberProvider>();
+        for (int i = 0; i < 20; ++i)
+            provider->numbers.push_back(i);
+
+        listBox->setItemProvider(provider);
+        REQUIRE(listBox->setSelectedItemByIndex(5));
+
+        auto otherListBox = tgui::ListBox::create();
+        otherListBox->setItemProvider(provider);
+        REQUIRE(otherListBox->setSelectedItemByIndex(5));
+
+        // Losing the selection of the first list box destroys the second one, which is notified after it
+        unsigned int itemSelectedCount = 0;
+        listBox->connect("ItemSelected", [&]{ ++itemSelectedCount; otherListBox = nullptr; });
+        otherListBox->connect("ItemSelected", [&]{ ++itemSelectedCount; });
+
+        provider->numbers.erase(provider->numbers.begin() + 5);
+        provider->itemsRemoved(5, 1);
+        REQUIRE(otherListBox == nullptr);
+        REQUIRE(itemSelectedCount == 1);
+
+        // A list box that disconnects from the provider while being notified no longer receives changes
+        listBox->connect("ItemSelected", [&]{ listBox->setItemProvider(nullptr); });
+        REQUIRE(listBox->setSelectedItemByIndex(3));
+        provider->numbers.erase(provider->numbers.begin() + 3);
+        provider->itemsRemoved(3, 1);
+        REQUIRE(listBox->getItemProvider() == nullptr);
+
+        listBox->addItem("Item");
+        REQUIRE(listBox->setSelectedItemByIndex(0));
+        provider->numbers.clear();
+        provider->itemsReset();
+        REQUIRE(listBox->getSelectedItemIndex() == 0);
+    }
+
     SECTION("Contains")
     {
         REQUIRE(!listBox->contains("Item 1"));
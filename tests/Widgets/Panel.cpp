@@ -241,6 +241,21 @@ TEST_CASE("[Panel]")
             REQUIRE(compareFiles("PanelWidgetFile1.txt", "PanelWidgetFile2.txt"));
         }
 
+        SECTION("Binary file")
+        {
+            REQUIRE_NOTHROW(panel->saveWidgetsToFile("PanelWidgetFile1.txt"));
+            REQUIRE_NOTHROW(panel->saveWidgetsToBinary("PanelWidgetFile.bin"));
+
+            panel->removeAllWidgets();
+            REQUIRE_NOTHROW(panel->loadWidgetsFromBinary("PanelWidgetFile.bin"));
+            REQUIRE(panel->getWidgets().size() == 1);
+
+            REQUIRE_NOTHROW(panel->saveWidgetsToFile("PanelWidgetFile2.txt"));
+            REQUIRE(compareFiles("PanelWidgetFile1.txt", "PanelWidgetFile2.txt"));
+
+            REQUIRE_THROWS_AS(panel->loadWidgetsFromBinary("PanelWidgetFile1.txt"), tgui::Exception);
+        }
+
         SECTION("Save entire panel")
         {
             testSavingWidget("Panel", panel);
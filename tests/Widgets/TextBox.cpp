@@ -176,6 +176,77 @@ TEST_CASE("[TextBox]")
         REQUIRE(textBox->getLinesCount() == 4);
     }
 
+    SECTION("Only changed paragraphs are word wrapped again")
+    {
+        textBox->setSize(100, 200);
+        auto reference = tgui::TextBox::copy(textBox);
+
+        for (unsigned int i = 0; i < 20; ++i)
+            textBox->addText("word " + tgui::to_string(i) + ((i % 5 == 0) ? "\n" : " "));
+
+        reference->setText(textBox->getText());
+        REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+
+        textBox->setCaretPosition(12);
+        textBox->textEntered('\n');
+        textBox->textEntered('x');
+        reference->setText(textBox->getText());
+        REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+
+        sf::Event::KeyEvent backspaceEvent;
+        backspaceEvent.control = false;
+        backspaceEvent.alt     = false;
+        backspaceEvent.shift   = false;
+        backspaceEvent.system  = false;
+        backspaceEvent.code    = sf::Keyboard::Key::BackSpace;
+
+        textBox->setCaretPosition(30);
+        for (unsigned int i = 0; i < 10; ++i)
+            textBox->keyPressed(backspaceEvent);
+
+        reference->setText(textBox->getText());
+        REQUIRE(textBox->getLinesCount() == reference->getLinesCount());
+    }
+
+    SECTION("Caret position in text with many paragraphs")
+    {
+        textBox->setSize(100, 200);
+
+        sf::String text;
+        for (unsigned int i = 0; i < 50; ++i)
+            text += "paragraph " + tgui::to_string(i) + ((i % 3 == 0) ? " with some more words\n" : "\n");
+        textBox->setText(text);
+
+        for (std::size_t pos = 0; pos <= text.getSize(); ++pos)
+        {
+            textBox->setCaretPosition(pos);
+            REQUIRE(textBox->getCaretPosition() == pos);
+        }
+
+        // Paragraphs behind the edited one are still found after it got more lines
+        textBox->setCaretPosition(40);
+        for (unsigned int i = 0; i < 30; ++i)
+            textBox->textEntered('x');
+        REQUIRE(textBox->getCaretPosition() == 70);
+
+        textBox->setCaretPosition(text.getSize());
+        REQUIRE(textBox->getCaretPosition() == text.getSize());
+
+        // Paragraphs behind a removed newline are found as well
+        textBox->setCaretPosition(32);
+        sf::Event::KeyEvent deleteEvent;
+        deleteEvent.control = false;
+        deleteEvent.alt     = false;
+        deleteEvent.shift   = false;
+        deleteEvent.system  = false;
+        deleteEvent.code    = sf::Keyboard::Key::Delete;
+        textBox->keyPressed(deleteEvent);
+        REQUIRE(textBox->getCaretPosition() == 32);
+
+        textBox->setCaretPosition(text.getSize() + 20);
+        REQUIRE(textBox->getCaretPosition() == text.getSize() + 29);
+    }
+
     SECTION("Events / Signals")
     {
         textBox->setSize(165, 100);